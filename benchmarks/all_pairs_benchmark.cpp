@@ -0,0 +1,65 @@
+#include <celero/Celero.h>
+
+#include "graph/graph.hpp"
+#include "graph/algorithms.hpp"
+
+#include <string>
+#include <thread>
+
+CELERO_MAIN
+
+class DenseFixture : public celero::TestFixture {
+public:
+	using MatrixGraph = graph::matrix::WeightedGraph;
+
+	DenseFixture() {}
+
+	std::vector<std::pair<int64_t, uint64_t>> getExperimentValues() const override {
+		std::vector<std::pair<int64_t, uint64_t>> nodeCounts;
+
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(128, 0));
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(512, 0));
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(1024, 0));
+
+		return nodeCounts;
+	}
+
+	void setUp(int64_t experimentValue) override {
+		matrixGraph = MatrixGraph();
+		for(int64_t i = 0; i < experimentValue; ++i) {
+			matrixGraph.addNode(std::to_string(i));
+		}
+
+		// About a quarter of the pairs of nodes are linked.
+		for(int64_t i = 0; i < experimentValue; ++i) {
+			for(int64_t j = 0; j < experimentValue; ++j) {
+				if((i * 31 + j * 17) % 4 == 0 && i != j) {
+					matrixGraph.connect(matrixGraph.getNode(static_cast<size_t>(i)),
+					                    matrixGraph.getNode(static_cast<size_t>(j)),
+					                    {static_cast<int>(1 + (i * 7 + j * 13) % 100)});
+				}
+			}
+		}
+	}
+
+	MatrixGraph matrixGraph;
+};
+
+BASELINE_F(AllPairsShortestPaths, DijkstraFromEachVertex, DenseFixture, 3, 1) {
+	for(auto vertex : matrixGraph.vertices()) {
+		celero::DoNotOptimizeAway(graph::dijkstra(matrixGraph, vertex.getId()));
+	}
+}
+
+BENCHMARK_F(AllPairsShortestPaths, FloydWarshallOneThread, DenseFixture, 3, 1) {
+	celero::DoNotOptimizeAway(graph::floydWarshall(matrixGraph, 1));
+}
+
+BENCHMARK_F(AllPairsShortestPaths, FloydWarshallFourThreads, DenseFixture, 3, 1) {
+	celero::DoNotOptimizeAway(graph::floydWarshall(matrixGraph, 4));
+}
+
+BENCHMARK_F(AllPairsShortestPaths, FloydWarshallHardwareThreads, DenseFixture, 3, 1) {
+	celero::DoNotOptimizeAway(
+	        graph::floydWarshall(matrixGraph, std::thread::hardware_concurrency()));
+}
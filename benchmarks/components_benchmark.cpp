@@ -0,0 +1,78 @@
+#include <celero/Celero.h>
+
+#include "graph/graph.hpp"
+#include "graph/algorithms.hpp"
+
+#include <string>
+#include <thread>
+
+CELERO_MAIN
+
+class ComponentsFixture : public celero::TestFixture {
+public:
+	using ListGraph = graph::list::Graph<graph::NoProperty, graph::NoProperty>;
+	using CsrGraph  = graph::csr::Graph<graph::NoProperty, graph::NoProperty>;
+
+	ComponentsFixture() {}
+
+	std::vector<std::pair<int64_t, uint64_t>> getExperimentValues() const override {
+		std::vector<std::pair<int64_t, uint64_t>> nodeCounts;
+
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(1 << 12, 0));
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(1 << 15, 0));
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(1 << 18, 0));
+
+		return nodeCounts;
+	}
+
+	void setUp(int64_t experimentValue) override {
+		ListGraph listGraph;
+		for(int64_t i = 0; i < experimentValue; ++i) {
+			listGraph.addNode(std::to_string(i));
+		}
+
+		// Every node has two pseudo-random successors, which leaves a few small components
+		// next to a big one.
+		for(int64_t i = 0; i < experimentValue; ++i) {
+			for(int64_t step : {7, 31}) {
+				int64_t end = (i * step + 1) % experimentValue;
+				if((i ^ end) % 5 != 0) {
+					listGraph.addEdges({std::to_string(i), std::to_string(end)});
+				}
+			}
+		}
+
+		csrGraph = CsrGraph(listGraph);
+	}
+
+	CsrGraph csrGraph;
+};
+
+BASELINE_F(ConnectedComponents, OneThread, ComponentsFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::connectedComponents(csrGraph, 1));
+}
+
+BENCHMARK_F(ConnectedComponents, TwoThreads, ComponentsFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::connectedComponents(csrGraph, 2));
+}
+
+BENCHMARK_F(ConnectedComponents, FourThreads, ComponentsFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::connectedComponents(csrGraph, 4));
+}
+
+BENCHMARK_F(ConnectedComponents, HardwareThreads, ComponentsFixture, 10, 1) {
+	celero::DoNotOptimizeAway(
+	        graph::connectedComponents(csrGraph, std::thread::hardware_concurrency()));
+}
+
+BASELINE_F(Triangles, OneThread, ComponentsFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::countTriangles(csrGraph, 1));
+}
+
+BENCHMARK_F(Triangles, FourThreads, ComponentsFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::countTriangles(csrGraph, 4));
+}
+
+BENCHMARK_F(Triangles, ClusteringCoefficients, ComponentsFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::clusteringCoefficients(csrGraph, 4));
+}
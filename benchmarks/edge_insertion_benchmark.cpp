@@ -2,6 +2,11 @@
 
 #include "graph/graph.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <string>
+
 CELERO_MAIN
 
 class EdgeInsertionFixture : public celero::TestFixture {
@@ -27,16 +32,20 @@ public:
 	}
 
 	void setUp(int64_t experimentValue) override {
-		listGraph           = ListGraph();
-		weightedListGraph   = WeightedListGraph();
-		matrixGraph         = MatrixGraph();
-		weightedMatrixGraph = WeightedMatrixGraph();
-
-		size_t name;
+		listGraph            = ListGraph();
+		listGraph1           = ListGraph();
+		weightedListGraph    = WeightedListGraph();
+		weightedListGraph1   = WeightedListGraph();
+		matrixGraph          = MatrixGraph();
+		matrixGraph1         = MatrixGraph();
+		weightedMatrixGraph  = WeightedMatrixGraph();
+		weightedMatrixGraph1 = WeightedMatrixGraph();
+
+		nodes.clear();
+		size_t name = 0;
 		std::generate_n(std::back_inserter(nodes),
 		                experimentValue,
 		                [&name]() { return std::to_string(name++); });
-
 	}
 
 	ListGraph listGraph;
@@ -115,3 +124,67 @@ BENCHMARK_F(EdgeInsertion, WeightedMatrixGraphConnect, EdgeInsertionFixture, 30,
 		}
 	}
 }
+
+class EdgeTraversalFixture : public celero::TestFixture {
+public:
+	using ListGraph   = graph::list::Graph<graph::NoProperty, graph::WeightedProperty>;
+	using MatrixGraph = graph::matrix::Graph<graph::NoProperty, graph::WeightedProperty>;
+
+	EdgeTraversalFixture() {}
+
+	std::vector<std::pair<int64_t, uint64_t>> getExperimentValues() const override {
+		std::vector<std::pair<int64_t, uint64_t>> nodeCounts;
+
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(16, 0));
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(64, 0));
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(256, 0));
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(1024, 0));
+
+		return nodeCounts;
+	}
+
+	void setUp(int64_t experimentValue) override {
+		listGraph   = ListGraph();
+		matrixGraph = MatrixGraph();
+
+		// Most nodes have a few successors, and a few nodes have many successors.
+		for(int64_t i = 0; i < experimentValue; ++i) {
+			int64_t degree = (i % 16 == 0) ? 64 : 3;
+			for(int64_t j = 1; j <= degree; ++j) {
+				ListGraph::Edge_t edge{
+				        std::to_string(i),
+				        std::to_string((i + j * 7) % experimentValue),
+				        graph::WeightedProperty{static_cast<int>(j)}};
+				listGraph.addEdges(edge);
+				matrixGraph.addEdges(edge);
+			}
+		}
+	}
+
+	ListGraph listGraph;
+	MatrixGraph matrixGraph;
+};
+
+BASELINE_F(EdgeTraversal, ListGraphEachEdges, EdgeTraversalFixture, 30, 10) {
+	size_t count = 0;
+	listGraph.eachEdges([&count](ListGraph::ConstNode_t, ListGraph::ConstNode_t) { ++count; });
+	celero::DoNotOptimizeAway(count);
+}
+
+BENCHMARK_F(EdgeTraversal, ListGraphConnections, EdgeTraversalFixture, 30, 10) {
+	graph::list::ConnectionsView connections = listGraph.getConnections();
+	size_t sum = 0;
+	for(size_t beginId = 0; beginId < connections.size(); ++beginId) {
+		for(size_t endId : connections[beginId]) {
+			sum += listGraph.getEdgeProperty(beginId, endId).weight;
+		}
+	}
+	celero::DoNotOptimizeAway(sum);
+}
+
+BENCHMARK_F(EdgeTraversal, MatrixGraphEachEdges, EdgeTraversalFixture, 30, 10) {
+	size_t count = 0;
+	matrixGraph.eachEdges(
+	        [&count](MatrixGraph::ConstNode_t, MatrixGraph::ConstNode_t) { ++count; });
+	celero::DoNotOptimizeAway(count);
+}
@@ -0,0 +1,58 @@
+#include <celero/Celero.h>
+
+#include "graph/graph.hpp"
+#include "graph/flow_network.hpp"
+
+#include <string>
+
+CELERO_MAIN
+
+class FlowFixture : public celero::TestFixture {
+public:
+	using ListGraph = graph::list::Graph<graph::NoProperty, graph::WeightedProperty>;
+	using CsrGraph  = graph::csr::Graph<graph::NoProperty, graph::WeightedProperty>;
+
+	FlowFixture() {}
+
+	std::vector<std::pair<int64_t, uint64_t>> getExperimentValues() const override {
+		std::vector<std::pair<int64_t, uint64_t>> nodeCounts;
+
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(1 << 12, 0));
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(1 << 15, 0));
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(1 << 18, 0));
+
+		return nodeCounts;
+	}
+
+	void setUp(int64_t experimentValue) override {
+		ListGraph listGraph;
+		for(int64_t i = 0; i < experimentValue; ++i) {
+			listGraph.addNode(std::to_string(i));
+		}
+
+		// Every node has four pseudo-random successors with capacities from 1 to 100.
+		for(int64_t i = 0; i < experimentValue; ++i) {
+			for(int64_t step : {3, 7, 31, 127}) {
+				int64_t end  = (i * step + 1) % experimentValue;
+				int capacity = static_cast<int>((i * 31 + end * 17) % 100) + 1;
+				listGraph.addEdges({std::to_string(i), std::to_string(end), {capacity}});
+			}
+		}
+
+		csrGraph = CsrGraph(listGraph);
+		network  = graph::FlowNetwork<int>(csrGraph);
+		sinkId   = static_cast<size_t>(experimentValue / 2);
+	}
+
+	CsrGraph csrGraph;
+	graph::FlowNetwork<int> network;
+	size_t sinkId = 0;
+};
+
+BASELINE_F(MaximumFlow, BuildAndSolve, FlowFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::maximumFlow(csrGraph, 0, sinkId).value);
+}
+
+BENCHMARK_F(MaximumFlow, Solve, FlowFixture, 10, 1) {
+	celero::DoNotOptimizeAway(network.maximumFlow(0, sinkId));
+}
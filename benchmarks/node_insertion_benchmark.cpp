@@ -3,6 +3,8 @@
 #include "graph/graph.hpp"
 
 #include <algorithm>
+#include <list>
+#include <string>
 
 CELERO_MAIN
 
@@ -38,7 +40,8 @@ public:
 		matrixGraph         = MatrixGraph();
 		weightedMatrixGraph = WeightedMatrixGraph();
 
-		size_t name;
+		nodes.clear();
+		size_t name = 0;
 		std::generate_n(std::back_inserter(nodes),
 		                experimentValue,
 		                [&name]() { return std::to_string(name++); });
@@ -0,0 +1,70 @@
+#include <celero/Celero.h>
+
+#include "graph/graph.hpp"
+#include "graph/algorithms.hpp"
+
+#include <string>
+#include <thread>
+
+CELERO_MAIN
+
+class PageRankFixture : public celero::TestFixture {
+public:
+	using ListGraph = graph::list::Graph<graph::NoProperty, graph::NoProperty>;
+	using CsrGraph  = graph::csr::Graph<graph::NoProperty, graph::NoProperty>;
+
+	PageRankFixture() {}
+
+	std::vector<std::pair<int64_t, uint64_t>> getExperimentValues() const override {
+		std::vector<std::pair<int64_t, uint64_t>> nodeCounts;
+
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(1 << 12, 0));
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(1 << 15, 0));
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(1 << 18, 0));
+
+		return nodeCounts;
+	}
+
+	void setUp(int64_t experimentValue) override {
+		ListGraph listGraph;
+		for(int64_t i = 0; i < experimentValue; ++i) {
+			listGraph.addNode(std::to_string(i));
+		}
+
+		// Every node has a few pseudo-random successors, and one node in 16 also points to
+		// one of the first nodes, which gives them a large in-degree as in a web graph.
+		for(int64_t i = 0; i < experimentValue; ++i) {
+			for(int64_t step : {7, 31, 127}) {
+				int64_t end = (i * step + 1) % experimentValue;
+				if(end != i) {
+					listGraph.addEdges({std::to_string(i), std::to_string(end)});
+				}
+			}
+			if(i % 16 == 0 && i >= 64) {
+				listGraph.addEdges({std::to_string(i), std::to_string(i % 64)});
+			}
+		}
+
+		csrGraph = CsrGraph(listGraph);
+		csrGraph.setReverseIndex(true);
+	}
+
+	CsrGraph csrGraph;
+};
+
+BASELINE_F(PageRank, OneThread, PageRankFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::pageRank(csrGraph, 0.85, 1e-9, 20, 1));
+}
+
+BENCHMARK_F(PageRank, TwoThreads, PageRankFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::pageRank(csrGraph, 0.85, 1e-9, 20, 2));
+}
+
+BENCHMARK_F(PageRank, FourThreads, PageRankFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::pageRank(csrGraph, 0.85, 1e-9, 20, 4));
+}
+
+BENCHMARK_F(PageRank, HardwareThreads, PageRankFixture, 10, 1) {
+	celero::DoNotOptimizeAway(
+	        graph::pageRank(csrGraph, 0.85, 1e-9, 20, std::thread::hardware_concurrency()));
+}
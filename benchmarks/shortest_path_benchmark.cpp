@@ -0,0 +1,178 @@
+#include <celero/Celero.h>
+
+#include "graph/graph.hpp"
+#include "graph/algorithms.hpp"
+#include "graph/contraction_hierarchy.hpp"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
+
+CELERO_MAIN
+
+class GridFixture : public celero::TestFixture {
+public:
+	using ListGraph = graph::list::AstarGraph<void>;
+	using CsrGraph  = graph::csr::AstarGraph<void>;
+	using NodeRef   = CsrGraph::NodeRef_t;
+
+	GridFixture() {}
+
+	std::vector<std::pair<int64_t, uint64_t>> getExperimentValues() const override {
+		std::vector<std::pair<int64_t, uint64_t>> sideLengths;
+
+		sideLengths.push_back(std::pair<int64_t, uint64_t>(32, 0));
+		sideLengths.push_back(std::pair<int64_t, uint64_t>(128, 0));
+		sideLengths.push_back(std::pair<int64_t, uint64_t>(512, 0));
+
+		return sideLengths;
+	}
+
+	void setUp(int64_t experimentValue) override {
+		width = static_cast<size_t>(experimentValue);
+
+		// A square grid with four neighbours per cell, where a few cells are walls.
+		ListGraph grid;
+		for(size_t i = 0; i < width * width; ++i) {
+			grid.addNode(std::to_string(i));
+		}
+		auto isWall = [this](size_t x, size_t y) {
+			return x % 8 == 4 && y % 16 != 0 && y + 1 < width;
+		};
+		for(size_t y = 0; y < width; ++y) {
+			for(size_t x = 0; x < width; ++x) {
+				if(isWall(x, y)) {
+					continue;
+				}
+				int weight = 1 + static_cast<int>((x * 7 + y * 13) % 3);
+				if(x + 1 < width && !isWall(x + 1, y)) {
+					link(grid, y * width + x, y * width + x + 1, weight);
+				}
+				if(y + 1 < width && !isWall(x, y + 1)) {
+					link(grid, y * width + x, (y + 1) * width + x, weight);
+				}
+			}
+		}
+
+		csrGraph = CsrGraph(grid);
+		startId  = 0;
+		goalId   = width * width - 1;
+
+		// The bidirectional searches follow the edges backward from the goal.
+		csrGraph.setReverseIndex(true);
+	}
+
+	static void link(ListGraph& grid, size_t a, size_t b, int weight) {
+		grid.addEdges({{std::to_string(a), std::to_string(b), {weight}},
+		               {std::to_string(b), std::to_string(a), {weight}}});
+	}
+
+	// The Manhattan distance to the goal, a lower bound since every weight is at least 1.
+	int manhattan(NodeRef vertex) const {
+		size_t x = vertex.getId() % width, y = vertex.getId() / width;
+		return static_cast<int>((width - 1 - x) + (width - 1 - y));
+	}
+
+	CsrGraph csrGraph;
+	graph::SearchScratch<int> scratch;
+	graph::SearchScratch<int> backwardScratch;
+	graph::SearchScratch<std::uint32_t> bfsScratch;
+	graph::SearchScratch<std::uint32_t> backwardBfsScratch;
+	size_t width   = 0;
+	size_t startId = 0;
+	size_t goalId  = 0;
+};
+
+class HierarchyFixture : public GridFixture {
+public:
+	// Grids are a hard case for contraction hierarchies, whose top levels are the large
+	// separators of the grid, so the preprocessing is kept to smaller grids.
+	std::vector<std::pair<int64_t, uint64_t>> getExperimentValues() const override {
+		std::vector<std::pair<int64_t, uint64_t>> sideLengths;
+
+		sideLengths.push_back(std::pair<int64_t, uint64_t>(32, 0));
+		sideLengths.push_back(std::pair<int64_t, uint64_t>(64, 0));
+		sideLengths.push_back(std::pair<int64_t, uint64_t>(128, 0));
+
+		return sideLengths;
+	}
+
+	void setUp(int64_t experimentValue) override {
+		GridFixture::setUp(experimentValue);
+
+		// The hierarchy is built once per grid, as a service would load it at start-up.
+		if(hierarchy.getIdBound() != csrGraph.getIdBound()) {
+			hierarchy = graph::ContractionHierarchy<int>(csrGraph);
+		}
+
+		queries.clear();
+		size_t cellsCount = width * width;
+		for(size_t i = 0; i < 64; ++i) {
+			queries.emplace_back(i * 7919 % cellsCount, (i * 104729 + 13) % cellsCount);
+		}
+	}
+
+	graph::ContractionHierarchy<int> hierarchy;
+	std::vector<std::pair<size_t, size_t>> queries;
+};
+
+BASELINE_F(GridShortestPath, NoHeuristic, GridFixture, 10, 1) {
+	celero::DoNotOptimizeAway(
+	        graph::astar(csrGraph, startId, goalId, [](NodeRef) { return 0; }, scratch));
+}
+
+BENCHMARK_F(GridShortestPath, Manhattan, GridFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::astar(
+	        csrGraph, startId, goalId, [this](NodeRef v) { return manhattan(v); }, scratch));
+}
+
+BENCHMARK_F(GridShortestPath, ManhattanNewScratch, GridFixture, 10, 1) {
+	celero::DoNotOptimizeAway(
+	        graph::astar(csrGraph, startId, goalId, [this](NodeRef v) { return manhattan(v); }));
+}
+
+BENCHMARK_F(GridShortestPath, Bidirectional, GridFixture, 10, 1) {
+	celero::DoNotOptimizeAway(
+	        graph::bidirectionalDijkstra(csrGraph, startId, goalId, scratch, backwardScratch));
+}
+
+BASELINE_F(GridFewestEdges, Bfs, GridFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::bfs(csrGraph, startId).pathTo(goalId));
+}
+
+BENCHMARK_F(GridFewestEdges, Bidirectional, GridFixture, 10, 1) {
+	celero::DoNotOptimizeAway(
+	        graph::bidirectionalBfs(csrGraph, startId, goalId, bfsScratch, backwardBfsScratch));
+}
+
+BASELINE_F(GridSingleSource, Dijkstra, GridFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::dijkstra(csrGraph, startId));
+}
+
+BENCHMARK_F(GridSingleSource, DeltaSteppingOneThread, GridFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::deltaStepping(csrGraph, startId, 3, 1));
+}
+
+BENCHMARK_F(GridSingleSource, DeltaSteppingFourThreads, GridFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::deltaStepping(csrGraph, startId, 3, 4));
+}
+
+BENCHMARK_F(GridSingleSource, DeltaSteppingHardwareThreads, GridFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::deltaStepping(csrGraph, startId, 3, 0));
+}
+
+BASELINE_F(GridQueries, Dijkstra, HierarchyFixture, 10, 1) {
+	for(auto [queryStart, queryGoal] : queries) {
+		celero::DoNotOptimizeAway(
+		        graph::astar(csrGraph, queryStart, queryGoal, [](NodeRef) { return 0; }, scratch));
+	}
+}
+
+BENCHMARK_F(GridQueries, ContractionHierarchy, HierarchyFixture, 10, 1) {
+	for(auto [queryStart, queryGoal] : queries) {
+		celero::DoNotOptimizeAway(
+		        hierarchy.shortestPath(queryStart, queryGoal, scratch, backwardScratch));
+	}
+}
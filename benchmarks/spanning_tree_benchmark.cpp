@@ -0,0 +1,76 @@
+#include <celero/Celero.h>
+
+#include "graph/graph.hpp"
+#include "graph/algorithms.hpp"
+
+#include <string>
+#include <thread>
+
+CELERO_MAIN
+
+class SpanningTreeFixture : public celero::TestFixture {
+public:
+	using ListGraph = graph::list::Graph<graph::NoProperty, graph::WeightedProperty>;
+	using CsrGraph  = graph::csr::Graph<graph::NoProperty, graph::WeightedProperty>;
+
+	SpanningTreeFixture() {}
+
+	std::vector<std::pair<int64_t, uint64_t>> getExperimentValues() const override {
+		std::vector<std::pair<int64_t, uint64_t>> nodeCounts;
+
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(1 << 12, 0));
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(1 << 15, 0));
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(1 << 18, 0));
+
+		return nodeCounts;
+	}
+
+	void setUp(int64_t experimentValue) override {
+		listGraph = ListGraph();
+		for(int64_t i = 0; i < experimentValue; ++i) {
+			listGraph.addNode(std::to_string(i));
+		}
+
+		// Every node is linked in both directions to three pseudo-random nodes.
+		for(int64_t i = 0; i < experimentValue; ++i) {
+			for(int64_t step : {1, 7, 31}) {
+				int64_t end = (i * step + 1) % experimentValue;
+				if(end != i) {
+					graph::WeightedProperty weight{static_cast<int>((i * 13 + end * 29) % 1000)};
+					listGraph.addEdges({{std::to_string(i), std::to_string(end), weight},
+					                    {std::to_string(end), std::to_string(i), weight}});
+				}
+			}
+		}
+
+		csrGraph = CsrGraph(listGraph);
+	}
+
+	ListGraph listGraph;
+	CsrGraph csrGraph;
+};
+
+BASELINE_F(MinimumSpanningTree, PrimListGraph, SpanningTreeFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::minimumSpanningTreeEdges(listGraph, 0));
+}
+
+BENCHMARK_F(MinimumSpanningTree, PrimCsrGraph, SpanningTreeFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::minimumSpanningTreeEdges(csrGraph, 0));
+}
+
+BENCHMARK_F(MinimumSpanningTree, BoruvkaOneThread, SpanningTreeFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::minimumSpanningForest(csrGraph, 1));
+}
+
+BENCHMARK_F(MinimumSpanningTree, BoruvkaTwoThreads, SpanningTreeFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::minimumSpanningForest(csrGraph, 2));
+}
+
+BENCHMARK_F(MinimumSpanningTree, BoruvkaFourThreads, SpanningTreeFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::minimumSpanningForest(csrGraph, 4));
+}
+
+BENCHMARK_F(MinimumSpanningTree, BoruvkaHardwareThreads, SpanningTreeFixture, 10, 1) {
+	celero::DoNotOptimizeAway(
+	        graph::minimumSpanningForest(csrGraph, std::thread::hardware_concurrency()));
+}
@@ -0,0 +1,188 @@
+#include <celero/Celero.h>
+
+#include "graph/graph.hpp"
+#include "graph/algorithms.hpp"
+
+#include <string>
+#include <vector>
+
+CELERO_MAIN
+
+class TraversalFixture : public celero::TestFixture {
+public:
+	using ListGraph   = graph::list::Graph<graph::NoProperty, graph::WeightedProperty>;
+	using MatrixGraph = graph::matrix::Graph<graph::NoProperty, graph::WeightedProperty>;
+	using CsrGraph    = graph::csr::Graph<graph::NoProperty, graph::WeightedProperty>;
+
+	TraversalFixture() {}
+
+	std::vector<std::pair<int64_t, uint64_t>> getExperimentValues() const override {
+		std::vector<std::pair<int64_t, uint64_t>> nodeCounts;
+
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(16, 0));
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(64, 0));
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(256, 0));
+		nodeCounts.push_back(std::pair<int64_t, uint64_t>(1024, 0));
+
+		return nodeCounts;
+	}
+
+	void setUp(int64_t experimentValue) override {
+		listGraph = ListGraph();
+
+		// Every node has four pseudo-random successors.
+		for(int64_t i = 0; i < experimentValue; ++i) {
+			for(int64_t step : {1, 7, 13, 31}) {
+				listGraph.addEdges({std::to_string(i),
+				                    std::to_string((i * step + 1) % experimentValue),
+				                    graph::WeightedProperty{static_cast<int>(step)}});
+			}
+		}
+
+		matrixGraph = MatrixGraph();
+		listGraph.eachEdges([this](ListGraph::ConstNode_t begin, ListGraph::ConstNode_t end) {
+			matrixGraph.addEdges(
+			        {begin.getName(), end.getName(), listGraph.getEdgeProperty(begin, end)});
+		});
+
+		csrGraph = CsrGraph(listGraph);
+
+		indexedListGraph = listGraph;
+		indexedListGraph.setReverseIndex(true);
+
+		indexedCsrGraph = csrGraph;
+		indexedCsrGraph.setReverseIndex(true);
+
+		sourceIds.clear();
+		for(int64_t i = 0; i < 64; ++i) {
+			sourceIds.push_back(static_cast<size_t>(i * experimentValue / 64));
+		}
+	}
+
+	ListGraph listGraph;
+	ListGraph indexedListGraph;
+	MatrixGraph matrixGraph;
+	CsrGraph csrGraph;
+	CsrGraph indexedCsrGraph;
+	std::vector<size_t> sourceIds;
+};
+
+BASELINE_F(EdgesTraversal, ListGraph, TraversalFixture, 30, 10) {
+	int sum = 0;
+	listGraph.eachEdges([this, &sum](ListGraph::ConstNode_t begin, ListGraph::ConstNode_t end) {
+		sum += listGraph.getEdgeProperty(begin, end).weight;
+	});
+	celero::DoNotOptimizeAway(sum);
+}
+
+BENCHMARK_F(EdgesTraversal, MatrixGraph, TraversalFixture, 30, 10) {
+	int sum = 0;
+	matrixGraph.eachEdges(
+	        [this, &sum](MatrixGraph::ConstNode_t begin, MatrixGraph::ConstNode_t end) {
+		        sum += matrixGraph.getEdgeProperty(begin, end).weight;
+		    });
+	celero::DoNotOptimizeAway(sum);
+}
+
+BENCHMARK_F(EdgesTraversal, CsrGraph, TraversalFixture, 30, 10) {
+	int sum = 0;
+	csrGraph.eachEdges([this, &sum](CsrGraph::ConstNode_t begin, CsrGraph::ConstNode_t end) {
+		sum += csrGraph.getEdgeProperty(begin, end).weight;
+	});
+	celero::DoNotOptimizeAway(sum);
+}
+
+BASELINE_F(EdgesRangeTraversal, ListGraph, TraversalFixture, 30, 10) {
+	int sum = 0;
+	for(auto [begin, end] : listGraph.edges()) {
+		sum += listGraph.getEdgeProperty(begin.getId(), end.getId()).weight;
+	}
+	celero::DoNotOptimizeAway(sum);
+}
+
+BENCHMARK_F(EdgesRangeTraversal, MatrixGraph, TraversalFixture, 30, 10) {
+	int sum = 0;
+	for(auto [begin, end] : matrixGraph.edges()) {
+		sum += matrixGraph.getEdgeProperty(begin.getId(), end.getId()).weight;
+	}
+	celero::DoNotOptimizeAway(sum);
+}
+
+BENCHMARK_F(EdgesRangeTraversal, CsrGraph, TraversalFixture, 30, 10) {
+	int sum = 0;
+	for(auto [begin, end] : csrGraph.edges()) {
+		sum += csrGraph.getEdgeProperty(begin.getId(), end.getId()).weight;
+	}
+	celero::DoNotOptimizeAway(sum);
+}
+
+BASELINE_F(StronglyConnectedComponent, ListGraph, TraversalFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::stronglyConnectedComponent(listGraph, listGraph["0"]));
+}
+
+BENCHMARK_F(StronglyConnectedComponent, MatrixGraph, TraversalFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::stronglyConnectedComponent(matrixGraph, matrixGraph["0"]));
+}
+
+BENCHMARK_F(StronglyConnectedComponent, CsrGraph, TraversalFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::stronglyConnectedComponent(csrGraph, csrGraph["0"]));
+}
+
+BENCHMARK_F(StronglyConnectedComponent, IndexedListGraph, TraversalFixture, 10, 1) {
+	celero::DoNotOptimizeAway(
+	        graph::stronglyConnectedComponent(indexedListGraph, indexedListGraph["0"]));
+}
+
+BASELINE_F(AllStronglyConnectedComponents, PerVertex, TraversalFixture, 10, 1) {
+	// Only the number of the component of each vertex is kept, as with the linear version.
+	std::vector<size_t> components(indexedListGraph.getIdBound());
+	for(auto vertex : indexedListGraph.vertices()) {
+		auto component = graph::stronglyConnectedComponent(indexedListGraph, vertex);
+		components[vertex.getId()] = component.begin()->getId();
+	}
+	celero::DoNotOptimizeAway(components);
+}
+
+BENCHMARK_F(AllStronglyConnectedComponents, ListGraph, TraversalFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::stronglyConnectedComponents(listGraph));
+}
+
+BENCHMARK_F(AllStronglyConnectedComponents, CsrGraph, TraversalFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::stronglyConnectedComponents(csrGraph));
+}
+
+BASELINE_F(BreadthFirstSearch, TopDown, TraversalFixture, 30, 10) {
+	celero::DoNotOptimizeAway(graph::bfs(csrGraph, 0));
+}
+
+BENCHMARK_F(BreadthFirstSearch, DirectionOptimizing, TraversalFixture, 30, 10) {
+	celero::DoNotOptimizeAway(graph::bfs(indexedCsrGraph, 0));
+}
+
+BASELINE_F(MultiSourceBreadthFirstSearch, PerSource, TraversalFixture, 10, 1) {
+	for(size_t sourceId : sourceIds) {
+		celero::DoNotOptimizeAway(graph::bfs(listGraph, sourceId));
+	}
+}
+
+BENCHMARK_F(MultiSourceBreadthFirstSearch, ListGraph, TraversalFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::multiSourceBfs(listGraph, sourceIds));
+}
+
+BENCHMARK_F(MultiSourceBreadthFirstSearch, MatrixGraph, TraversalFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::multiSourceBfs(matrixGraph, sourceIds));
+}
+
+BENCHMARK_F(MultiSourceBreadthFirstSearch, CsrGraph, TraversalFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::multiSourceBfs(csrGraph, sourceIds));
+}
+
+BASELINE_F(Reachability, BfsFromEachVertex, TraversalFixture, 10, 1) {
+	for(auto vertex : matrixGraph.vertices()) {
+		celero::DoNotOptimizeAway(graph::bfs(matrixGraph, vertex.getId()));
+	}
+}
+
+BENCHMARK_F(Reachability, TransitiveClosure, TraversalFixture, 10, 1) {
+	celero::DoNotOptimizeAway(graph::transitiveClosure(matrixGraph));
+}
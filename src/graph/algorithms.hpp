@@ -1,9 +1,28 @@
 #pragma once
 
+#include "bit_matrix.hpp"
+#include "indexed_heap.hpp"
+#include "parallel.hpp"
+#include "path_search.hpp"
+#include "predecessor_index.hpp"
+#include "radix_heap.hpp"
+#include "union_find.hpp"
+
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <map>
 #include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
 
 namespace graph {
 
@@ -15,12 +34,12 @@ namespace graph {
 	template <typename Graph>
 	Graph symmetric(Graph const& g) {
 		std::decay_t<Graph> symmetricGraph;
-		using ConstNode = typename Graph::ConstNode_t;
+		using NodeRef = typename Graph::NodeRef_t;
 
-		g.eachEdges([&symmetricGraph, &g](ConstNode begin, ConstNode end) {
-			std::string beginName = begin.getName(), endName = end.getName();
-			symmetricGraph.addEdges(
-			        {end.getName(), begin.getName(), g.getEdgeProperty(begin, end)});
+		g.eachEdges([&symmetricGraph, &g](NodeRef begin, NodeRef end) {
+			symmetricGraph.addEdges({end.getName(),
+			                         begin.getName(),
+			                         g.getEdgeProperty(begin.getId(), end.getId())});
 		});
 
 		return symmetricGraph;
@@ -33,127 +52,648 @@ namespace graph {
 	 */
 	template <typename Graph>
 	Graph undirected(Graph g) {
-		using ConstNode = typename Graph::ConstNode_t;
+		using NodeRef = typename Graph::NodeRef_t;
 
 		Graph symm = symmetric(g);
 
-		symm.eachEdges([&g, &symm](ConstNode begin, ConstNode end) {
-			g.connect(g[begin.getName()], g[end.getName()], symm.getEdgeProperty(begin, end));
+		symm.eachEdges([&g, &symm](NodeRef begin, NodeRef end) {
+			g.connect(g[begin.getName()],
+			          g[end.getName()],
+			          symm.getEdgeProperty(begin.getId(), end.getId()));
 		});
 
 		return g;
 	}
 
+	/*! \brief Get the vertices which can be reached from a given vertex.
+	 *
+	 * \param g The graph to explore.
+	 * \param vertexId The id of the vertex from which to start.
+	 * \param eachNext A function which calls a given function for each vertex which can be
+	 *                 reached in one step from a vertex, of type void(NodeRef, Functor).
+	 * \return Whether each id is the id of a reachable vertex.
+	 */
+	template <typename Graph, typename Next>
+	std::vector<bool> reachableIds(Graph const& g, size_t vertexId, Next&& eachNext) {
+		using NodeRef = typename Graph::NodeRef_t;
+
+		std::vector<bool> reached(g.getIdBound(), false);
+		std::vector<size_t> verticesToCheck{vertexId};
+		reached[vertexId] = true;
+
+		while(!verticesToCheck.empty()) {
+			NodeRef currentVertex(g, verticesToCheck.back());
+			verticesToCheck.pop_back();
+
+			eachNext(currentVertex, [&reached, &verticesToCheck](NodeRef next) {
+				if(!reached[next.getId()]) {
+					reached[next.getId()] = true;
+					verticesToCheck.push_back(next.getId());
+				}
+			});
+		}
+
+		return reached;
+	}
+
 	/*! \brief Get the strongly connected component of a given vertex.
 	 *
 	 * \param g The graph from which we want the strongly connected component.
 	 * \param vertex The vertex from which to compute the strongly connected component.
 	 * \return the set of vertices which compose the strongly connected component.
+	 * \sa PredecessorIndex
 	 */
 	template <typename Graph>
 	std::set<typename Graph::ConstNode_t> stronglyConnectedComponent(
 	        Graph const& g,
 	        typename Graph::ConstNode_t const& vertex) {
-		using Node = typename Graph::ConstNode_t;
+		using NodeRef = typename Graph::NodeRef_t;
 
-		std::set<Node> verticesToCheck{vertex}, existPathToVertex{vertex},
-		        existPathToVertexSym{vertex};
+		PredecessorIndex<Graph> predecessors(g);
+		std::vector<bool> existPathFromVertex =
+		        reachableIds(g, vertex.getId(), [&g](NodeRef current, auto&& visit) {
+			        g.eachAdjacents(current, visit);
+		        });
+		std::vector<bool> existPathToVertex =
+		        reachableIds(g, vertex.getId(), [&predecessors](NodeRef current, auto&& visit) {
+			        predecessors.eachPredecessors(current, visit);
+		        });
 
-		while(!verticesToCheck.empty()) {
-			auto currentVertex = *verticesToCheck.begin();
-			verticesToCheck.erase(currentVertex);
+		std::set<typename Graph::ConstNode_t> component;
+		for(size_t nodeId = 0; nodeId < existPathFromVertex.size(); ++nodeId) {
+			if(existPathFromVertex[nodeId] && existPathToVertex[nodeId]) {
+				component.insert(g.getNode(nodeId));
+			}
+		}
+
+		return component;
+	}
 
-			g.eachAdjacents(currentVertex,
-			                [&existPathToVertex, &verticesToCheck](Node i) {
-				                if(existPathToVertex.find(i) == existPathToVertex.end()) {
-					                verticesToCheck.insert(i);
-					                existPathToVertex.insert(i);
-				                }
-				            });
+	/*! \brief Get the connected component of a given vertex.
+	 *
+	 * \param g The graph from which we want the connected component.
+	 * \param vertex The vertex from which to compute the connected component.
+	 * \return The set of vertices which compose the connected component.
+	 * \sa PredecessorIndex
+	 */
+	template <typename Graph>
+	std::set<typename Graph::ConstNode_t> connectedComponent(
+	        Graph const& g,
+	        typename Graph::ConstNode_t const& vertex) {
+		using NodeRef = typename Graph::NodeRef_t;
+
+		PredecessorIndex<Graph> predecessors(g);
+		std::vector<bool> connected =
+		        reachableIds(g, vertex.getId(), [&g, &predecessors](NodeRef current, auto&& visit) {
+			        g.eachAdjacents(current, visit);
+			        predecessors.eachPredecessors(current, visit);
+		        });
+
+		std::set<typename Graph::ConstNode_t> component;
+		for(size_t nodeId = 0; nodeId < connected.size(); ++nodeId) {
+			if(connected[nodeId]) {
+				component.insert(g.getNode(nodeId));
+			}
 		}
 
-		Graph sym       = symmetric(g);
-		verticesToCheck = std::set<Node>{sym[vertex.getName()]};
+		return component;
+	}
 
-		while(!verticesToCheck.empty()) {
-			auto currentVertex = *verticesToCheck.begin();
-			verticesToCheck.erase(currentVertex);
+	/*! \brief Find a path with the fewest edges between two vertices, with breadth-first
+	 *         searches from both of them.
+	 *
+	 * The search from the start follows the edges and the search from the goal follows them
+	 * backward. Each step explores a whole level of the smaller frontier, and the searches stop
+	 * at the end of the first level where they meet, so only the vertices close to one of the
+	 * ends are explored.
+	 *
+	 * \param g The graph in which to search.
+	 * \param startId The id of the start of the path.
+	 * \param goalId The id of the end of the path.
+	 * \param forward The scratch space of the search from the start.
+	 * \param backward The scratch space of the search from the goal, where the parent of a
+	 *                 vertex is the next vertex on the path to the goal.
+	 * \return The path found, with its number of edges as length, which is empty if the goal
+	 *         cannot be reached.
+	 * \sa PredecessorIndex
+	 */
+	template <typename Graph>
+	ShortestPath<std::uint32_t> bidirectionalBfs(Graph const& g,
+	                                             size_t startId,
+	                                             size_t goalId,
+	                                             SearchScratch<std::uint32_t>& forward,
+	                                             SearchScratch<std::uint32_t>& backward) {
+		using NodeRef = typename Graph::NodeRef_t;
+		using Scratch = SearchScratch<std::uint32_t>;
+
+		PredecessorIndex<Graph> predecessors(g);
 
-			sym.eachAdjacents(currentVertex,
-			                  [&existPathToVertexSym, &verticesToCheck, &g](Node i) {
-				                  if(existPathToVertexSym.find(i) == existPathToVertexSym.end()) {
-					                  verticesToCheck.insert(i);
-					                  existPathToVertexSym.insert(i);
-				                  }
-				              });
+		forward.reset(g.getIdBound());
+		backward.reset(g.getIdBound());
+		forward.reach(startId, 0, startId);
+		backward.reach(goalId, 0, goalId);
+		if(startId == goalId) {
+			return forward.pathTo(startId);
 		}
 
-		std::set<Node> existPathToVertexSymTemp, component;
+		size_t meetingId     = Scratch::npos;
+		std::uint32_t length = 0;
+		std::vector<size_t> forwardFrontier{startId}, backwardFrontier{goalId}, next;
+		auto expand = [&](std::vector<size_t>& frontier, Scratch& scratch, Scratch const& other,
+		                  auto const& nextVertices) {
+			next.clear();
+			for(size_t id : frontier) {
+				std::uint32_t distance = scratch.getDistance(id) + 1;
+				nextVertices(NodeRef(g, id), [&](NodeRef vertex) {
+					size_t nextId = vertex.getId();
+					if(scratch.isReached(nextId)) {
+						return;
+					}
+					scratch.reach(nextId, distance, id);
+					next.push_back(nextId);
+					if(other.isReached(nextId) &&
+					   (meetingId == Scratch::npos ||
+					    distance + other.getDistance(nextId) < length)) {
+						meetingId = nextId;
+						length    = distance + other.getDistance(nextId);
+					}
+				});
+			}
+			frontier.swap(next);
+		};
+		auto eachAdjacents = [&g](NodeRef vertex, auto&& visit) {
+			g.eachAdjacents(vertex, visit);
+		};
+		auto eachPredecessors = [&predecessors](NodeRef vertex, auto&& visit) {
+			predecessors.eachPredecessors(vertex, visit);
+		};
 
-		for(auto const& node : existPathToVertexSym) {
-			existPathToVertexSymTemp.insert(g[node.getName()]);
+		while(meetingId == Scratch::npos && !forwardFrontier.empty() &&
+		      !backwardFrontier.empty()) {
+			if(forwardFrontier.size() <= backwardFrontier.size()) {
+				expand(forwardFrontier, forward, backward, eachAdjacents);
+			} else {
+				expand(backwardFrontier, backward, forward, eachPredecessors);
+			}
 		}
 
-		std::set_intersection(existPathToVertex.begin(),
-		                      existPathToVertex.end(),
-		                      existPathToVertexSymTemp.begin(),
-		                      existPathToVertexSymTemp.end(),
-		                      std::inserter(component, component.begin()));
+		if(meetingId == Scratch::npos) {
+			return ShortestPath<std::uint32_t>();
+		}
+		return joinPaths(forward, backward, meetingId, length);
+	}
 
-		return component;
+	/*! \brief Find a path with the fewest edges between two vertices, with breadth-first
+	 *         searches from both of them.
+	 *
+	 * \param g The graph in which to search.
+	 * \param startId The id of the start of the path.
+	 * \param goalId The id of the end of the path.
+	 * \return The path found, with its number of edges as length, which is empty if the goal
+	 *         cannot be reached.
+	 * \sa bidirectionalBfs(Graph const&, size_t, size_t, SearchScratch<std::uint32_t>&,
+	 *                      SearchScratch<std::uint32_t>&)
+	 */
+	template <typename Graph>
+	ShortestPath<std::uint32_t> bidirectionalBfs(Graph const& g, size_t startId, size_t goalId) {
+		SearchScratch<std::uint32_t> forward, backward;
+		return bidirectionalBfs(g, startId, goalId, forward, backward);
 	}
 
-	/*! \brief Get the connected component of a given vertex.
+	/*! \brief Find a shortest path between two vertices, with Dijkstra searches from both of
+	 *         them.
 	 *
-	 * \param g The graph from which we want the connected component.
-	 * \param vertex The vertex from which to compute the connected component.
-	 * \return The set of vertices which compose the connected component.
+	 * The search from the start follows the edges and the search from the goal follows them
+	 * backward, each step exploring the closest vertex of the search whose closest vertex is
+	 * the nearest. The shortest path found through a vertex reached by both searches is kept,
+	 * and the searches stop when the sum of the distances of their closest vertices is not
+	 * lower than its length.
+	 *
+	 * \param g The graph in which to search, with a `weight` in its edge property. The weights
+	 *          must not be negative.
+	 * \param startId The id of the start of the path.
+	 * \param goalId The id of the end of the path.
+	 * \param forward The scratch space of the search from the start.
+	 * \param backward The scratch space of the search from the goal, where the parent of a
+	 *                 vertex is the next vertex on the path to the goal.
+	 * \return The path found, which is empty if the goal cannot be reached.
+	 * \sa PredecessorIndex
+	 */
+	template <typename Graph, typename Distance>
+	ShortestPath<Distance> bidirectionalDijkstra(Graph const& g,
+	                                             size_t startId,
+	                                             size_t goalId,
+	                                             SearchScratch<Distance>& forward,
+	                                             SearchScratch<Distance>& backward) {
+		using NodeRef = typename Graph::NodeRef_t;
+		using Scratch = SearchScratch<Distance>;
+
+		PredecessorIndex<Graph> predecessors(g, true);
+
+		forward.reset(g.getIdBound());
+		backward.reset(g.getIdBound());
+		forward.reach(startId, Distance(), startId);
+		backward.reach(goalId, Distance(), goalId);
+		if(startId == goalId) {
+			return forward.pathTo(startId);
+		}
+
+		size_t meetingId = Scratch::npos;
+		Distance length{};
+		auto relax = [&meetingId, &length](Scratch& scratch, Scratch const& other, size_t id,
+		                                   size_t nextId, Distance distance) {
+			if(scratch.isReached(nextId) && !(distance < scratch.getDistance(nextId))) {
+				return;
+			}
+			scratch.reach(nextId, distance, id);
+			scratch.getHeap().pushOrDecrease(nextId, distance);
+			if(other.isReached(nextId)) {
+				Distance total = distance + other.getDistance(nextId);
+				if(meetingId == Scratch::npos || total < length) {
+					meetingId = nextId;
+					length    = total;
+				}
+			}
+		};
+
+		auto& forwardHeap  = forward.getHeap();
+		auto& backwardHeap = backward.getHeap();
+		forwardHeap.push(startId, Distance());
+		backwardHeap.push(goalId, Distance());
+		while(!forwardHeap.empty() && !backwardHeap.empty()) {
+			if(meetingId != Scratch::npos &&
+			   !(forwardHeap.topKey() + backwardHeap.topKey() < length)) {
+				break;
+			}
+
+			if(!(backwardHeap.topKey() < forwardHeap.topKey())) {
+				size_t id         = forwardHeap.pop();
+				Distance distance = forward.getDistance(id);
+				g.eachAdjacentEdges(NodeRef(g, id), [&](NodeRef end, auto const& p) {
+					relax(forward, backward, id, end.getId(), distance + p.weight);
+				});
+			} else {
+				size_t id         = backwardHeap.pop();
+				Distance distance = backward.getDistance(id);
+				predecessors.eachPredecessorEdges(NodeRef(g, id),
+				                                  [&](NodeRef begin, auto const& p) {
+					                                  relax(backward, forward, id, begin.getId(),
+					                                        distance + p.weight);
+				                                  });
+			}
+		}
+
+		if(meetingId == Scratch::npos) {
+			return ShortestPath<Distance>();
+		}
+		return joinPaths(forward, backward, meetingId, length);
+	}
+
+	/*! \brief Find a shortest path between two vertices, with Dijkstra searches from both of
+	 *         them.
+	 *
+	 * \param g The graph in which to search, with a `weight` in its edge property.
+	 * \param startId The id of the start of the path.
+	 * \param goalId The id of the end of the path.
+	 * \return The path found, which is empty if the goal cannot be reached.
+	 * \sa bidirectionalDijkstra(Graph const&, size_t, size_t, SearchScratch<Distance>&,
+	 *                           SearchScratch<Distance>&)
 	 */
 	template <typename Graph>
-	std::set<typename Graph::ConstNode_t> connectedComponent(
-	        Graph const& g,
-	        typename Graph::ConstNode_t const& vertex) {
-		using Node = typename Graph::ConstNode_t;
+	auto bidirectionalDijkstra(Graph const& g, size_t startId, size_t goalId) {
+		using Weight = std::decay_t<decltype(g.getEdgeProperty(startId, goalId).weight)>;
 
-		std::set<std::string> verticesToCheck{vertex.getName()}, component{vertex.getName()};
+		SearchScratch<Weight> forward, backward;
+		return bidirectionalDijkstra(g, startId, goalId, forward, backward);
+	}
 
-		Graph sym = symmetric(g);
+	/*! \brief The component of the ids which are not used by a node of the graph.
+	 */
+	constexpr std::uint32_t const noComponent = static_cast<std::uint32_t>(-1);
 
-		while(!verticesToCheck.empty()) {
-			auto currentVertex = *verticesToCheck.begin();
-			verticesToCheck.erase(currentVertex);
+	/*! \brief Get every strongly connected components of a graph.
+	 *
+	 * This uses an iterative version of the Tarjan algorithm, so it runs in a time linear in the
+	 * size of the graph and does not overflow the call stack on deep graphs.
+	 *
+	 * The components are numbered from 0, in a reverse topological order of the condensation of
+	 * the graph: an edge between two components always goes to the one with the lower number.
+	 *
+	 * \param g The graph from which we want the strongly connected components.
+	 * \return The component of each node id, or noComponent for the ids which are not used.
+	 */
+	template <typename Graph>
+	std::vector<std::uint32_t> stronglyConnectedComponents(Graph const& g) {
+		using Adjacent = typename Graph::AdjacentRange_t::iterator;
+
+		// A vertex being explored, with the adjacents left to explore.
+		struct Frame {
+			size_t id;
+			Adjacent next, last;
+		};
+
+		std::uint32_t const unvisited = static_cast<std::uint32_t>(-1);
+
+		size_t idBound = g.getIdBound();
+		std::vector<std::uint32_t> components(idBound, noComponent), order(idBound, unvisited),
+		        lowLink(idBound);
+		std::vector<bool> onStack(idBound, false);
+		std::vector<size_t> stack;
+		std::vector<Frame> frames;
+		std::uint32_t visitedCount = 0, componentsCount = 0;
+
+		auto visit = [&](size_t nodeId) {
+			order[nodeId] = lowLink[nodeId] = visitedCount++;
+			stack.push_back(nodeId);
+			onStack[nodeId] = true;
+
+			auto adjacents = g.adjacents(nodeId);
+			frames.push_back(Frame{nodeId, adjacents.begin(), adjacents.end()});
+		};
+
+		for(auto root : g.vertices()) {
+			if(order[root.getId()] != unvisited) {
+				continue;
+			}
+
+			visit(root.getId());
+			while(!frames.empty()) {
+				Frame& frame = frames.back();
+				size_t nodeId = frame.id;
+
+				if(frame.next != frame.last) {
+					size_t endId = (*frame.next).getId();
+					++frame.next;
+
+					if(order[endId] == unvisited) {
+						// The frame reference is invalidated here.
+						visit(endId);
+					} else if(onStack[endId]) {
+						lowLink[nodeId] = std::min(lowLink[nodeId], order[endId]);
+					}
+					continue;
+				}
+
+				frames.pop_back();
+				if(!frames.empty()) {
+					size_t parentId   = frames.back().id;
+					lowLink[parentId] = std::min(lowLink[parentId], lowLink[nodeId]);
+				}
+
+				if(lowLink[nodeId] == order[nodeId]) {
+					size_t memberId;
+					do {
+						memberId = stack.back();
+						stack.pop_back();
+						onStack[memberId]    = false;
+						components[memberId] = componentsCount;
+					} while(memberId != nodeId);
+					++componentsCount;
+				}
+			}
+		}
+
+		return components;
+	}
+
+	/*! \brief Build the condensation of a graph, where each strongly connected component is
+	 *         contracted into a single vertex.
+	 *
+	 * The vertex of a component is named after the number of the component, and is added in the
+	 * order of the numbers, so that its id is the number of the component when the result graph
+	 * gives dense ids. There is at most one edge between two components, and no edge from a
+	 * component to itself, so the result is a directed acyclic graph.
+	 *
+	 * \param g The graph to condense.
+	 * \param components The component of each node id, as given by
+	 *                   stronglyConnectedComponents().
+	 * \return The condensation of the graph.
+	 */
+	template <typename Dag, typename Graph>
+	Dag condensation(Graph const& g, std::vector<std::uint32_t> const& components) {
+		std::uint32_t componentsCount = 0;
+		for(std::uint32_t component : components) {
+			if(component != noComponent) {
+				componentsCount = std::max(componentsCount, component + 1);
+			}
+		}
+
+		Dag dag;
+		for(std::uint32_t component = 0; component < componentsCount; ++component) {
+			dag.addNode(std::to_string(component));
+		}
+
+		// Only the first edge between two components is added.
+		std::set<std::pair<std::uint32_t, std::uint32_t>> componentEdges;
+		for(auto [begin, end] : g.edges()) {
+			std::uint32_t beginComponent = components[begin.getId()],
+			              endComponent   = components[end.getId()];
+			if(beginComponent != endComponent &&
+			   componentEdges.insert({beginComponent, endComponent}).second) {
+				dag.addEdges(
+				        {std::to_string(beginComponent), std::to_string(endComponent)});
+			}
+		}
+
+		return dag;
+	}
+
+	/*! \brief The reachability between every pair of vertices of a graph, as given by
+	 *         transitiveClosure().
+	 */
+	struct TransitiveClosure {
+		/*! \brief Check if there is a path from a vertex to another one. Every vertex can reach
+		 *         itself.
+		 *
+		 * \param beginId The id of the start of the path.
+		 * \param endId The id of the end of the path.
+		 */
+		bool reachable(size_t beginId, size_t endId) const {
+			return reachability.test(beginId, endId);
+		}
+
+		/*! \brief A matrix with a row for each id, where the bits of the vertices which can be
+		 *         reached from it are set.
+		 */
+		BitMatrix reachability;
+	};
+
+	/*! \brief Get the vertices which can be reached from each vertex of a graph.
+	 *
+	 * The strongly connected components are found first, see stronglyConnectedComponents().
+	 * They are numbered in a reverse topological order, so the set of vertices reached from
+	 * each component is built in this order by or-ing the sets of the components it has an
+	 * edge to, a whole row of words at once, instead of exploring the graph from each vertex.
+	 *
+	 * \param g The graph.
+	 * \return The reachability matrix, which takes getIdBound() * getIdBound() bits.
+	 */
+	template <typename Graph>
+	TransitiveClosure transitiveClosure(Graph const& g) {
+		std::vector<std::uint32_t> components = stronglyConnectedComponents(g);
+		std::uint32_t componentsCount         = 0;
+		for(std::uint32_t component : components) {
+			if(component != noComponent) {
+				componentsCount = std::max(componentsCount, component + 1);
+			}
+		}
+
+		std::vector<std::vector<size_t>> members(componentsCount);
+		for(size_t id = 0; id < components.size(); ++id) {
+			if(components[id] != noComponent) {
+				members[components[id]].push_back(id);
+			}
+		}
 
-			g.eachAdjacents(g[currentVertex],
-			                [&component, &verticesToCheck](Node i) {
-				                std::string nodeName = i.getName();
-				                if(component.find(nodeName) == component.end()) {
-					                verticesToCheck.insert(nodeName);
-					                component.insert(nodeName);
-				                }
-				            });
+		// The edges of a component only go to components with lower numbers, whose rows are
+		// complete. Each of them is or-ed once even if several edges go to it.
+		size_t idBound = g.getIdBound();
+		BitMatrix componentRows(componentsCount, idBound);
+		std::vector<std::uint32_t> oredInto(componentsCount, noComponent);
+		for(std::uint32_t component = 0; component < componentsCount; ++component) {
+			for(size_t id : members[component]) {
+				componentRows.set(component, id);
+				for(auto adjacent : g.adjacents(id)) {
+					std::uint32_t next = components[adjacent.getId()];
+					if(next != component && oredInto[next] != component) {
+						oredInto[next] = component;
+						componentRows.orRow(component, next);
+					}
+				}
+			}
+		}
 
-			sym.eachAdjacents(sym[currentVertex],
-			                  [&component, &verticesToCheck, &g](Node i) {
-				                  std::string nodeName = i.getName();
-				                  if(component.find(nodeName) == component.end()) {
-					                  verticesToCheck.insert(nodeName);
-					                  component.insert(nodeName);
-				                  }
-				              });
+		TransitiveClosure closure{BitMatrix(idBound, idBound)};
+		size_t wordsCount = bits::wordsFor(idBound);
+		for(size_t id = 0; id < idBound; ++id) {
+			if(components[id] != noComponent) {
+				bits::orWords(closure.reachability.row(id),
+				              componentRows.row(components[id]), wordsCount);
+			}
 		}
+		return closure;
+	}
+
+	/*! \brief Get every connected components of a graph, from several threads.
+	 *
+	 * The direction of the edges is ignored. The edges are scanned by blocks of start ids, and
+	 * their ends are merged in a ConcurrentUnionFind, so the reverse index of the graph is not
+	 * needed and no lock is taken.
+	 *
+	 * The components are numbered from 0, in increasing order of the lowest id of their
+	 * vertices.
+	 *
+	 * \param g The graph from which we want the connected components.
+	 * \param threads The number of threads to use, or 0 to use one thread per hardware thread.
+	 * \return The component of each node id, or noComponent for the ids which are not used.
+	 */
+	template <typename Graph>
+	std::vector<std::uint32_t> connectedComponents(Graph const& g, size_t threads) {
+		size_t const blockSize = 1024;
 
-		std::set<Node> nodeComponent;
+		size_t idBound = g.getIdBound();
+		ConcurrentUnionFind sets(idBound);
 
-		for(auto const& nodeName : component) {
-			nodeComponent.insert(g[nodeName]);
+		parallelFor(0, idBound, threads, blockSize, [&g, &sets](size_t first, size_t last, size_t) {
+			for(size_t nodeId = first; nodeId < last; ++nodeId) {
+				if(!g.hasNodeId(nodeId)) {
+					continue;
+				}
+				for(auto adjacent : g.adjacents(nodeId)) {
+					sets.unite(static_cast<std::uint32_t>(nodeId),
+					           static_cast<std::uint32_t>(adjacent.getId()));
+				}
+			}
+		});
+
+		// The root of a set is its lowest id, so it is numbered before the other ids of the set.
+		std::vector<std::uint32_t> components(idBound, noComponent);
+		std::uint32_t componentsCount = 0;
+		for(auto vertex : g.vertices()) {
+			std::uint32_t nodeId = static_cast<std::uint32_t>(vertex.getId());
+			std::uint32_t root   = sets.find(nodeId);
+			components[nodeId]   = root == nodeId ? componentsCount++ : components[root];
 		}
 
-		return nodeComponent;
+		return components;
+	}
+
+	/*! \brief Apply a function to each edge of the minimum spanning tree of the component of a
+	 *         given vertex.
+	 *
+	 * This implementation uses the Prim algorithm. The vertices which are not in the tree yet
+	 * are kept in an IndexedHeap, with the weight of their lightest edge from the tree as key,
+	 * so that each edge is looked at once and each vertex is in the heap at most once. The
+	 * property of the lightest edge is kept with the parent of each vertex, so that the right
+	 * one is given among parallel edges.
+	 *
+	 * \param g The graph from which we want the minimum spanning tree. The graph must be an
+	 *          undirected graph with a `weight` in its edge property, or the result will be
+	 *          garbage.
+	 * \param vertexId The id of the vertex from which to compute the minimum spanning tree.
+	 * \param f The function, called with the id of the start of the edge, the id of its end
+	 *          and its property, in the order in which the edges are added to the tree. The
+	 *          start is always already in the tree.
+	 */
+	template <typename Graph, typename Functor>
+	void eachMinimumSpanningTreeEdges(Graph const& g, size_t vertexId, Functor&& f) {
+		using NodeRef      = typename Graph::NodeRef_t;
+		using EdgeProperty = std::decay_t<decltype(g.getEdgeProperty(vertexId, vertexId))>;
+		using Weight       = std::decay_t<decltype(std::declval<EdgeProperty>().weight)>;
+
+		size_t idBound = g.getIdBound();
+		IndexedHeap<Weight> lightestEdges(idBound);
+		std::vector<size_t> parents(idBound);
+		std::vector<EdgeProperty> parentEdges(idBound);
+		std::vector<bool> inTree(idBound, false);
+
+		lightestEdges.push(vertexId, Weight());
+		while(!lightestEdges.empty()) {
+			size_t nodeId  = lightestEdges.pop();
+			inTree[nodeId] = true;
+			if(nodeId != vertexId) {
+				f(parents[nodeId], nodeId, parentEdges[nodeId]);
+			}
+
+			g.eachAdjacentEdges(NodeRef(g, nodeId),
+			                    [&inTree, &lightestEdges, &parents, &parentEdges, nodeId](
+			                            NodeRef end, auto const& property) {
+				                    size_t endId = end.getId();
+				                    if(!inTree[endId] &&
+				                       lightestEdges.pushOrDecrease(endId, property.weight)) {
+					                    parents[endId]     = nodeId;
+					                    parentEdges[endId] = property;
+				                    }
+			                    });
+		}
+	}
+
+	/*! \brief Get the edges of the minimum spanning tree of the component of a given vertex.
+	 *
+	 * \param g The graph from which we want the minimum spanning tree. The graph must be an
+	 *          undirected graph with a `weight` in its edge property, or the result will be
+	 *          garbage.
+	 * \param vertexId The id of the vertex from which to compute the minimum spanning tree.
+	 * \return The edges of the tree, as the ids of their start and of their end, in the order
+	 *         in which they were added to the tree. The start is always already in the tree.
+	 * \sa eachMinimumSpanningTreeEdges()
+	 */
+	template <typename Graph>
+	std::vector<std::pair<size_t, size_t>> minimumSpanningTreeEdges(Graph const& g,
+	                                                                size_t vertexId) {
+		std::vector<std::pair<size_t, size_t>> treeEdges;
+		eachMinimumSpanningTreeEdges(g, vertexId, [&treeEdges](size_t beginId, size_t endId,
+		                                                       auto const&) {
+			treeEdges.emplace_back(beginId, endId);
+		});
+		return treeEdges;
 	}
 
 	/*! \brief Get the minimum spanning tree of a given graph.
 	 *
-	 * This implementation uses the Prim algorithm.
+	 * The edges are given by eachMinimumSpanningTreeEdges(), and the tree is built in a single
+	 * pass: its vertices are added first, with their properties, then each edge is connected
+	 * in both directions.
 	 *
 	 * \param g The graph from which we want the minimum spanning tree. The graph must be an
 	 *          undirected graph or the result will be garbage.
@@ -162,44 +702,1418 @@ namespace graph {
 	 */
 	template <typename Graph>
 	Graph minimumSpanningTree(Graph const& g, typename Graph::ConstNode_t const& vertex) {
-		using ConstNode   = typename Graph::ConstNode_t;
+		using EdgeProperty = std::decay_t<decltype(g.getEdgeProperty(0, 0))>;
 
-		auto compareEdges([&g](std::pair<ConstNode, ConstNode> left,
-		                       std::pair<ConstNode, ConstNode> right) mutable {
-			return g.getEdgeProperty(left.first, left.second).weight <
-			       g.getEdgeProperty(right.first, right.second).weight;
+		std::vector<std::pair<size_t, size_t>> treeEdges;
+		std::vector<EdgeProperty> treeProperties;
+		eachMinimumSpanningTreeEdges(g, vertex.getId(), [&](size_t beginId, size_t endId,
+		                                                    EdgeProperty const& property) {
+			treeEdges.emplace_back(beginId, endId);
+			treeProperties.push_back(property);
 		});
 
-		std::set<std::pair<ConstNode, ConstNode>, decltype(compareEdges)> sortedEdgesToCheck(
-		        compareEdges);
-		std::set<ConstNode> checkedNodes{vertex};
-		std::set<std::pair<ConstNode, ConstNode>> mstEdgeSet;
+		// The ids of a new graph are given in insertion order.
+		Graph mst;
+		std::vector<size_t> treeIds(g.getIdBound());
+		treeIds[vertex.getId()] = 0;
+		mst.addNode(g.getName(vertex.getId()), g.getNodeProperty(vertex.getId()));
+		for(size_t i = 0; i < treeEdges.size(); ++i) {
+			size_t endId   = treeEdges[i].second;
+			treeIds[endId] = i + 1;
+			mst.addNode(g.getName(endId), g.getNodeProperty(endId));
+		}
 
-		g.eachAdjacents(vertex, [&g, &sortedEdgesToCheck, &vertex](ConstNode end) {
-			sortedEdgesToCheck.insert({vertex, end});
+		for(size_t i = 0; i < treeEdges.size(); ++i) {
+			auto [beginId, endId] = treeEdges[i];
+			auto begin = mst.getNode(treeIds[beginId]), end = mst.getNode(treeIds[endId]);
+			mst.connect(begin, end, treeProperties[i]);
+			mst.connect(end, begin, treeProperties[i]);
+		}
+		return mst;
+	}
+
+	/*! \brief A minimum spanning forest, as given by minimumSpanningForest().
+	 */
+	template <typename Weight>
+	struct SpanningForest {
+		/*! \brief The edges of the forest, as the ids of their start and of their end, in no
+		 *         particular order.
+		 */
+		std::vector<std::pair<size_t, size_t>> edges;
+
+		/*! \brief The sum of the weights of the edges.
+		 */
+		Weight totalWeight{};
+	};
+
+	/*! \brief Get a minimum spanning forest of a graph, from several threads.
+	 *
+	 * This implementation uses the Boruvka algorithm. Each round, the lightest edge leaving
+	 * each tree is looked for in parallel, the trees are merged along these edges in a
+	 * ConcurrentUnionFind, and the edges inside a tree are filtered out. The number of trees is
+	 * at least halved by each round. Edges with equal weights are ordered by their position, so
+	 * that no cycle can be made.
+	 *
+	 * Unlike minimumSpanningTree(), every component of the graph gets a tree, and the direction
+	 * of the edges is ignored.
+	 *
+	 * \param g The graph from which we want the minimum spanning forest, with a `weight` in
+	 *          its edge property.
+	 * \param threads The number of threads to use, or 0 to use one thread per hardware thread.
+	 * \return The edges of the forest and their total weight.
+	 */
+	template <typename Graph>
+	auto minimumSpanningForest(Graph const& g, size_t threads) {
+		using NodeRef = typename Graph::NodeRef_t;
+		using Weight  = std::decay_t<decltype(g.getEdgeProperty(0, 0).weight)>;
+
+		struct WeightedEdge {
+			std::uint32_t beginId, endId;
+			Weight weight;
+		};
+
+		size_t const blockSize = 4096;
+		size_t const none      = static_cast<size_t>(-1);
+
+		threads        = threadsCount(threads);
+		size_t idBound = g.getIdBound();
+
+		std::vector<WeightedEdge> edges;
+		for(auto vertex : g.vertices()) {
+			auto beginId = static_cast<std::uint32_t>(vertex.getId());
+			g.eachAdjacentEdges(vertex, [&edges, beginId](NodeRef end, auto const& property) {
+				auto endId = static_cast<std::uint32_t>(end.getId());
+				if(beginId != endId) {
+					edges.push_back(WeightedEdge{beginId, endId, property.weight});
+				}
+			});
+		}
+
+		ConcurrentUnionFind trees(idBound);
+		std::vector<std::atomic<size_t>> lightestEdges(idBound);
+		parallelFor(0, idBound, threads, blockSize, [&lightestEdges, none](
+		                                                    size_t first, size_t last, size_t) {
+			for(size_t i = first; i < last; ++i) {
+				lightestEdges[i].store(none, std::memory_order_relaxed);
+			}
 		});
 
-		while(sortedEdgesToCheck.size() != 0) {
-			auto const& currentEdge = *sortedEdgesToCheck.begin();
-			if(checkedNodes.count(currentEdge.second) == 0) {
-				mstEdgeSet.insert(currentEdge);
+		// Store an edge as the lightest edge leaving a tree, if it is lighter than the current one.
+		auto offer = [&edges, &lightestEdges, none](std::uint32_t root, size_t edge) {
+			size_t current = lightestEdges[root].load(std::memory_order_relaxed);
+			while(current == none || edges[edge].weight < edges[current].weight ||
+			      (!(edges[current].weight < edges[edge].weight) && edge < current)) {
+				if(lightestEdges[root].compare_exchange_weak(
+				           current, edge, std::memory_order_relaxed)) {
+					return;
+				}
+			}
+		};
 
-				g.eachAdjacents(currentEdge.second,
-				                  [&sortedEdgesToCheck, begin = currentEdge.second ](ConstNode end){
-								  	sortedEdgesToCheck.insert({begin, end});
-				                  });
-				checkedNodes.insert(currentEdge.second);
+		auto findLightestEdges = [&edges, &trees, &offer](size_t first, size_t last, size_t) {
+			for(size_t edge = first; edge < last; ++edge) {
+				std::uint32_t beginRoot = trees.find(edges[edge].beginId),
+				              endRoot   = trees.find(edges[edge].endId);
+				if(beginRoot != endRoot) {
+					offer(beginRoot, edge);
+					offer(endRoot, edge);
+				}
 			}
+		};
+
+		// The lightest edge of a tree is only stored at its root, and every merge is done along
+		// one of them, so merging in any order never makes a cycle.
+		std::vector<std::vector<std::pair<size_t, size_t>>> treeEdges(threads);
+		std::vector<Weight> treeWeights(threads, Weight());
+		auto mergeTrees = [&edges, &trees, &lightestEdges, &treeEdges, &treeWeights, none](
+		                          size_t first, size_t last, size_t thread) {
+			for(size_t root = first; root < last; ++root) {
+				size_t edge = lightestEdges[root].load(std::memory_order_relaxed);
+				if(edge == none) {
+					continue;
+				}
+				lightestEdges[root].store(none, std::memory_order_relaxed);
 
-			sortedEdgesToCheck.erase(sortedEdgesToCheck.begin());
+				WeightedEdge const& lightest = edges[edge];
+				if(trees.unite(lightest.beginId, lightest.endId)) {
+					treeEdges[thread].emplace_back(lightest.beginId, lightest.endId);
+					treeWeights[thread] += lightest.weight;
+				}
+			}
+		};
+
+		// Only the edges between different trees are kept, in the same order.
+		std::vector<std::vector<WeightedEdge>> keptEdges;
+		auto filterEdges = [&edges, &trees, &keptEdges, blockSize](
+		                           size_t first, size_t last, size_t) {
+			auto& kept = keptEdges[first / blockSize];
+			for(size_t edge = first; edge < last; ++edge) {
+				if(!trees.sameSet(edges[edge].beginId, edges[edge].endId)) {
+					kept.push_back(edges[edge]);
+				}
+			}
+		};
+
+		while(!edges.empty()) {
+			parallelFor(0, edges.size(), threads, blockSize, findLightestEdges);
+			parallelFor(0, idBound, threads, blockSize, mergeTrees);
+
+			keptEdges.assign((edges.size() + blockSize - 1) / blockSize, {});
+			parallelFor(0, edges.size(), threads, blockSize, filterEdges);
+
+			edges.clear();
+			for(auto const& kept : keptEdges) {
+				edges.insert(edges.end(), kept.begin(), kept.end());
+			}
 		}
 
-		Graph mst;
-		for(auto const& edge : mstEdgeSet) {
-			mst.addEdges({edge.first.getName(), edge.second.getName()});
-			mst.setEdgeProperty(
-			        edge.first, edge.second, g.getEdgeProperty(edge.first, edge.second));
+		SpanningForest<Weight> forest;
+		for(size_t thread = 0; thread < threads; ++thread) {
+			forest.edges.insert(
+			        forest.edges.end(), treeEdges[thread].begin(), treeEdges[thread].end());
+			forest.totalWeight += treeWeights[thread];
+		}
+		return forest;
+	}
+
+	/*! \brief Find a shortest path between two vertices with the A* algorithm.
+	 *
+	 * The vertices to explore are kept in the IndexedHeap of the scratch space, with the sum of
+	 * their distance from the start and of their heuristic as key, and the search stops as soon
+	 * as the goal leaves the heap. The scores are kept in the scratch space rather than in the
+	 * properties of the nodes, so the graph is not modified and the scratch space can be reused
+	 * by the next search.
+	 *
+	 * \param g The graph in which to search, with a `weight` in its edge property. The weights
+	 *          must not be negative.
+	 * \param startId The id of the start of the path.
+	 * \param goalId The id of the end of the path.
+	 * \param heuristic A function giving a lower bound of the distance from a vertex to the
+	 *                  goal, of type Distance(NodeRef). The path is a shortest one as long as
+	 *                  the bound is never greater than the real distance.
+	 * \param scratch The scratch space of the search, which holds the distances and the parents
+	 *                of the reached vertices after the search.
+	 * \return The path found, which is empty if the goal cannot be reached.
+	 */
+	template <typename Graph, typename Heuristic, typename Distance>
+	ShortestPath<Distance> astar(Graph const& g,
+	                             size_t startId,
+	                             size_t goalId,
+	                             Heuristic&& heuristic,
+	                             SearchScratch<Distance>& scratch) {
+		using NodeRef = typename Graph::NodeRef_t;
+
+		scratch.reset(g.getIdBound());
+		auto& openVertices = scratch.getHeap();
+
+		scratch.reach(startId, Distance(), startId);
+		openVertices.push(startId, heuristic(NodeRef(g, startId)));
+		while(!openVertices.empty()) {
+			size_t nodeId = openVertices.pop();
+			if(nodeId == goalId) {
+				return scratch.pathTo(goalId);
+			}
+
+			// A vertex can be explored again if a shorter path to it is found later, which only
+			// happens when the heuristic is not consistent.
+			Distance distance = scratch.getDistance(nodeId);
+			g.eachAdjacentEdges(NodeRef(g, nodeId), [&](NodeRef end, auto const& property) {
+				size_t endId       = end.getId();
+				Distance tentative = distance + property.weight;
+				if(!scratch.isReached(endId) || tentative < scratch.getDistance(endId)) {
+					scratch.reach(endId, tentative, nodeId);
+					openVertices.pushOrDecrease(endId, tentative + heuristic(end));
+				}
+			});
+		}
+
+		return ShortestPath<Distance>();
+	}
+
+	/*! \brief Find a shortest path between two vertices with the A* algorithm.
+	 *
+	 * \param g The graph in which to search, with a `weight` in its edge property.
+	 * \param startId The id of the start of the path.
+	 * \param goalId The id of the end of the path.
+	 * \param heuristic A function giving a lower bound of the distance from a vertex to the
+	 *                  goal, of type Distance(NodeRef).
+	 * \return The path found, which is empty if the goal cannot be reached.
+	 * \sa astar(Graph const&, size_t, size_t, Heuristic&&, SearchScratch<Distance>&)
+	 */
+	template <typename Graph, typename Heuristic>
+	auto astar(Graph const& g, size_t startId, size_t goalId, Heuristic&& heuristic) {
+		using Weight = std::decay_t<decltype(g.getEdgeProperty(startId, goalId).weight)>;
+
+		SearchScratch<Weight> scratch;
+		return astar(g, startId, goalId, std::forward<Heuristic>(heuristic), scratch);
+	}
+
+	/*! \brief Get the shortest paths from a vertex to every vertex of a graph with the Dijkstra
+	 *         algorithm.
+	 *
+	 * When the weights are integers, the vertices to explore are kept in a RadixHeap, which
+	 * takes advantage of the distances only growing during the search, and a vertex is pushed
+	 * again when its distance decreases. Otherwise, they are kept in an IndexedHeap.
+	 *
+	 * \param g The graph in which to search, with a `weight` in its edge property. The weights
+	 *          must not be negative.
+	 * \param sourceId The id of the start of the paths.
+	 * \return The distance from the source and the parent of each id.
+	 */
+	template <typename Graph>
+	auto dijkstra(Graph const& g, size_t sourceId) {
+		using NodeRef  = typename Graph::NodeRef_t;
+		using Distance = std::decay_t<decltype(g.getEdgeProperty(sourceId, sourceId).weight)>;
+		using Tree     = ShortestPathTree<Distance>;
+
+		size_t idBound = g.getIdBound();
+		Tree tree;
+		tree.distances.assign(idBound, Tree::unreached);
+		tree.parents.assign(idBound, Tree::npos);
+		tree.distances[sourceId] = Distance();
+		tree.parents[sourceId]   = sourceId;
+
+		// Update the distance of the adjacents of a vertex, and call push on the improved ones.
+		auto relaxEdges = [&g, &tree](size_t nodeId, auto&& push) {
+			Distance distance = tree.distances[nodeId];
+			g.eachAdjacentEdges(NodeRef(g, nodeId), [&](NodeRef end, auto const& property) {
+				size_t endId     = end.getId();
+				Distance through = distance + property.weight;
+				if(through < tree.distances[endId]) {
+					tree.distances[endId] = through;
+					tree.parents[endId]   = nodeId;
+					push(endId, through);
+				}
+			});
+		};
+
+		if constexpr(std::is_integral<Distance>::value) {
+			using Key = std::make_unsigned_t<Distance>;
+
+			RadixHeap<Key, size_t> heap;
+			auto push = [&heap](size_t nodeId, Distance distance) {
+				heap.push(static_cast<Key>(distance), nodeId);
+			};
+
+			push(sourceId, Distance());
+			while(!heap.empty()) {
+				auto [key, nodeId] = heap.pop();
+				// The vertex was pushed again with a lower distance and is already explored.
+				if(static_cast<Distance>(key) == tree.distances[nodeId]) {
+					relaxEdges(nodeId, push);
+				}
+			}
+		} else {
+			IndexedHeap<Distance> heap(idBound);
+			auto push = [&heap](size_t nodeId, Distance distance) {
+				heap.pushOrDecrease(nodeId, distance);
+			};
+
+			push(sourceId, Distance());
+			while(!heap.empty()) {
+				relaxEdges(heap.pop(), push);
+			}
+		}
+
+		return tree;
+	}
+
+	/*! \brief Get the shortest paths from a vertex to every vertex of a graph with the
+	 *         delta-stepping algorithm, from several threads.
+	 *
+	 * The vertices to explore are kept in buckets of distances of width delta. The vertices of
+	 * the lowest bucket form a frontier whose light edges (not heavier than delta) are relaxed
+	 * in parallel until the bucket stays empty, then the heavy edges of every vertex removed
+	 * from the bucket are relaxed in parallel. The distance and the parent of each vertex are
+	 * packed in a single atomic word, so a relaxation is a single compare-and-swap.
+	 *
+	 * A small delta does less useless work but gives smaller frontiers, a delta around the
+	 * average weight of the edges is a good start. With a delta of 1 on unit weights this is a
+	 * parallel breadth-first search, and with a huge delta a parallel Bellman-Ford.
+	 *
+	 * \param g The graph in which to search, with an integer `weight` of at most 32 bits in its
+	 *          edge property. The weights must not be negative.
+	 * \param sourceId The id of the start of the paths.
+	 * \param delta The width of the buckets, which must be positive.
+	 * \param threads The number of threads to use, or 0 to use one thread per hardware thread.
+	 * \return The distance from the source and the parent of each id.
+	 */
+	template <typename Graph, typename Distance>
+	auto deltaStepping(Graph const& g, size_t sourceId, Distance delta, size_t threads) {
+		using NodeRef = typename Graph::NodeRef_t;
+		using Weight  = std::decay_t<decltype(g.getEdgeProperty(sourceId, sourceId).weight)>;
+		using Tree    = ShortestPathTree<Weight>;
+
+		static_assert(std::is_integral<Weight>::value && sizeof(Weight) <= sizeof(std::uint32_t),
+		              "The weights must be integers of at most 32 bits");
+
+		if(!(delta > 0)) {
+			throw std::invalid_argument("The width of the buckets must be positive.");
+		}
+
+		// The distance is in the high half of a state and the parent in the low half, so that
+		// states are ordered by distance.
+		std::uint64_t const unreachedState = static_cast<std::uint64_t>(-1);
+		auto pack = [](Weight distance, size_t parent) {
+			return (static_cast<std::uint64_t>(distance) << 32) |
+			       static_cast<std::uint32_t>(parent);
+		};
+		auto distanceOf = [](std::uint64_t state) {
+			return static_cast<std::uint32_t>(state >> 32);
+		};
+
+		size_t const blockSize = 256;
+		size_t const none      = static_cast<size_t>(-1);
+
+		threads        = threadsCount(threads);
+		size_t idBound = g.getIdBound();
+		auto width     = static_cast<std::uint32_t>(delta);
+
+		std::vector<std::atomic<std::uint64_t>> states(idBound);
+		for(auto& state : states) {
+			state.store(unreachedState, std::memory_order_relaxed);
+		}
+		states[sourceId].store(pack(Weight(), sourceId), std::memory_order_relaxed);
+
+		// The vertices whose distance was decreased by each thread.
+		std::vector<std::vector<std::uint32_t>> improved(threads);
+		auto relaxEdges = [&g, &states, &improved, width, pack, distanceOf](
+		                          std::uint32_t nodeId, bool light, size_t thread) {
+			std::uint32_t distance = distanceOf(states[nodeId].load(std::memory_order_relaxed));
+			g.eachAdjacentEdges(NodeRef(g, nodeId), [&](NodeRef end, auto const& property) {
+				auto weight = static_cast<std::uint32_t>(property.weight);
+				if((weight <= width) != light) {
+					return;
+				}
+
+				auto& state           = states[end.getId()];
+				std::uint64_t through = pack(static_cast<Weight>(distance + weight), nodeId);
+				std::uint64_t current = state.load(std::memory_order_relaxed);
+				while(distanceOf(through) < distanceOf(current)) {
+					if(state.compare_exchange_weak(current, through, std::memory_order_relaxed)) {
+						improved[thread].push_back(static_cast<std::uint32_t>(end.getId()));
+						return;
+					}
+				}
+			});
+		};
+
+		std::map<size_t, std::vector<std::uint32_t>> buckets;
+		std::vector<size_t> queuedIn(idBound, none), removedFrom(idBound, none);
+
+		// Move the improved vertices to the bucket of their new distance.
+		auto queueImproved = [&]() {
+			for(auto& ids : improved) {
+				for(std::uint32_t id : ids) {
+					size_t bucket =
+					        distanceOf(states[id].load(std::memory_order_relaxed)) / width;
+					if(queuedIn[id] != bucket) {
+						queuedIn[id] = bucket;
+						buckets[bucket].push_back(id);
+					}
+				}
+				ids.clear();
+			}
+		};
+
+		// The vertices of the current bucket, and every vertex removed from it.
+		std::vector<std::uint32_t> frontier, removed;
+		auto relaxLightEdges = [&frontier, &relaxEdges](size_t first, size_t last, size_t thread) {
+			for(size_t i = first; i < last; ++i) {
+				relaxEdges(frontier[i], true, thread);
+			}
+		};
+		auto relaxHeavyEdges = [&removed, &relaxEdges](size_t first, size_t last, size_t thread) {
+			for(size_t i = first; i < last; ++i) {
+				relaxEdges(removed[i], false, thread);
+			}
+		};
+
+		buckets[0].push_back(static_cast<std::uint32_t>(sourceId));
+		queuedIn[sourceId] = 0;
+		while(!buckets.empty()) {
+			size_t bucket = buckets.begin()->first;
+
+			removed.clear();
+			while(!buckets[bucket].empty()) {
+				frontier.clear();
+				for(std::uint32_t id : buckets[bucket]) {
+					queuedIn[id] = none;
+					if(distanceOf(states[id].load(std::memory_order_relaxed)) / width == bucket) {
+						frontier.push_back(id);
+						if(removedFrom[id] != bucket) {
+							removedFrom[id] = bucket;
+							removed.push_back(id);
+						}
+					}
+				}
+				buckets[bucket].clear();
+
+				parallelFor(0, frontier.size(), threads, blockSize, relaxLightEdges);
+				queueImproved();
+			}
+			buckets.erase(bucket);
+
+			parallelFor(0, removed.size(), threads, blockSize, relaxHeavyEdges);
+			queueImproved();
+		}
+
+		Tree tree;
+		tree.distances.assign(idBound, Tree::unreached);
+		tree.parents.assign(idBound, Tree::npos);
+		for(size_t id = 0; id < idBound; ++id) {
+			std::uint64_t state = states[id].load(std::memory_order_relaxed);
+			if(state != unreachedState) {
+				tree.distances[id] = static_cast<Weight>(distanceOf(state));
+				tree.parents[id]   = static_cast<std::uint32_t>(state);
+			}
+		}
+		return tree;
+	}
+
+	/*! \brief Get the number of edges on the shortest paths from a vertex to every vertex of a
+	 *         graph, with a direction-optimizing breadth-first search.
+	 *
+	 * Each level of the search is explored either top-down, by looking at the adjacents of the
+	 * vertices of the frontier, or bottom-up, by looking for a predecessor in the frontier for
+	 * each vertex not reached yet, which stops at the first one found. Bottom-up steps need the
+	 * reverse index of the graph, see Graph::setReverseIndex(), and are only used when it is
+	 * enabled.
+	 *
+	 * The search switches to bottom-up steps when the frontier is larger than a fraction of
+	 * the vertices not reached yet, and back to top-down steps when it gets smaller than a
+	 * fraction of the vertices. These are the thresholds of Beamer et al. on the numbers of
+	 * edges, with the numbers of edges estimated from the numbers of vertices.
+	 *
+	 * \param g The graph in which to search.
+	 * \param sourceId The id of the start of the paths.
+	 * \return The level and the parent of each id.
+	 */
+	template <typename Graph>
+	ShortestPathTree<std::uint32_t> bfs(Graph const& g, size_t sourceId) {
+		using Tree = ShortestPathTree<std::uint32_t>;
+
+		size_t const topDownToBottomUp = 14, bottomUpToTopDown = 24;
+
+		size_t idBound = g.getIdBound();
+		Tree tree;
+		tree.distances.assign(idBound, Tree::unreached);
+		tree.parents.assign(idBound, Tree::npos);
+		tree.distances[sourceId] = 0;
+		tree.parents[sourceId]   = sourceId;
+
+		// The frontier is a list of ids in top-down steps, and a bitmap in bottom-up steps.
+		std::vector<size_t> frontier{sourceId}, next;
+		std::vector<bits::Word> frontierBits, nextBits;
+		size_t wordsCount = bits::wordsFor(idBound);
+		auto isInFrontier = [&frontierBits](size_t id) {
+			return (frontierBits[id / bits::wordBits] >> (id % bits::wordBits)) & 1;
+		};
+
+		size_t verticesCount = g.getVerticesCount(), unreachedCount = verticesCount - 1;
+		size_t frontierSize = 1;
+		bool bottomUp = false;
+		for(std::uint32_t level = 1; frontierSize > 0; ++level) {
+			if(g.hasReverseIndex()) {
+				if(!bottomUp && frontierSize * topDownToBottomUp > unreachedCount) {
+					bottomUp = true;
+					frontierBits.assign(wordsCount, bits::Word(0));
+					for(size_t id : frontier) {
+						frontierBits[id / bits::wordBits] |= bits::Word(1) << (id % bits::wordBits);
+					}
+				} else if(bottomUp && frontierSize * bottomUpToTopDown < verticesCount) {
+					bottomUp = false;
+					bits::Word const* words = frontierBits.data();
+					frontier.assign(bits::SetBitIterator(words, 0, wordsCount),
+					                bits::SetBitIterator(words, wordsCount, wordsCount));
+				}
+			}
+
+			size_t reachedCount = 0;
+			if(bottomUp) {
+				nextBits.assign(wordsCount, bits::Word(0));
+				for(auto vertex : g.vertices()) {
+					size_t id = vertex.getId();
+					if(tree.parents[id] != Tree::npos) {
+						continue;
+					}
+					for(auto predecessor : g.predecessors(id)) {
+						if(isInFrontier(predecessor.getId())) {
+							tree.distances[id] = level;
+							tree.parents[id]   = predecessor.getId();
+							nextBits[id / bits::wordBits] |= bits::Word(1) << (id % bits::wordBits);
+							++reachedCount;
+							break;
+						}
+					}
+				}
+				frontierBits.swap(nextBits);
+			} else {
+				next.clear();
+				for(size_t id : frontier) {
+					for(auto adjacent : g.adjacents(id)) {
+						size_t adjacentId = adjacent.getId();
+						if(tree.parents[adjacentId] == Tree::npos) {
+							tree.distances[adjacentId] = level;
+							tree.parents[adjacentId]   = id;
+							next.push_back(adjacentId);
+						}
+					}
+				}
+				frontier.swap(next);
+				reachedCount = frontier.size();
+			}
+
+			unreachedCount -= reachedCount;
+			frontierSize = reachedCount;
+		}
+
+		return tree;
+	}
+
+	/*! \brief Run breadth-first searches from many sources at once, with a bit for each source.
+	 *
+	 * Each vertex has a row of bits, one per source, for the sources which have reached it, and
+	 * another for the sources which reach it at the current level. A level is explored by
+	 * or-ing the row of each vertex of the frontier into the rows of its adjacents, so each edge
+	 * is followed once per level for all the sources instead of once per source, with the rows
+	 * combined by the SIMD operations of bits::orWords() and bits::andNotWords().
+	 *
+	 * The three rows take 3 * getIdBound() * sourceIds.size() bits: large sets of sources should
+	 * be split in batches of a few hundred sources.
+	 *
+	 * The functor must be convertible to a function of type void(size_t, std::uint32_t,
+	 * bits::Word const*). It is called for each vertex at each level where new sources reach
+	 * it, with the id of the vertex, the level, and the bits of the sources which reach it at
+	 * this level.
+	 *
+	 * \param g The graph in which to search.
+	 * \param sourceIds The ids of the sources, the bit `i` being for `sourceIds[i]`.
+	 * \param f The function to call.
+	 * \return A matrix with a row for each id and a column for each source, where a bit is set
+	 *         if the vertex can be reached from the source.
+	 */
+	template <typename Graph, typename Functor>
+	BitMatrix multiSourceBfs(Graph const& g, std::vector<size_t> const& sourceIds, Functor&& f) {
+		static_assert(std::is_convertible<Functor,
+		                                  std::function<void(size_t, std::uint32_t,
+		                                                     bits::Word const*)>>::value,
+		              "The function must be convertible to a function of type void(size_t, "
+		              "std::uint32_t, bits::Word const*)");
+
+		size_t idBound    = g.getIdBound();
+		size_t wordsCount = bits::wordsFor(sourceIds.size());
+		BitMatrix seen(idBound, sourceIds.size());
+		BitMatrix visit(seen), visitNext(seen);
+
+		std::vector<size_t> frontier, candidates;
+		for(size_t i = 0; i < sourceIds.size(); ++i) {
+			size_t id = sourceIds[i];
+			if(visit.count(id) == 0) {
+				frontier.push_back(id);
+			}
+			seen.set(id, i);
+			visit.set(id, i);
+		}
+		for(size_t id : frontier) {
+			f(id, std::uint32_t(0), visit.row(id));
+		}
+
+		std::vector<bool> isCandidate(idBound, false);
+		for(std::uint32_t level = 1; !frontier.empty(); ++level) {
+			candidates.clear();
+			for(size_t id : frontier) {
+				bits::Word const* sources = visit.row(id);
+				for(auto adjacent : g.adjacents(id)) {
+					size_t adjacentId = adjacent.getId();
+					if(!isCandidate[adjacentId]) {
+						isCandidate[adjacentId] = true;
+						candidates.push_back(adjacentId);
+					}
+					bits::orWords(visitNext.row(adjacentId), sources, wordsCount);
+				}
+				visit.resetRow(id);
+			}
+
+			// Only the sources which had not reached a candidate yet are kept in its row.
+			frontier.clear();
+			for(size_t id : candidates) {
+				isCandidate[id] = false;
+
+				bits::Word* next = visitNext.row(id);
+				bits::andNotWords(next, seen.row(id), wordsCount);
+				if(bits::popcount(next, wordsCount) != 0) {
+					bits::orWords(seen.row(id), next, wordsCount);
+					f(id, level, next);
+					frontier.push_back(id);
+				}
+			}
+
+			std::swap(visit, visitNext);
+		}
+
+		return seen;
+	}
+
+	/*! \brief Find the vertices which can be reached from each of many sources.
+	 *
+	 * See multiSourceBfs(Graph const&, std::vector<size_t> const&, Functor&&).
+	 *
+	 * \param g The graph in which to search.
+	 * \param sourceIds The ids of the sources, the bit `i` being for `sourceIds[i]`.
+	 * \return A matrix with a row for each id and a column for each source, where a bit is set
+	 *         if the vertex can be reached from the source.
+	 */
+	template <typename Graph>
+	BitMatrix multiSourceBfs(Graph const& g, std::vector<size_t> const& sourceIds) {
+		return multiSourceBfs(g, sourceIds, [](size_t, std::uint32_t, bits::Word const*) {});
+	}
+
+	/*! \brief Shorten the paths from a vertex to a range of vertices with the paths going through
+	 *         another vertex, the min-plus step of floydWarshall().
+	 *
+	 * The loop has no branch and the rows cannot overlap, so that the compiler turns it into
+	 * SIMD instructions.
+	 *
+	 * \param distances The distances from the vertex to the range.
+	 * \param hops The next hops from the vertex to the range.
+	 * \param throughDistances The distances from the other vertex to the range.
+	 * \param toThrough The distance from the vertex to the other vertex.
+	 * \param throughHop The next hop from the vertex to the other vertex.
+	 * \param count The number of vertices of the range.
+	 */
+	template <typename Distance>
+	void relaxThrough(Distance* __restrict distances,
+	                  std::uint32_t* __restrict hops,
+	                  Distance const* __restrict throughDistances,
+	                  Distance toThrough,
+	                  std::uint32_t throughHop,
+	                  size_t count) {
+		for(size_t j = 0; j < count; ++j) {
+			Distance through = toThrough + throughDistances[j];
+			bool shorter     = through < distances[j];
+			distances[j]     = shorter ? through : distances[j];
+			hops[j]          = shorter ? throughHop : hops[j];
+		}
+	}
+
+	/*! \brief Get the shortest paths between every pair of vertices of a graph with a blocked
+	 *         Floyd-Warshall algorithm.
+	 *
+	 * The distance matrix is split in square tiles of AllPairsShortestPaths::blockSize, which
+	 * stay in the cache while they are updated. For each tile of the diagonal, the tile itself
+	 * is updated first, then the tiles of its row and of its column, then every other tile,
+	 * the tiles of the last two steps being shared between the threads.
+	 *
+	 * Each update of a tile is a min-plus product of two tiles, made of calls to
+	 * relaxThrough().
+	 *
+	 * This takes a time cubic and a memory quadratic in getIdBound(), it is meant for dense
+	 * graphs such as matrix::Graph.
+	 *
+	 * \param g The graph, with a `weight` in its edge property. The weights must not be
+	 *          negative, and the lengths of the paths must be lower than
+	 *          AllPairsShortestPaths::unreached.
+	 * \param threads The number of threads, 0 to use one per hardware thread.
+	 * \return The distance and the next hop between each pair of ids. The ids which are not
+	 *         used by a vertex are not reached, not even from themselves.
+	 */
+	template <typename Graph>
+	auto floydWarshall(Graph const& g, size_t threads = 1) {
+		using NodeRef  = typename Graph::NodeRef_t;
+		using Distance = std::decay_t<decltype(g.getEdgeProperty(0, 0).weight)>;
+		using Paths    = AllPairsShortestPaths<Distance>;
+
+		// The ids which are not used stay unreached, even from themselves.
+		Paths paths(g.getIdBound());
+		for(auto vertex : g.vertices()) {
+			size_t beginId = vertex.getId();
+			paths.reachItself(beginId);
+			g.eachAdjacentEdges(vertex, [&paths, beginId](NodeRef end, auto const& property) {
+				size_t position = beginId * paths.stride + end.getId();
+				if(property.weight < paths.distances[position]) {
+					paths.distances[position] = property.weight;
+					paths.nextHops[position]  = static_cast<std::uint32_t>(end.getId());
+				}
+			});
+		}
+
+		// Update the tile (row, column) with the paths going through the vertices of the tile
+		// (pivot, pivot), which may be the tile itself.
+		size_t const blockSize = Paths::blockSize;
+		size_t const stride    = paths.stride;
+		Distance* distances    = paths.distances.data();
+		std::uint32_t* hops    = paths.nextHops.data();
+		auto relaxTile = [=](size_t row, size_t column, size_t pivot) {
+			for(size_t k = pivot * blockSize; k < (pivot + 1) * blockSize; ++k) {
+				Distance const* throughRow = distances + k * stride + column * blockSize;
+				for(size_t i = row * blockSize; i < (row + 1) * blockSize; ++i) {
+					// The row of the pivot itself cannot be shortened by the pivot.
+					Distance toPivot = distances[i * stride + k];
+					if(i == k || !(toPivot < Paths::unreached)) {
+						continue;
+					}
+					relaxThrough(distances + i * stride + column * blockSize,
+					             hops + i * stride + column * blockSize, throughRow, toPivot,
+					             hops[i * stride + k], blockSize);
+				}
+			}
+		};
+
+		size_t blocksCount = stride / blockSize;
+		for(size_t pivot = 0; pivot < blocksCount; ++pivot) {
+			relaxTile(pivot, pivot, pivot);
+
+			auto relaxCross = [&relaxTile, pivot](size_t first, size_t last, size_t) {
+				for(size_t block = first; block < last; ++block) {
+					if(block != pivot) {
+						relaxTile(pivot, block, pivot);
+						relaxTile(block, pivot, pivot);
+					}
+				}
+			};
+			parallelFor(0, blocksCount, threads, 1, relaxCross);
+
+			auto relaxOthers = [&relaxTile, pivot, blocksCount](size_t first, size_t last, size_t) {
+				for(size_t row = first; row < last; ++row) {
+					if(row == pivot) {
+						continue;
+					}
+					for(size_t column = 0; column < blocksCount; ++column) {
+						if(column != pivot) {
+							relaxTile(row, column, pivot);
+						}
+					}
+				}
+			};
+			parallelFor(0, blocksCount, threads, 1, relaxOthers);
+		}
+
+		return paths;
+	}
+
+	/*! \brief Get the PageRank of each vertex of a graph, from several threads.
+	 *
+	 * The ranks are computed by power iteration, pulling the rank of each vertex from its
+	 * predecessors: each thread only writes the ranks of its own vertices, so no lock nor
+	 * atomic operation is needed. The vertices are split into as many ranges of consecutive ids
+	 * as threads, balanced by their number of incoming edges. The contributions of the vertices
+	 * (their rank divided by their number of outgoing edges) are kept in two arrays, one read
+	 * and the other written during an iteration.
+	 *
+	 * The rank of the vertices without outgoing edges is spread over every vertex. The
+	 * iterations stop when the sum of the changes of the ranks is lower than the tolerance.
+	 *
+	 * \param g The graph.
+	 * \param damping The probability to follow an edge rather than to jump to any vertex.
+	 * \param tolerance The sum of the changes of the ranks below which the ranks are returned.
+	 * \param maxIterations The greatest number of iterations.
+	 * \param threads The number of threads, 0 to use one per hardware thread.
+	 * \return The rank of each id, 0 for the ids which are not used. The ranks sum to 1.
+	 * \sa PredecessorIndex
+	 */
+	template <typename Graph>
+	std::vector<double> pageRank(Graph const& g,
+	                             double damping       = 0.85,
+	                             double tolerance     = 1e-9,
+	                             size_t maxIterations = 100,
+	                             size_t threads       = 1) {
+		using NodeRef = typename Graph::NodeRef_t;
+
+		PredecessorIndex<Graph> predecessors(g);
+
+		size_t idBound       = g.getIdBound();
+		size_t verticesCount = g.getVerticesCount();
+		std::vector<double> ranks(idBound, 0.);
+		if(verticesCount == 0) {
+			return ranks;
+		}
+
+		std::vector<bool> used(idBound, false);
+		std::vector<size_t> degrees(idBound, 0), inDegrees(idBound, 0);
+		for(auto vertex : g.vertices()) {
+			size_t id = vertex.getId();
+			used[id]  = true;
+			for(auto adjacent : g.adjacents(id)) {
+				++degrees[id];
+				++inDegrees[adjacent.getId()];
+			}
+		}
+
+		// The initial ranks are uniform, the ids which are not used have no contribution.
+		std::vector<double> contributions(idBound, 0.), nextContributions(idBound, 0.);
+		double danglingRank = 0.;
+		for(size_t id = 0; id < idBound; ++id) {
+			if(!used[id]) {
+				continue;
+			}
+			ranks[id] = 1. / static_cast<double>(verticesCount);
+			if(degrees[id] == 0) {
+				danglingRank += ranks[id];
+			} else {
+				contributions[id] = ranks[id] / static_cast<double>(degrees[id]);
+			}
+		}
+
+		size_t partsCount = threadsCount(threads);
+		std::vector<size_t> bounds =
+		        balancedBounds(0, idBound, partsCount, [&inDegrees](size_t id) {
+			        return inDegrees[id] + 1;
+		        });
+		std::vector<double> partDangling(partsCount), partChanges(partsCount);
+		for(size_t iteration = 0; iteration < maxIterations; ++iteration) {
+			double base = (1. - damping + damping * danglingRank) /
+			              static_cast<double>(verticesCount);
+			auto pullRanks = [&](size_t firstPart, size_t lastPart, size_t) {
+				for(size_t part = firstPart; part < lastPart; ++part) {
+					double dangling = 0., changes = 0.;
+					for(size_t id = bounds[part]; id < bounds[part + 1]; ++id) {
+						if(!used[id]) {
+							continue;
+						}
+						double sum = 0.;
+						predecessors.eachPredecessors(NodeRef(g, id), [&](NodeRef predecessor) {
+							sum += contributions[predecessor.getId()];
+						});
+
+						double rank = base + damping * sum;
+						changes += std::abs(rank - ranks[id]);
+						ranks[id] = rank;
+						if(degrees[id] == 0) {
+							dangling += rank;
+						} else {
+							nextContributions[id] = rank / static_cast<double>(degrees[id]);
+						}
+					}
+					partDangling[part] = dangling;
+					partChanges[part]  = changes;
+				}
+			};
+			parallelFor(0, partsCount, partsCount, 1, pullRanks);
+
+			contributions.swap(nextContributions);
+			danglingRank   = 0.;
+			double changes = 0.;
+			for(size_t part = 0; part < partsCount; ++part) {
+				danglingRank += partDangling[part];
+				changes      += partChanges[part];
+			}
+			if(changes < tolerance) {
+				break;
+			}
+		}
+
+		return ranks;
+	}
+
+	/*! \brief Check if a graph type gives its packed adjacency matrix with getMatrix(), as
+	 *         matrix::Graph does.
+	 */
+	template <typename Graph, typename = void>
+	struct HasPackedMatrix : std::false_type {};
+
+	/*! \brief Check if a graph type gives its packed adjacency matrix with getMatrix(), as
+	 *         matrix::Graph does.
+	 */
+	template <typename Graph>
+	struct HasPackedMatrix<Graph, std::void_t<decltype(std::declval<Graph const&>().getMatrix())>>
+	      : std::true_type {};
+
+	/*! \brief The neighbours of the vertices of a graph, ignoring the direction of the edges,
+	 *         oriented from the lower to the higher degrees.
+	 *
+	 * Each edge is only kept at the end of lower degree, the ties being broken by the ids, so
+	 * that every triangle is found once from its lowest vertex and no vertex has more than
+	 * `sqrt(2 * edges)` oriented neighbours.
+	 */
+	struct OrientedNeighbours {
+		/*! \brief Get the first oriented neighbour of a vertex.
+		 *
+		 * \param id The id of the vertex.
+		 */
+		std::uint32_t const* begin(size_t id) const {
+			return ids.data() + offsets[id];
+		}
+
+		/*! \brief Get one past the last oriented neighbour of a vertex.
+		 *
+		 * \param id The id of the vertex.
+		 */
+		std::uint32_t const* end(size_t id) const {
+			return ids.data() + offsets[id + 1];
+		}
+
+		/*! \brief The number of neighbours of each id, self-loops and parallel edges excluded.
+		 */
+		std::vector<size_t> degrees;
+
+		/*! \brief The position of the first oriented neighbour of each id, and the number of
+		 *         oriented neighbours.
+		 */
+		std::vector<size_t> offsets;
+
+		/*! \brief The oriented neighbours, grouped by vertex and sorted by id.
+		 */
+		std::vector<std::uint32_t> ids;
+	};
+
+	/*! \brief Build the oriented neighbours of a graph.
+	 *
+	 * \param g The graph, whose ids must fit in 32 bits.
+	 * \param threads The number of threads, 0 to use one per hardware thread.
+	 */
+	template <typename Graph>
+	OrientedNeighbours orientByDegree(Graph const& g, size_t threads = 1) {
+		size_t idBound = g.getIdBound();
+
+		// Gather the successors and the predecessors of each vertex.
+		std::vector<size_t> offsets(idBound + 1, 0);
+		for(auto [begin, end] : g.edges()) {
+			if(begin.getId() != end.getId()) {
+				++offsets[begin.getId() + 1];
+				++offsets[end.getId() + 1];
+			}
+		}
+		for(size_t id = 0; id < idBound; ++id) {
+			offsets[id + 1] += offsets[id];
+		}
+		std::vector<std::uint32_t> neighbours(offsets[idBound]);
+		std::vector<size_t> positions(offsets.begin(), offsets.end() - 1);
+		for(auto [begin, end] : g.edges()) {
+			size_t beginId = begin.getId(), endId = end.getId();
+			if(beginId != endId) {
+				neighbours[positions[beginId]++] = static_cast<std::uint32_t>(endId);
+				neighbours[positions[endId]++]   = static_cast<std::uint32_t>(beginId);
+			}
+		}
+
+		// Two edges in opposite directions are the same neighbour.
+		OrientedNeighbours oriented;
+		oriented.degrees.resize(idBound);
+		parallelFor(0, idBound, threads, 256, [&](size_t first, size_t last, size_t) {
+			for(size_t id = first; id < last; ++id) {
+				auto begin = neighbours.begin() + static_cast<std::ptrdiff_t>(offsets[id]);
+				auto end   = neighbours.begin() + static_cast<std::ptrdiff_t>(offsets[id + 1]);
+				std::sort(begin, end);
+				oriented.degrees[id] = static_cast<size_t>(std::unique(begin, end) - begin);
+			}
+		});
+
+		auto isLower = [&oriented](size_t first, size_t second) {
+			size_t firstDegree = oriented.degrees[first], secondDegree = oriented.degrees[second];
+			return firstDegree < secondDegree || (firstDegree == secondDegree && first < second);
+		};
+		oriented.offsets.resize(idBound + 1, 0);
+		for(size_t id = 0; id < idBound; ++id) {
+			size_t higher = 0;
+			for(size_t i = offsets[id]; i < offsets[id] + oriented.degrees[id]; ++i) {
+				higher += isLower(id, neighbours[i]) ? 1 : 0;
+			}
+			oriented.offsets[id + 1] = oriented.offsets[id] + higher;
+		}
+		oriented.ids.reserve(oriented.offsets[idBound]);
+		for(size_t id = 0; id < idBound; ++id) {
+			for(size_t i = offsets[id]; i < offsets[id] + oriented.degrees[id]; ++i) {
+				if(isLower(id, neighbours[i])) {
+					oriented.ids.push_back(neighbours[i]);
+				}
+			}
+		}
+		return oriented;
+	}
+
+	/*! \brief Call a given function for each id in two sorted arrays of ids.
+	 *
+	 * The arrays are merged when their sizes are close. Otherwise, each id of the smaller one
+	 * is looked for in the larger one with a galloping search, which takes a time logarithmic
+	 * in the distance to the previous id found.
+	 *
+	 * \param first The first array.
+	 * \param firstEnd One past the end of the first array.
+	 * \param second The second array.
+	 * \param secondEnd One past the end of the second array.
+	 * \param functor The function to call, of type void(std::uint32_t).
+	 */
+	template <typename Functor>
+	void eachCommonIds(std::uint32_t const* first,
+	                   std::uint32_t const* firstEnd,
+	                   std::uint32_t const* second,
+	                   std::uint32_t const* secondEnd,
+	                   Functor&& functor) {
+		size_t const gallopRatio = 16;
+
+		if(firstEnd - first > secondEnd - second) {
+			std::swap(first, second);
+			std::swap(firstEnd, secondEnd);
+		}
+
+		if(static_cast<size_t>(firstEnd - first) * gallopRatio <
+		   static_cast<size_t>(secondEnd - second)) {
+			for(; first != firstEnd && second != secondEnd; ++first) {
+				// Double the step until it goes past the id, then search between the last two.
+				size_t remaining = static_cast<size_t>(secondEnd - second);
+				size_t low = 0, step = 1;
+				while(step < remaining && second[step] < *first) {
+					low = step;
+					step *= 2;
+				}
+				second = std::lower_bound(
+				        second + low, second + std::min(step, remaining), *first);
+				if(second != secondEnd && *second == *first) {
+					functor(*first);
+					++second;
+				}
+			}
+			return;
+		}
+
+		while(first != firstEnd && second != secondEnd) {
+			if(*first < *second) {
+				++first;
+			} else if(*second < *first) {
+				++second;
+			} else {
+				functor(*first);
+				++first;
+				++second;
+			}
+		}
+	}
+
+	/*! \brief Count the triangles each vertex of a graph stored as a packed adjacency matrix
+	 *         belongs to, ignoring the direction of the edges.
+	 *
+	 * The neighbours of each vertex are a row of bits, so the common neighbours of two
+	 * vertices are counted with a bitwise and and a population count of their rows.
+	 *
+	 * \param g The graph, which has a getMatrix() function.
+	 * \param degrees Filled with the number of neighbours of each id.
+	 * \param threads The number of threads, 0 to use one per hardware thread.
+	 * \return The number of triangles of each id.
+	 */
+	template <typename Graph>
+	std::vector<size_t> packedTriangleCounts(Graph const& g,
+	                                         std::vector<size_t>& degrees,
+	                                         size_t threads) {
+		BitMatrix const& matrix = g.getMatrix();
+		size_t idBound          = matrix.getRowsCount();
+
+		BitMatrix neighbours(idBound, idBound);
+		for(size_t id = 0; id < idBound; ++id) {
+			matrix.eachSetBits(id, [&neighbours, id](size_t adjacentId) {
+				if(adjacentId != id) {
+					neighbours.set(id, adjacentId);
+					neighbours.set(adjacentId, id);
+				}
+			});
+		}
+
+		size_t wordsCount = neighbours.getWordsPerRow();
+		std::vector<size_t> triangles(idBound, 0);
+		degrees.assign(idBound, 0);
+		parallelFor(0, idBound, threads, 64, [&](size_t first, size_t last, size_t) {
+			for(size_t id = first; id < last; ++id) {
+				bits::Word const* row = neighbours.row(id);
+				size_t common         = 0;
+				neighbours.eachSetBits(id, [&](size_t adjacentId) {
+					common += bits::andPopcount(row, neighbours.row(adjacentId), wordsCount);
+				});
+				// Each triangle is seen from both of the other two vertices.
+				triangles[id] = common / 2;
+				degrees[id]   = neighbours.count(id);
+			}
+		});
+		return triangles;
+	}
+
+	/*! \brief Count the triangles of a graph, ignoring the direction of the edges.
+	 *
+	 * A triangle is a set of three vertices connected two by two, by an edge in either
+	 * direction. Every edge is oriented from its end of lower degree to its end of higher
+	 * degree, and the triangles are found once each by intersecting the sorted oriented
+	 * neighbours of the ends of each edge. With matrix::Graph, the rows of the adjacency
+	 * matrix are intersected instead.
+	 *
+	 * \param g The graph, whose ids must fit in 32 bits.
+	 * \param threads The number of threads, 0 to use one per hardware thread.
+	 * \return The number of triangles.
+	 */
+	template <typename Graph>
+	size_t countTriangles(Graph const& g, size_t threads = 1) {
+		if constexpr(HasPackedMatrix<Graph>::value) {
+			std::vector<size_t> degrees;
+			std::vector<size_t> triangles = packedTriangleCounts(g, degrees, threads);
+			size_t count                  = 0;
+			for(size_t vertexTriangles : triangles) {
+				count += vertexTriangles;
+			}
+			return count / 3;
+		} else {
+			OrientedNeighbours oriented = orientByDegree(g, threads);
+			std::vector<size_t> threadCounts(threadsCount(threads), 0);
+			auto countFrom = [&](size_t first, size_t last, size_t thread) {
+				size_t count = 0;
+				for(size_t id = first; id < last; ++id) {
+					for(auto it = oriented.begin(id); it != oriented.end(id); ++it) {
+						eachCommonIds(oriented.begin(id),
+						              oriented.end(id),
+						              oriented.begin(*it),
+						              oriented.end(*it),
+						              [&count](std::uint32_t) { ++count; });
+					}
+				}
+				threadCounts[thread] += count;
+			};
+			parallelFor(0, g.getIdBound(), threads, 64, countFrom);
+
+			size_t count = 0;
+			for(size_t threadCount : threadCounts) {
+				count += threadCount;
+			}
+			return count;
+		}
+	}
+
+	/*! \brief Compute the local clustering coefficient of each vertex of a graph, ignoring the
+	 *         direction of the edges.
+	 *
+	 * The coefficient of a vertex is the number of edges between its neighbours divided by
+	 * the number of pairs of neighbours, that is the number of its triangles divided by
+	 * `degree * (degree - 1) / 2`. The triangles are found as in countTriangles().
+	 *
+	 * \param g The graph, whose ids must fit in 32 bits.
+	 * \param threads The number of threads, 0 to use one per hardware thread.
+	 * \return The coefficient of each id, 0 for the vertices with less than two neighbours and
+	 *         the ids which are not used.
+	 */
+	template <typename Graph>
+	std::vector<double> clusteringCoefficients(Graph const& g, size_t threads = 1) {
+		size_t idBound = g.getIdBound();
+		std::vector<size_t> degrees, triangles;
+		if constexpr(HasPackedMatrix<Graph>::value) {
+			triangles = packedTriangleCounts(g, degrees, threads);
+		} else {
+			OrientedNeighbours oriented = orientByDegree(g, threads);
+			std::vector<std::atomic<size_t>> counts(idBound);
+			for(auto& count : counts) {
+				count.store(0, std::memory_order_relaxed);
+			}
+
+			parallelFor(0, idBound, threads, 64, [&](size_t first, size_t last, size_t) {
+				for(size_t id = first; id < last; ++id) {
+					size_t count = 0;
+					for(auto it = oriented.begin(id); it != oriented.end(id); ++it) {
+						size_t adjacentCount = 0;
+						eachCommonIds(oriented.begin(id),
+						              oriented.end(id),
+						              oriented.begin(*it),
+						              oriented.end(*it),
+						              [&counts, &adjacentCount](std::uint32_t commonId) {
+							              ++adjacentCount;
+							              counts[commonId].fetch_add(1, std::memory_order_relaxed);
+						              });
+						if(adjacentCount != 0) {
+							count += adjacentCount;
+							counts[*it].fetch_add(adjacentCount, std::memory_order_relaxed);
+						}
+					}
+					counts[id].fetch_add(count, std::memory_order_relaxed);
+				}
+			});
+
+			degrees = std::move(oriented.degrees);
+			triangles.resize(idBound);
+			for(size_t id = 0; id < idBound; ++id) {
+				triangles[id] = counts[id].load(std::memory_order_relaxed);
+			}
+		}
+
+		std::vector<double> coefficients(idBound, 0.);
+		for(size_t id = 0; id < idBound; ++id) {
+			if(degrees[id] >= 2) {
+				double pairs     = static_cast<double>(degrees[id] * (degrees[id] - 1)) / 2.;
+				coefficients[id] = static_cast<double>(triangles[id]) / pairs;
+			}
+		}
+		return coefficients;
+	}
+
+	/*! \brief Sort the vertices of a directed acyclic graph so that every edge goes from a
+	 *         vertex to a later one, with the Kahn algorithm.
+	 *
+	 * The vertices without predecessors come first, in increasing order of ids. Each vertex is
+	 * then added once the number of its edges from vertices not yet added, kept in an array,
+	 * drops to 0.
+	 *
+	 * \param g The graph.
+	 * \return The ids of the vertices, in topological order.
+	 * \exception std::invalid_argument If the graph has a cycle. The message gives the name of
+	 *            a vertex of the cycle.
+	 */
+	template <typename Graph>
+	std::vector<size_t> topologicalOrder(Graph const& g) {
+		size_t idBound = g.getIdBound();
+
+		std::vector<size_t> inDegrees(idBound, 0);
+		for(auto [begin, end] : g.edges()) {
+			++inDegrees[end.getId()];
+		}
+
+		// The order itself is the queue of the vertices to add.
+		std::vector<size_t> order;
+		order.reserve(g.getVerticesCount());
+		for(auto vertex : g.vertices()) {
+			if(inDegrees[vertex.getId()] == 0) {
+				order.push_back(vertex.getId());
+			}
+		}
+		for(size_t i = 0; i < order.size(); ++i) {
+			for(auto adjacent : g.adjacents(order[i])) {
+				if(--inDegrees[adjacent.getId()] == 0) {
+					order.push_back(adjacent.getId());
+				}
+			}
+		}
+
+		if(order.size() != g.getVerticesCount()) {
+			// Every vertex left has an edge from another vertex left, so going up these edges
+			// from any of them ends up going round a cycle.
+			size_t const none = static_cast<size_t>(-1);
+			std::vector<size_t> predecessors(idBound, none);
+			size_t cycleId = none;
+			for(auto [begin, end] : g.edges()) {
+				if(inDegrees[begin.getId()] != 0) {
+					predecessors[end.getId()] = begin.getId();
+					cycleId                   = end.getId();
+				}
+			}
+
+			std::vector<bool> visited(idBound, false);
+			while(!visited[cycleId]) {
+				visited[cycleId] = true;
+				cycleId          = predecessors[cycleId];
+			}
+
+			std::ostringstream errMsg;
+			errMsg << "The graph has a cycle through " << g.getName(cycleId) << ", with id "
+			       << cycleId << ".";
+			throw std::invalid_argument(errMsg.str());
+		}
+		return order;
+	}
+
+	/*! \brief Get the shortest paths from a vertex to every vertex of a directed acyclic graph.
+	 *
+	 * The edges of each vertex are relaxed in topological order, so every vertex has its final
+	 * distance before its edges are relaxed, and the weights may be negative.
+	 *
+	 * \param g The graph in which to search, with a `weight` in its edge property.
+	 * \param sourceId The id of the start of the paths.
+	 * \return The distance from the source and the parent of each id.
+	 * \exception std::invalid_argument If the graph has a cycle, see topologicalOrder().
+	 */
+	template <typename Graph>
+	auto dagShortestPaths(Graph const& g, size_t sourceId) {
+		using Weight  = std::decay_t<decltype(g.getEdgeProperty(sourceId, sourceId).weight)>;
+		using Tree    = ShortestPathTree<Weight>;
+		using NodeRef = typename Graph::NodeRef_t;
+
+		std::vector<size_t> order = topologicalOrder(g);
+
+		Tree tree;
+		tree.distances.assign(g.getIdBound(), Tree::unreached);
+		tree.parents.assign(g.getIdBound(), Tree::npos);
+		tree.distances[sourceId] = Weight();
+		tree.parents[sourceId]   = sourceId;
+
+		// The vertices before the source cannot be reached.
+		auto first = std::find(order.begin(), order.end(), sourceId);
+		for(auto it = first; it != order.end(); ++it) {
+			size_t nodeId = *it;
+			if(!tree.isReached(nodeId)) {
+				continue;
+			}
+			Weight distance = tree.distances[nodeId];
+			g.eachAdjacentEdges(NodeRef(g, nodeId), [&](NodeRef end, auto const& property) {
+				size_t endId   = end.getId();
+				Weight through = distance + property.weight;
+				if(!tree.isReached(endId) || through < tree.distances[endId]) {
+					tree.distances[endId] = through;
+					tree.parents[endId]   = nodeId;
+				}
+			});
+		}
+		return tree;
+	}
+
+	/*! \brief Get the longest path to every vertex of a directed acyclic graph, from any vertex
+	 *         without predecessors.
+	 *
+	 * When the vertices are tasks and an edge means that its end cannot start before its
+	 * beginning is done, with the duration of the beginning as weight, the distance of a
+	 * vertex is its earliest start. The edges are relaxed in topological order.
+	 *
+	 * \param g The graph, with a `weight` in its edge property.
+	 * \return The length of the longest path to each id and the previous vertex on this path,
+	 *         the vertex itself for the vertices without predecessors. The ids which are not
+	 *         used are not reached.
+	 * \exception std::invalid_argument If the graph has a cycle, see topologicalOrder().
+	 * \sa criticalPath()
+	 */
+	template <typename Graph>
+	auto dagLongestPaths(Graph const& g) {
+		using Weight  = std::decay_t<decltype(g.getEdgeProperty(0, 0).weight)>;
+		using Tree    = ShortestPathTree<Weight>;
+		using NodeRef = typename Graph::NodeRef_t;
+
+		std::vector<size_t> order = topologicalOrder(g);
+
+		Tree tree;
+		tree.distances.assign(g.getIdBound(), Tree::unreached);
+		tree.parents.assign(g.getIdBound(), Tree::npos);
+		for(size_t nodeId : order) {
+			// All the predecessors come first, so a vertex not reached yet has none.
+			if(!tree.isReached(nodeId)) {
+				tree.distances[nodeId] = Weight();
+				tree.parents[nodeId]   = nodeId;
+			}
+
+			Weight distance = tree.distances[nodeId];
+			g.eachAdjacentEdges(NodeRef(g, nodeId), [&](NodeRef end, auto const& property) {
+				size_t endId   = end.getId();
+				Weight through = distance + property.weight;
+				if(!tree.isReached(endId) || tree.distances[endId] < through) {
+					tree.distances[endId] = through;
+					tree.parents[endId]   = nodeId;
+				}
+			});
+		}
+		return tree;
+	}
+
+	/*! \brief Get a longest path of a directed acyclic graph, its critical path.
+	 *
+	 * \param g The graph, with a `weight` in its edge property.
+	 * \return The path, which starts at a vertex without predecessors, or an empty path if the
+	 *         graph has no vertices.
+	 * \exception std::invalid_argument If the graph has a cycle, see topologicalOrder().
+	 * \sa dagLongestPaths()
+	 */
+	template <typename Graph>
+	auto criticalPath(Graph const& g) {
+		using Tree = decltype(dagLongestPaths(g));
+
+		Tree tree     = dagLongestPaths(g);
+		size_t lastId = Tree::npos;
+		for(size_t id = 0; id < tree.parents.size(); ++id) {
+			if(tree.isReached(id) &&
+			   (lastId == Tree::npos || tree.distances[lastId] < tree.distances[id])) {
+				lastId = id;
+			}
+		}
+		if(lastId == Tree::npos) {
+			return decltype(tree.pathTo(0))();
 		}
-		return undirected(mst);
+		return tree.pathTo(lastId);
 	}
 }
@@ -0,0 +1,332 @@
+#include "bit_matrix.hpp"
+
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace graph {
+	namespace bits {
+
+		namespace {
+			// The kernels process the words they can with SIMD instructions, and return the
+			// number of words done. The AVX2 ones are compiled for AVX2 whatever the flags of the
+			// library, and are only called when the processor supports it.
+#if defined(__x86_64__) || defined(__i386__)
+			bool hasAvx2() {
+				static bool const supported =
+				        (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+				return supported;
+			}
+
+			__attribute__((target("avx2"))) size_t orWordsAvx2(Word* destination,
+			                                                    Word const* source,
+			                                                    size_t count) {
+				size_t i = 0;
+				for(; i + 4 <= count; i += 4) {
+					__m256i* out = reinterpret_cast<__m256i*>(destination + i);
+					__m256i in   = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(source + i));
+					_mm256_storeu_si256(out, _mm256_or_si256(_mm256_loadu_si256(out), in));
+				}
+				return i;
+			}
+
+			__attribute__((target("avx2"))) size_t andWordsAvx2(Word* destination,
+			                                                     Word const* source,
+			                                                     size_t count) {
+				size_t i = 0;
+				for(; i + 4 <= count; i += 4) {
+					__m256i* out = reinterpret_cast<__m256i*>(destination + i);
+					__m256i in   = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(source + i));
+					_mm256_storeu_si256(out, _mm256_and_si256(_mm256_loadu_si256(out), in));
+				}
+				return i;
+			}
+
+			__attribute__((target("avx2"))) size_t andNotWordsAvx2(Word* destination,
+			                                                        Word const* source,
+			                                                        size_t count) {
+				size_t i = 0;
+				for(; i + 4 <= count; i += 4) {
+					__m256i* out = reinterpret_cast<__m256i*>(destination + i);
+					__m256i in   = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(source + i));
+					// _mm256_andnot_si256(a, b) computes ~a & b
+					_mm256_storeu_si256(out, _mm256_andnot_si256(in, _mm256_loadu_si256(out)));
+				}
+				return i;
+			}
+#else
+			bool hasAvx2() {
+				return false;
+			}
+
+			size_t orWordsAvx2(Word*, Word const*, size_t) {
+				return 0;
+			}
+
+			size_t andWordsAvx2(Word*, Word const*, size_t) {
+				return 0;
+			}
+
+			size_t andNotWordsAvx2(Word*, Word const*, size_t) {
+				return 0;
+			}
+#endif
+
+			size_t orWordsSse2([[maybe_unused]] Word* destination,
+			                   [[maybe_unused]] Word const* source,
+			                   [[maybe_unused]] size_t count) {
+				size_t i = 0;
+#if defined(__SSE2__)
+				for(; i + 2 <= count; i += 2) {
+					__m128i* out = reinterpret_cast<__m128i*>(destination + i);
+					__m128i in   = _mm_loadu_si128(reinterpret_cast<__m128i const*>(source + i));
+					_mm_storeu_si128(out, _mm_or_si128(_mm_loadu_si128(out), in));
+				}
+#endif
+				return i;
+			}
+
+			size_t andWordsSse2([[maybe_unused]] Word* destination,
+			                    [[maybe_unused]] Word const* source,
+			                    [[maybe_unused]] size_t count) {
+				size_t i = 0;
+#if defined(__SSE2__)
+				for(; i + 2 <= count; i += 2) {
+					__m128i* out = reinterpret_cast<__m128i*>(destination + i);
+					__m128i in   = _mm_loadu_si128(reinterpret_cast<__m128i const*>(source + i));
+					_mm_storeu_si128(out, _mm_and_si128(_mm_loadu_si128(out), in));
+				}
+#endif
+				return i;
+			}
+
+			size_t andNotWordsSse2([[maybe_unused]] Word* destination,
+			                       [[maybe_unused]] Word const* source,
+			                       [[maybe_unused]] size_t count) {
+				size_t i = 0;
+#if defined(__SSE2__)
+				for(; i + 2 <= count; i += 2) {
+					__m128i* out = reinterpret_cast<__m128i*>(destination + i);
+					__m128i in   = _mm_loadu_si128(reinterpret_cast<__m128i const*>(source + i));
+					_mm_storeu_si128(out, _mm_andnot_si128(in, _mm_loadu_si128(out)));
+				}
+#endif
+				return i;
+			}
+		}
+
+		void orWords(Word* destination, Word const* source, size_t count) {
+			size_t i = hasAvx2() ? orWordsAvx2(destination, source, count)
+			                     : orWordsSse2(destination, source, count);
+			for(; i < count; ++i) {
+				destination[i] |= source[i];
+			}
+		}
+
+		void andWords(Word* destination, Word const* source, size_t count) {
+			size_t i = hasAvx2() ? andWordsAvx2(destination, source, count)
+			                     : andWordsSse2(destination, source, count);
+			for(; i < count; ++i) {
+				destination[i] &= source[i];
+			}
+		}
+
+		void andNotWords(Word* destination, Word const* source, size_t count) {
+			size_t i = hasAvx2() ? andNotWordsAvx2(destination, source, count)
+			                     : andNotWordsSse2(destination, source, count);
+			for(; i < count; ++i) {
+				destination[i] &= ~source[i];
+			}
+		}
+
+		size_t popcount(Word const* source, size_t count) {
+			size_t result = 0;
+			for(size_t i = 0; i < count; ++i) {
+				result += static_cast<size_t>(__builtin_popcountll(source[i]));
+			}
+			return result;
+		}
+
+		size_t andPopcount(Word const* first, Word const* second, size_t count) {
+			size_t result = 0;
+			for(size_t i = 0; i < count; ++i) {
+				result += static_cast<size_t>(__builtin_popcountll(first[i] & second[i]));
+			}
+			return result;
+		}
+	}
+
+	namespace {
+		// Rows are padded to a multiple of this number of words (256 bits).
+		constexpr size_t const rowAlignment = 4;
+
+		size_t paddedWords(size_t columns) {
+			return (bits::wordsFor(columns) + rowAlignment - 1) / rowAlignment * rowAlignment;
+		}
+	}
+
+	BitMatrix::BitMatrix(size_t rows, size_t columns) {
+		resize(rows, columns);
+	}
+
+	size_t BitMatrix::getRowsCount() const {
+		return rowsCount;
+	}
+
+	size_t BitMatrix::getColumnsCount() const {
+		return columnsCount;
+	}
+
+	size_t BitMatrix::getWordsPerRow() const {
+		return stride;
+	}
+
+	void BitMatrix::resize(size_t rows, size_t columns) {
+		if(rows > rowsCapacity || paddedWords(columns) > stride) {
+			size_t newRowsCapacity = rowsCapacity, newStride = stride;
+			if(rows > rowsCapacity) {
+				newRowsCapacity = std::max(rows, 2 * rowsCapacity);
+			}
+			if(paddedWords(columns) > stride) {
+				newStride = std::max(paddedWords(columns), 2 * stride);
+			}
+			reallocate(newRowsCapacity, newStride);
+		}
+
+		// Keep the bits outside of the matrix unset.
+		if(columns < columnsCount) {
+			for(size_t i = 0; i < rowsCount; ++i) {
+				Word* rowWords   = row(i);
+				size_t firstWord = columns / bits::wordBits;
+				if(columns % bits::wordBits != 0) {
+					rowWords[firstWord] &= (Word(1) << (columns % bits::wordBits)) - 1;
+					++firstWord;
+				}
+				std::fill(rowWords + firstWord, rowWords + stride, Word(0));
+			}
+		}
+		if(rows < rowsCount) {
+			std::fill(words.begin() + rows * stride, words.begin() + rowsCount * stride, Word(0));
+		}
+
+		rowsCount    = rows;
+		columnsCount = columns;
+	}
+
+	void BitMatrix::eraseRowAndColumn(size_t index) {
+		// Shift the following rows up
+		std::copy(words.begin() + (index + 1) * stride,
+		          words.begin() + rowsCount * stride,
+		          words.begin() + index * stride);
+		std::fill(words.begin() + (rowsCount - 1) * stride,
+		          words.begin() + rowsCount * stride,
+		          Word(0));
+		--rowsCount;
+
+		// Shift the following columns to the left
+		size_t wordIndex = index / bits::wordBits, bitIndex = index % bits::wordBits;
+		size_t usedWords = bits::wordsFor(columnsCount);
+		for(size_t i = 0; i < rowsCount; ++i) {
+			Word* rowWords = row(i);
+
+			Word lowMask = (Word(1) << bitIndex) - 1;
+			Word current = rowWords[wordIndex];
+			current      = (current & lowMask) | ((current >> 1) & ~lowMask);
+
+			for(size_t w = wordIndex + 1; w < usedWords; ++w) {
+				current |= (rowWords[w] & 1) << (bits::wordBits - 1);
+				rowWords[w - 1] = current;
+				current         = rowWords[w] >> 1;
+			}
+			rowWords[usedWords - 1] = current;
+		}
+		--columnsCount;
+	}
+
+	bool BitMatrix::test(size_t row, size_t column) const {
+		return (this->row(row)[column / bits::wordBits] >> (column % bits::wordBits)) & 1;
+	}
+
+	void BitMatrix::set(size_t row, size_t column) {
+		this->row(row)[column / bits::wordBits] |= Word(1) << (column % bits::wordBits);
+	}
+
+	void BitMatrix::reset(size_t row, size_t column) {
+		this->row(row)[column / bits::wordBits] &= ~(Word(1) << (column % bits::wordBits));
+	}
+
+	void BitMatrix::resetRow(size_t row) {
+		std::fill(this->row(row), this->row(row) + stride, Word(0));
+	}
+
+	auto BitMatrix::row(size_t row) -> Word* {
+		return words.data() + row * stride;
+	}
+
+	auto BitMatrix::row(size_t row) const -> Word const* {
+		return words.data() + row * stride;
+	}
+
+	bits::SetBitIterator BitMatrix::beginSetBits(size_t row) const {
+		return bits::SetBitIterator(this->row(row), 0, bits::wordsFor(columnsCount));
+	}
+
+	bits::SetBitIterator BitMatrix::endSetBits(size_t row) const {
+		size_t wordsCount = bits::wordsFor(columnsCount);
+		return bits::SetBitIterator(this->row(row), wordsCount, wordsCount);
+	}
+
+	std::vector<bool> BitMatrix::getRow(size_t row) const {
+		std::vector<bool> result(columnsCount, false);
+		eachSetBits(row, [&result](size_t column) { result[column] = true; });
+		return result;
+	}
+
+	void BitMatrix::orRow(size_t destination, size_t source) {
+		bits::orWords(row(destination), row(source), stride);
+	}
+
+	void BitMatrix::andRow(size_t destination, size_t source) {
+		bits::andWords(row(destination), row(source), stride);
+	}
+
+	size_t BitMatrix::count() const {
+		return bits::popcount(words.data(), rowsCount * stride);
+	}
+
+	size_t BitMatrix::count(size_t row) const {
+		return bits::popcount(this->row(row), stride);
+	}
+
+	bool BitMatrix::operator==(BitMatrix const& other) const {
+		if(rowsCount != other.rowsCount || columnsCount != other.columnsCount) {
+			return false;
+		}
+
+		size_t usedWords = bits::wordsFor(columnsCount);
+		for(size_t i = 0; i < rowsCount; ++i) {
+			if(!std::equal(row(i), row(i) + usedWords, other.row(i))) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool BitMatrix::operator!=(BitMatrix const& other) const {
+		return !(*this == other);
+	}
+
+	void BitMatrix::reallocate(size_t newRowsCapacity, size_t newStride) {
+		decltype(words) newWords(newRowsCapacity * newStride, Word(0));
+
+		for(size_t i = 0; i < rowsCount; ++i) {
+			std::copy(row(i), row(i) + stride, newWords.begin() + i * newStride);
+		}
+
+		words.swap(newWords);
+		rowsCapacity = newRowsCapacity;
+		stride       = newStride;
+	}
+}
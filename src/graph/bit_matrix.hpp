@@ -0,0 +1,361 @@
+#pragma once
+
+#include "utility.hpp"
+
+#include <iterator>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace graph {
+
+	/*! \brief Word-level operations on packed bit arrays.
+	 *
+	 * On x86, these functions use AVX2 instructions when the processor supports them, which is
+	 * checked once at runtime, and SSE2 instructions otherwise. The AVX2 kernels are compiled
+	 * with a target attribute, so the library needs no -mavx2 flag. Elsewhere, they fall back to
+	 * plain 64-bit operations.
+	 */
+	namespace bits {
+
+		/*! \brief The type of a word of bits.
+		 */
+		using Word = std::uint64_t;
+
+		/*! \brief The number of bits in a word.
+		 */
+		constexpr size_t const wordBits = 64;
+
+		/*! \brief Get the number of words needed to store a given number of bits.
+		 *
+		 * \param bitsCount The number of bits.
+		 */
+		constexpr size_t wordsFor(size_t bitsCount) {
+			return (bitsCount + wordBits - 1) / wordBits;
+		}
+
+		/*! \brief Compute `destination |= source` on `count` words.
+		 */
+		void orWords(Word* destination, Word const* source, size_t count);
+
+		/*! \brief Compute `destination &= source` on `count` words.
+		 */
+		void andWords(Word* destination, Word const* source, size_t count);
+
+		/*! \brief Compute `destination &= ~source` on `count` words.
+		 */
+		void andNotWords(Word* destination, Word const* source, size_t count);
+
+		/*! \brief Count the number of bits set in `count` words.
+		 */
+		size_t popcount(Word const* source, size_t count);
+
+		/*! \brief Count the number of bits set in both of two arrays of `count` words.
+		 */
+		size_t andPopcount(Word const* first, Word const* second, size_t count);
+
+		/*! \brief An iterator on the positions of the bits set in an array of words, in
+		 *         increasing order.
+		 */
+		class SetBitIterator {
+		public:
+			/*! \brief The category of the iterator.
+			 */
+			using iterator_category = std::forward_iterator_tag;
+
+			/*! \brief The type of the positions.
+			 */
+			using value_type        = size_t;
+
+			/*! \brief The type of the distance between two iterators.
+			 */
+			using difference_type   = std::ptrdiff_t;
+
+			/*! \brief The type returned by operator->().
+			 */
+			using pointer           = size_t const*;
+
+			/*! \brief The type returned by operator*().
+			 */
+			using reference         = size_t;
+
+			/*! \brief Create an iterator past the end of an empty array.
+			 */
+			SetBitIterator() = default;
+
+			/*! \brief Create an iterator on the first bit set from a given word.
+			 *
+			 * \param words The array of words.
+			 * \param wordIndex The index of the first word to look at, `wordsCount` to create
+			 *                  an iterator past the end.
+			 * \param wordsCount The number of words of the array.
+			 */
+			SetBitIterator(Word const* words, size_t wordIndex, size_t wordsCount)
+			      : words(words)
+			      , wordIndex(wordIndex)
+			      , wordsCount(wordsCount) {
+				if(wordIndex < wordsCount) {
+					current = words[wordIndex];
+					skipEmptyWords();
+				}
+			}
+
+			/*! \brief Get the position of the current bit.
+			 */
+			size_t operator*() const {
+				return wordIndex * wordBits + static_cast<size_t>(__builtin_ctzll(current));
+			}
+
+			/*! \brief Go to the next bit set.
+			 */
+			SetBitIterator& operator++() {
+				current &= current - 1;
+				skipEmptyWords();
+				return *this;
+			}
+
+			/*! \brief Go to the next bit set.
+			 */
+			SetBitIterator operator++(int) {
+				SetBitIterator result = *this;
+				++*this;
+				return result;
+			}
+
+			/*! \brief Check if two iterators are on the same bit.
+			 *
+			 * \param other The other iterator.
+			 */
+			bool operator==(SetBitIterator const& other) const {
+				return wordIndex == other.wordIndex && current == other.current;
+			}
+
+			/*! \brief Check if two iterators are on different bits.
+			 *
+			 * \param other The other iterator.
+			 */
+			bool operator!=(SetBitIterator const& other) const {
+				return !(*this == other);
+			}
+
+		protected:
+			/*! \brief Go to the next word with a bit set, if the current one has none left.
+			 */
+			void skipEmptyWords() {
+				while(current == 0 && ++wordIndex < wordsCount) {
+					current = words[wordIndex];
+				}
+			}
+
+			/*! \brief The array of words.
+			 */
+			Word const* words = nullptr;
+
+			/*! \brief The index of the current word.
+			 */
+			size_t wordIndex = 0;
+
+			/*! \brief The number of words of the array.
+			 */
+			size_t wordsCount = 0;
+
+			/*! \brief The bits of the current word which are not visited yet.
+			 */
+			Word current = 0;
+		};
+	}
+
+	/*! \brief A matrix of bits, packed row by row in 64-bit words.
+	 *
+	 * Each row is padded to a multiple of 256 bits and the whole buffer is aligned on 32 bytes so
+	 * that rows can be processed with SIMD instructions. The capacity grows geometrically in both
+	 * dimensions, so adding rows and columns one by one is amortized constant time per row.
+	 *
+	 * The bits after the last column of each row are always unset.
+	 */
+	class BitMatrix {
+	public:
+		/*! \brief The type of a word of bits.
+		 */
+		using Word = bits::Word;
+
+		/*! \brief Create an empty matrix.
+		 */
+		BitMatrix() = default;
+
+		/*! \brief Create a matrix with every bits unset.
+		 *
+		 * \param rows The number of rows.
+		 * \param columns The number of columns.
+		 */
+		BitMatrix(size_t rows, size_t columns);
+
+		/*! \brief Get the number of rows.
+		 */
+		size_t getRowsCount() const;
+
+		/*! \brief Get the number of columns.
+		 */
+		size_t getColumnsCount() const;
+
+		/*! \brief Get the number of words used to store a row, padding included.
+		 */
+		size_t getWordsPerRow() const;
+
+		/*! \brief Change the size of the matrix.
+		 *
+		 * New bits are unset, and the bits of the cells which stay in the matrix are kept.
+		 *
+		 * \param rows The new number of rows.
+		 * \param columns The new number of columns.
+		 */
+		void resize(size_t rows, size_t columns);
+
+		/*! \brief Remove a row and a column, shifting the following ones.
+		 *
+		 * \param index The index of the row and of the column to remove.
+		 */
+		void eraseRowAndColumn(size_t index);
+
+		/*! \brief Check if a given bit is set.
+		 *
+		 * \param row The row of the bit.
+		 * \param column The column of the bit.
+		 */
+		bool test(size_t row, size_t column) const;
+
+		/*! \brief Set a given bit.
+		 *
+		 * \param row The row of the bit.
+		 * \param column The column of the bit.
+		 */
+		void set(size_t row, size_t column);
+
+		/*! \brief Unset a given bit.
+		 *
+		 * \param row The row of the bit.
+		 * \param column The column of the bit.
+		 */
+		void reset(size_t row, size_t column);
+
+		/*! \brief Unset every bits of a given row.
+		 *
+		 * \param row The index of the row.
+		 */
+		void resetRow(size_t row);
+
+		/*! \brief Get the words of a given row.
+		 *
+		 * \param row The index of the row.
+		 */
+		Word* row(size_t row);
+
+		/*! \brief Get the words of a given row.
+		 *
+		 * \param row The index of the row.
+		 */
+		Word const* row(size_t row) const;
+
+		/*! \brief Get a copy of a given row.
+		 *
+		 * \param row The index of the row.
+		 */
+		std::vector<bool> getRow(size_t row) const;
+
+		/*! \brief Compute `row(destination) |= row(source)`.
+		 */
+		void orRow(size_t destination, size_t source);
+
+		/*! \brief Compute `row(destination) &= row(source)`.
+		 */
+		void andRow(size_t destination, size_t source);
+
+		/*! \brief Count the bits set in the whole matrix.
+		 */
+		size_t count() const;
+
+		/*! \brief Count the bits set in a given row.
+		 *
+		 * \param row The index of the row.
+		 */
+		size_t count(size_t row) const;
+
+		/*! \brief Call a given function with the column of each bit set in a row, in increasing
+		 *         order.
+		 *
+		 * The functor must be convertible to a function of type void(size_t)
+		 *
+		 * \param row The index of the row.
+		 * \param functor The function to call.
+		 */
+		template <typename Functor>
+		void eachSetBits(size_t row, Functor&& functor) const;
+
+		/*! \brief Get an iterator on the column of the first bit set in a row.
+		 *
+		 * \param row The index of the row.
+		 */
+		bits::SetBitIterator beginSetBits(size_t row) const;
+
+		/*! \brief Get an iterator past the column of the last bit set in a row.
+		 *
+		 * \param row The index of the row.
+		 */
+		bits::SetBitIterator endSetBits(size_t row) const;
+
+		/*! \brief Check if two matrices have the same size and the same bits set.
+		 *
+		 * \param other The other matrix.
+		 */
+		bool operator==(BitMatrix const& other) const;
+
+		/*! \brief Check if two matrices differ.
+		 *
+		 * \param other The other matrix.
+		 */
+		bool operator!=(BitMatrix const& other) const;
+
+	protected:
+		/*! \brief Change the capacity of the buffer, keeping the current bits.
+		 *
+		 * \param rowsCapacity The new number of allocated rows.
+		 * \param wordsPerRow The new number of words per row.
+		 */
+		void reallocate(size_t rowsCapacity, size_t wordsPerRow);
+
+		/*! \brief The number of rows.
+		 */
+		size_t rowsCount = 0;
+
+		/*! \brief The number of columns.
+		 */
+		size_t columnsCount = 0;
+
+		/*! \brief The number of allocated rows.
+		 */
+		size_t rowsCapacity = 0;
+
+		/*! \brief The number of words used by each row.
+		 */
+		size_t stride = 0;
+
+		/*! \brief The packed bits.
+		 */
+		std::vector<Word, AlignedAllocator<Word, 32>> words;
+	};
+
+	template <typename Functor>
+	void BitMatrix::eachSetBits(size_t row, Functor&& functor) const {
+		Word const* rowWords = this->row(row);
+		size_t wordsCount    = bits::wordsFor(columnsCount);
+
+		for(size_t i = 0; i < wordsCount; ++i) {
+			Word word = rowWords[i];
+			while(word != 0) {
+				functor(i * bits::wordBits + static_cast<size_t>(__builtin_ctzll(word)));
+				word &= word - 1;
+			}
+		}
+	}
+}
@@ -0,0 +1,195 @@
+#pragma once
+
+#include "path_search.hpp"
+
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace graph {
+
+	/*! \brief A contraction hierarchy of a weighted graph, which answers shortest path queries
+	 *         by exploring only a small part of the graph.
+	 *
+	 * The vertices are contracted one by one, in the order given by their edge difference: the
+	 * number of shortcuts their contraction adds minus the number of edges it removes, plus the
+	 * number of their neighbours already contracted to spread the contractions over the graph.
+	 * Contracting a vertex adds a shortcut between two of its neighbours when a local Dijkstra
+	 * search, the witness search, finds no path between them as short as the one through the
+	 * vertex. The rank of a vertex is its position in this order.
+	 *
+	 * Every shortest path of the graph then has an equivalent path in the hierarchy which goes
+	 * up the ranks then down, so a query is a Dijkstra search from the start on the upward
+	 * arcs and a Dijkstra search from the goal on the downward arcs, which meet at the vertex
+	 * of highest rank of the path.
+	 *
+	 * The upward and downward arcs of each vertex are stored in two compressed sparse rows, as
+	 * in csr::Graph. The hierarchy is immutable: it must be built again when the graph changes.
+	 *
+	 * \tparam Weight The type of the weights of the edges.
+	 */
+	template <typename Weight>
+	class ContractionHierarchy {
+	public:
+		/*! \brief The rank of the ids which are not used by a node of the graph.
+		 */
+		static constexpr std::uint32_t const noRank = static_cast<std::uint32_t>(-1);
+
+		/*! \brief Create an empty hierarchy.
+		 */
+		ContractionHierarchy() = default;
+
+		/*! \brief Build the hierarchy of a given graph.
+		 *
+		 * The node ids of the graph are kept, they must fit in 32 bits. The weights must not be
+		 * negative.
+		 *
+		 * \param g The graph, with a `weight` in its edge property.
+		 * \param witnessLimit The number of vertices a witness search can explore before giving
+		 *                     up and adding the shortcut. Greater limits give fewer shortcuts and
+		 *                     faster queries, but a slower construction.
+		 */
+		template <typename Graph>
+		explicit ContractionHierarchy(Graph const& g, size_t witnessLimit = 256);
+
+		/*! \brief Get one past the greatest id of the hierarchy.
+		 */
+		size_t getIdBound() const;
+
+		/*! \brief Get the rank of a vertex, or noRank if its id is not used.
+		 *
+		 * \param id The id of the vertex.
+		 */
+		std::uint32_t getRank(size_t id) const;
+
+		/*! \brief Get the number of arcs of the hierarchy which are shortcuts.
+		 */
+		size_t getShortcutsCount() const;
+
+		/*! \brief Find a shortest path between two vertices.
+		 *
+		 * \param startId The id of the start of the path.
+		 * \param goalId The id of the end of the path.
+		 * \param forward The scratch space of the search from the start.
+		 * \param backward The scratch space of the search from the goal.
+		 * \return The path found, with the vertices of the shortcuts, which is empty if the
+		 *         goal cannot be reached.
+		 */
+		ShortestPath<Weight> shortestPath(size_t startId,
+		                                  size_t goalId,
+		                                  SearchScratch<Weight>& forward,
+		                                  SearchScratch<Weight>& backward) const;
+
+		/*! \brief Find a shortest path between two vertices.
+		 *
+		 * \param startId The id of the start of the path.
+		 * \param goalId The id of the end of the path.
+		 * \return The path found, with the vertices of the shortcuts, which is empty if the
+		 *         goal cannot be reached.
+		 */
+		ShortestPath<Weight> shortestPath(size_t startId, size_t goalId) const;
+
+		/*! \brief Write the hierarchy to a binary stream.
+		 *
+		 * The arrays are written as they are in memory, so the hierarchy can only be read back
+		 * on a machine with the same byte order.
+		 *
+		 * \param os The stream, opened in binary mode.
+		 */
+		void save(std::ostream& os) const;
+
+		/*! \brief Read a hierarchy written by save().
+		 *
+		 * \param is The stream, opened in binary mode.
+		 * \return The hierarchy.
+		 * \throw std::invalid_argument if the stream does not hold a hierarchy with the same
+		 *        type of weights.
+		 */
+		static ContractionHierarchy load(std::istream& is);
+
+	protected:
+		static_assert(std::is_trivially_copyable<Weight>::value,
+		              "The weights must be trivially copyable to be saved");
+
+		/*! \brief The first word of a saved hierarchy.
+		 */
+		static constexpr std::uint32_t const magic = 0x31484347;
+
+		/*! \brief The middle of the arcs which are edges of the graph.
+		 */
+		static constexpr std::uint32_t const noMiddle = static_cast<std::uint32_t>(-1);
+
+		/*! \brief An arc of the hierarchy.
+		 */
+		struct Arc {
+			/*! \brief The other vertex of the arc: the end of an upward arc, the beginning of a
+			 *         downward arc.
+			 */
+			std::uint32_t other;
+
+			/*! \brief The vertex contracted when this arc was added as a shortcut, or noMiddle.
+			 */
+			std::uint32_t middle;
+
+			/*! \brief The weight of the arc.
+			 */
+			Weight weight;
+		};
+
+		/*! \brief Find the arc between two vertices, which must exist.
+		 *
+		 * \param beginId The beginning of the arc.
+		 * \param endId The end of the arc.
+		 */
+		Arc const& findArc(size_t beginId, size_t endId) const;
+
+		/*! \brief Replace the shortcuts of a path by the edges they stand for.
+		 *
+		 * \param ids The vertices of the path.
+		 * \return The vertices of the path in the graph.
+		 */
+		std::vector<size_t> unpack(std::vector<size_t> const& ids) const;
+
+		/*! \brief Write the size of an array, then its elements.
+		 *
+		 * \param os The stream.
+		 * \param values The array.
+		 */
+		template <typename T>
+		static void writeArray(std::ostream& os, std::vector<T> const& values);
+
+		/*! \brief Read an array written by writeArray().
+		 *
+		 * \param is The stream, which is in a failed state if the array cannot be read.
+		 * \param values The array to fill.
+		 */
+		template <typename T>
+		static void readArray(std::istream& is, std::vector<T>& values);
+
+		/*! \brief The rank of each id, or noRank.
+		 */
+		std::vector<std::uint32_t> ranks;
+
+		/*! \brief The position of the first upward arc of each id, and the number of arcs.
+		 */
+		std::vector<size_t> upwardOffsets;
+
+		/*! \brief The arcs to vertices of higher ranks, grouped by beginning.
+		 */
+		std::vector<Arc> upwardArcs;
+
+		/*! \brief The position of the first downward arc of each id, and the number of arcs.
+		 */
+		std::vector<size_t> downwardOffsets;
+
+		/*! \brief The arcs from vertices of higher ranks, grouped by end.
+		 */
+		std::vector<Arc> downwardArcs;
+	};
+}
+
+#include "contraction_hierarchy.tcc"
@@ -0,0 +1,376 @@
+#pragma once
+
+#include "contraction_hierarchy.hpp"
+#include "indexed_heap.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace graph {
+
+	template <typename Weight>
+	template <typename Graph>
+	ContractionHierarchy<Weight>::ContractionHierarchy(Graph const& g, size_t witnessLimit)
+	      : ranks(g.getIdBound(), noRank) {
+		using NodeRef = typename Graph::NodeRef_t;
+
+		// The arcs between the vertices not contracted yet, in both directions. The arcs of a
+		// contracted vertex are not modified anymore: they become its upward and downward arcs.
+		size_t idBound = g.getIdBound();
+		std::vector<std::vector<Arc>> outArcs(idBound), inArcs(idBound);
+		auto addArc = [&outArcs, &inArcs](size_t beginId, size_t endId, Weight weight,
+		                                  std::uint32_t middle) {
+			auto& outs = outArcs[beginId];
+			auto out   = std::find_if(outs.begin(), outs.end(),
+			                          [endId](Arc const& arc) { return arc.other == endId; });
+			if(out == outs.end()) {
+				outs.push_back(Arc{static_cast<std::uint32_t>(endId), middle, weight});
+				inArcs[endId].push_back(Arc{static_cast<std::uint32_t>(beginId), middle, weight});
+			} else if(weight < out->weight) {
+				*out = Arc{static_cast<std::uint32_t>(endId), middle, weight};
+				for(Arc& in : inArcs[endId]) {
+					if(in.other == beginId) {
+						in = Arc{static_cast<std::uint32_t>(beginId), middle, weight};
+					}
+				}
+			}
+		};
+		auto removeArcsTo = [](std::vector<Arc>& arcs, size_t id) {
+			arcs.erase(std::remove_if(arcs.begin(), arcs.end(),
+			                          [id](Arc const& arc) { return arc.other == id; }),
+			           arcs.end());
+		};
+
+		for(auto vertex : g.vertices()) {
+			g.eachAdjacentEdges(vertex, [&addArc, &vertex](NodeRef end, auto const& property) {
+				if(end.getId() != vertex.getId()) {
+					addArc(vertex.getId(), end.getId(), property.weight, noMiddle);
+				}
+			});
+		}
+
+		// A witness search is a Dijkstra search from a neighbour of the vertex to contract,
+		// which does not go through it and stops once the other neighbours are settled or
+		// beyond the longest path through it.
+		SearchScratch<Weight> witness;
+		std::vector<size_t> targetStamps(idBound, 0);
+		size_t stamp = 0;
+		auto searchWitnesses = [&](size_t sourceId, size_t avoidedId, Weight bound,
+		                           size_t targetsCount) {
+			witness.reset(idBound);
+			auto& heap = witness.getHeap();
+			witness.reach(sourceId, Weight(), sourceId);
+			heap.push(sourceId, Weight());
+			for(size_t settled = 0; settled < witnessLimit && !heap.empty(); ++settled) {
+				if(bound < heap.topKey()) {
+					break;
+				}
+				size_t id = heap.pop();
+				if(targetStamps[id] == stamp && --targetsCount == 0) {
+					break;
+				}
+
+				Weight distance = witness.getDistance(id);
+				for(Arc const& arc : outArcs[id]) {
+					Weight tentative = distance + arc.weight;
+					if(arc.other != avoidedId && (!witness.isReached(arc.other) ||
+					                              tentative < witness.getDistance(arc.other))) {
+						witness.reach(arc.other, tentative, id);
+						heap.pushOrDecrease(arc.other, tentative);
+					}
+				}
+			}
+		};
+
+		struct Shortcut {
+			size_t beginId;
+			size_t endId;
+			Weight weight;
+		};
+		std::vector<Shortcut> shortcuts;
+		auto findShortcuts = [&](size_t id) {
+			shortcuts.clear();
+			for(Arc const& in : inArcs[id]) {
+				++stamp;
+				size_t targetsCount = 0;
+				Weight bound{};
+				for(Arc const& out : outArcs[id]) {
+					if(out.other != in.other) {
+						if(targetsCount == 0 || bound < in.weight + out.weight) {
+							bound = in.weight + out.weight;
+						}
+						targetStamps[out.other] = stamp;
+						++targetsCount;
+					}
+				}
+				if(targetsCount == 0) {
+					continue;
+				}
+
+				searchWitnesses(in.other, id, bound, targetsCount);
+				for(Arc const& out : outArcs[id]) {
+					Weight through = in.weight + out.weight;
+					if(out.other != in.other && (!witness.isReached(out.other) ||
+					                             through < witness.getDistance(out.other))) {
+						shortcuts.push_back(Shortcut{in.other, out.other, through});
+					}
+				}
+			}
+		};
+
+		std::vector<size_t> contractedNeighbours(idBound, 0);
+		auto priority = [&](size_t id) {
+			findShortcuts(id);
+			return static_cast<long long>(shortcuts.size()) -
+			       static_cast<long long>(inArcs[id].size() + outArcs[id].size()) +
+			       static_cast<long long>(contractedNeighbours[id]);
+		};
+
+		// Contracting a vertex changes the priorities of its neighbours, which are computed
+		// again. The priority of the vertex at the top of the queue is also checked before
+		// contracting it, as the contractions of vertices further away can change it too.
+		IndexedHeap<long long> queue(idBound);
+		for(auto vertex : g.vertices()) {
+			queue.push(vertex.getId(), priority(vertex.getId()));
+		}
+		std::vector<size_t> neighbours;
+		std::uint32_t rank = 0;
+		while(!queue.empty()) {
+			size_t id          = queue.pop();
+			long long newValue = priority(id);
+			if(!queue.empty() && queue.topKey() < newValue) {
+				queue.push(id, newValue);
+				continue;
+			}
+
+			ranks[id] = rank++;
+			neighbours.clear();
+			for(Arc const& in : inArcs[id]) {
+				removeArcsTo(outArcs[in.other], id);
+				neighbours.push_back(in.other);
+			}
+			for(Arc const& out : outArcs[id]) {
+				removeArcsTo(inArcs[out.other], id);
+				neighbours.push_back(out.other);
+			}
+			for(Shortcut const& shortcut : shortcuts) {
+				addArc(shortcut.beginId, shortcut.endId, shortcut.weight,
+				       static_cast<std::uint32_t>(id));
+			}
+
+			std::sort(neighbours.begin(), neighbours.end());
+			neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+			for(size_t neighbourId : neighbours) {
+				++contractedNeighbours[neighbourId];
+				queue.update(neighbourId, priority(neighbourId));
+			}
+		}
+
+		auto compress = [idBound](std::vector<std::vector<Arc>> const& arcs,
+		                          std::vector<size_t>& offsets, std::vector<Arc>& compressed) {
+			offsets.assign(idBound + 1, 0);
+			for(size_t id = 0; id < idBound; ++id) {
+				offsets[id + 1] = offsets[id] + arcs[id].size();
+			}
+			compressed.clear();
+			compressed.reserve(offsets.back());
+			for(auto const& vertexArcs : arcs) {
+				compressed.insert(compressed.end(), vertexArcs.begin(), vertexArcs.end());
+			}
+		};
+		compress(outArcs, upwardOffsets, upwardArcs);
+		compress(inArcs, downwardOffsets, downwardArcs);
+	}
+
+	template <typename Weight>
+	size_t ContractionHierarchy<Weight>::getIdBound() const {
+		return ranks.size();
+	}
+
+	template <typename Weight>
+	std::uint32_t ContractionHierarchy<Weight>::getRank(size_t id) const {
+		return ranks[id];
+	}
+
+	template <typename Weight>
+	size_t ContractionHierarchy<Weight>::getShortcutsCount() const {
+		auto isShortcut = [](Arc const& arc) { return arc.middle != noMiddle; };
+		return static_cast<size_t>(
+		        std::count_if(upwardArcs.begin(), upwardArcs.end(), isShortcut) +
+		        std::count_if(downwardArcs.begin(), downwardArcs.end(), isShortcut));
+	}
+
+	template <typename Weight>
+	ShortestPath<Weight> ContractionHierarchy<Weight>::shortestPath(
+	        size_t startId,
+	        size_t goalId,
+	        SearchScratch<Weight>& forward,
+	        SearchScratch<Weight>& backward) const {
+		using Scratch = SearchScratch<Weight>;
+
+		forward.reset(getIdBound());
+		backward.reset(getIdBound());
+		forward.reach(startId, Weight(), startId);
+		backward.reach(goalId, Weight(), goalId);
+		if(startId == goalId) {
+			return forward.pathTo(startId);
+		}
+
+		size_t meetingId = Scratch::npos;
+		Weight length{};
+		auto settle = [&meetingId, &length](Scratch& scratch, Scratch const& other,
+		                                    std::vector<size_t> const& offsets,
+		                                    std::vector<Arc> const& arcs) {
+			size_t id       = scratch.getHeap().pop();
+			Weight distance = scratch.getDistance(id);
+			for(size_t position = offsets[id]; position < offsets[id + 1]; ++position) {
+				size_t nextId    = arcs[position].other;
+				Weight tentative = distance + arcs[position].weight;
+				if(scratch.isReached(nextId) && !(tentative < scratch.getDistance(nextId))) {
+					continue;
+				}
+				scratch.reach(nextId, tentative, id);
+				scratch.getHeap().pushOrDecrease(nextId, tentative);
+				if(other.isReached(nextId)) {
+					Weight total = tentative + other.getDistance(nextId);
+					if(meetingId == Scratch::npos || total < length) {
+						meetingId = nextId;
+						length    = total;
+					}
+				}
+			}
+		};
+
+		// The searches only go up, so neither can stop when the other one has explored the
+		// path: each one stops when its closest vertex is not closer than the best path.
+		auto& forwardHeap  = forward.getHeap();
+		auto& backwardHeap = backward.getHeap();
+		forwardHeap.push(startId, Weight());
+		backwardHeap.push(goalId, Weight());
+		while(true) {
+			bool forwardDone  = forwardHeap.empty() ||
+			                   (meetingId != Scratch::npos && !(forwardHeap.topKey() < length));
+			bool backwardDone = backwardHeap.empty() ||
+			                    (meetingId != Scratch::npos && !(backwardHeap.topKey() < length));
+			if(forwardDone && backwardDone) {
+				break;
+			}
+
+			if(!forwardDone && (backwardDone || !(backwardHeap.topKey() < forwardHeap.topKey()))) {
+				settle(forward, backward, upwardOffsets, upwardArcs);
+			} else {
+				settle(backward, forward, downwardOffsets, downwardArcs);
+			}
+		}
+
+		if(meetingId == Scratch::npos) {
+			return ShortestPath<Weight>();
+		}
+		ShortestPath<Weight> path = joinPaths(forward, backward, meetingId, length);
+		path.ids                  = unpack(path.ids);
+		return path;
+	}
+
+	template <typename Weight>
+	ShortestPath<Weight> ContractionHierarchy<Weight>::shortestPath(size_t startId,
+	                                                                size_t goalId) const {
+		SearchScratch<Weight> forward, backward;
+		return shortestPath(startId, goalId, forward, backward);
+	}
+
+	template <typename Weight>
+	typename ContractionHierarchy<Weight>::Arc const& ContractionHierarchy<Weight>::findArc(
+	        size_t beginId,
+	        size_t endId) const {
+		// The arc is stored with the vertex of lower rank.
+		bool upward  = ranks[beginId] < ranks[endId];
+		size_t id    = upward ? beginId : endId;
+		size_t other = upward ? endId : beginId;
+		auto const& offsets = upward ? upwardOffsets : downwardOffsets;
+		auto const& arcs    = upward ? upwardArcs : downwardArcs;
+
+		auto first = arcs.begin() + static_cast<std::ptrdiff_t>(offsets[id]);
+		auto last  = arcs.begin() + static_cast<std::ptrdiff_t>(offsets[id + 1]);
+		return *std::find_if(first, last, [other](Arc const& arc) { return arc.other == other; });
+	}
+
+	template <typename Weight>
+	std::vector<size_t> ContractionHierarchy<Weight>::unpack(std::vector<size_t> const& ids) const {
+		std::vector<size_t> result{ids.front()};
+		std::vector<std::pair<size_t, size_t>> toUnpack;
+		for(size_t i = 0; i + 1 < ids.size(); ++i) {
+			toUnpack.emplace_back(ids[i], ids[i + 1]);
+			while(!toUnpack.empty()) {
+				auto [beginId, endId] = toUnpack.back();
+				toUnpack.pop_back();
+
+				std::uint32_t middle = findArc(beginId, endId).middle;
+				if(middle == noMiddle) {
+					result.push_back(endId);
+				} else {
+					toUnpack.emplace_back(middle, endId);
+					toUnpack.emplace_back(beginId, middle);
+				}
+			}
+		}
+		return result;
+	}
+
+	template <typename Weight>
+	template <typename T>
+	void ContractionHierarchy<Weight>::writeArray(std::ostream& os, std::vector<T> const& values) {
+		auto size = static_cast<std::uint64_t>(values.size());
+		os.write(reinterpret_cast<char const*>(&size), sizeof(size));
+		os.write(reinterpret_cast<char const*>(values.data()),
+		         static_cast<std::streamsize>(values.size() * sizeof(T)));
+	}
+
+	template <typename Weight>
+	template <typename T>
+	void ContractionHierarchy<Weight>::readArray(std::istream& is, std::vector<T>& values) {
+		std::uint64_t size = 0;
+		is.read(reinterpret_cast<char*>(&size), sizeof(size));
+		if(!is) {
+			return;
+		}
+		values.resize(static_cast<size_t>(size));
+		is.read(reinterpret_cast<char*>(values.data()),
+		        static_cast<std::streamsize>(values.size() * sizeof(T)));
+	}
+
+	template <typename Weight>
+	void ContractionHierarchy<Weight>::save(std::ostream& os) const {
+		// The sizes of the offsets and of the arcs tell if the hierarchy can be read back.
+		std::uint32_t header[3] = {magic, sizeof(size_t), sizeof(Arc)};
+		os.write(reinterpret_cast<char const*>(header), sizeof(header));
+		writeArray(os, ranks);
+		writeArray(os, upwardOffsets);
+		writeArray(os, upwardArcs);
+		writeArray(os, downwardOffsets);
+		writeArray(os, downwardArcs);
+	}
+
+	template <typename Weight>
+	ContractionHierarchy<Weight> ContractionHierarchy<Weight>::load(std::istream& is) {
+		std::uint32_t header[3] = {};
+		is.read(reinterpret_cast<char*>(header), sizeof(header));
+		if(!is || header[0] != magic || header[1] != sizeof(size_t) || header[2] != sizeof(Arc)) {
+			throw std::invalid_argument("The stream does not hold a contraction hierarchy.");
+		}
+
+		ContractionHierarchy result;
+		readArray(is, result.ranks);
+		readArray(is, result.upwardOffsets);
+		readArray(is, result.upwardArcs);
+		readArray(is, result.downwardOffsets);
+		readArray(is, result.downwardArcs);
+		if(!is || result.upwardOffsets.size() != result.ranks.size() + 1 ||
+		   result.downwardOffsets.size() != result.ranks.size() + 1 ||
+		   result.upwardOffsets.back() != result.upwardArcs.size() ||
+		   result.downwardOffsets.back() != result.downwardArcs.size()) {
+			throw std::invalid_argument("The stream does not hold a contraction hierarchy.");
+		}
+		return result;
+	}
+}
@@ -0,0 +1,12 @@
+#include "csr_graph.hpp"
+
+namespace graph {
+	namespace csr {
+
+		template class Graph<NoProperty, NoProperty>;
+		template class Graph<NoProperty, WeightedProperty>;
+		template class Graph<AstarNodeProperty<void>, WeightedProperty>;
+		template class Graph<AstarNodeProperty<std::string>, WeightedProperty>;
+
+	}
+}
@@ -0,0 +1,434 @@
+#pragma once
+
+#include "csr_node.hpp"
+#include "edge.hpp"
+#include "name_interner.hpp"
+#include "node_range.hpp"
+#include "properties.hpp"
+#include "utility.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <cstddef>
+
+namespace graph {
+	/*! \brief Namespace used for the classes and types using a graph with a compressed sparse row
+	 *         as internal representation.
+	 */
+	namespace csr {
+
+		/*! \brief Represents an immutable graph with a compressed sparse row as internal
+		 *         representation.
+		 *
+		 * The graph is built once from another graph (typically a list::Graph or a
+		 * matrix::Graph) and cannot be modified afterwards. The adjacents of the node of id `i` are
+		 * stored contiguously in `targets[offsets[i]]` to `targets[offsets[i + 1] - 1]`, and the
+		 * property of each edge is stored at the same index in a parallel array.
+		 *
+		 * Node ids are kept from the graph it has been built from.
+		 */
+		template <typename NodeProperty, typename EdgeProperty>
+		class Graph {
+		public:
+			/*! \brief The edge type used by this graph.
+			 */
+			using Edge_t      = Edge<EdgeProperty>;
+
+			/*! \brief The immutable node type used by this graph.
+			 */
+			using ConstNode_t = ConstNode<NodeProperty>;
+
+			/*! \brief The lightweight node handle given by the iteration functions.
+			 */
+			using NodeRef_t   = NodeRef<Graph>;
+
+			/*! \brief The range of vertices returned by vertices().
+			 */
+			using VertexRange_t   = IteratorRange<VertexIterator<Graph>>;
+
+			/*! \brief The range of adjacents returned by adjacents().
+			 */
+			using AdjacentRange_t = IteratorRange<AdjacentIterator<Graph, size_t const*>>;
+
+			/*! \brief The range of edges returned by edges().
+			 */
+			using EdgeRange_t     = IteratorRange<EdgeIterator<Graph>>;
+
+			/*! \brief Create an empty graph
+			 */
+			Graph() = default;
+
+			/*! \brief Freeze a given graph.
+			 *
+			 * \param source The graph to freeze.
+			 */
+			template <typename SourceGraph>
+			explicit Graph(SourceGraph const& source);
+
+			/*! \brief Check if a node with the given name is in the graph.
+			 *
+			 * \param nodeName The name of the node.
+			 */
+			bool hasNode(std::string_view nodeName) const;
+
+			/*! \brief Choose whether the graph keeps an index of the incoming edges of each node.
+			 *
+			 * The index is a second compressed array with every edges reversed, which makes
+			 * eachPredecessors() as fast as eachAdjacents(). Enabling it builds it in a time
+			 * linear in the size of the graph, disabling it frees it.
+			 *
+			 * \param enabled Whether the index is kept, it is not by default.
+			 */
+			void setReverseIndex(bool enabled);
+
+			/*! \brief Check if the graph keeps an index of the incoming edges of each node.
+			 */
+			bool hasReverseIndex() const;
+
+			/*! \brief Check if an edge exists between two nodes.
+			 *
+			 * \param begin The start of the edge.
+			 * \param end The end of the edge.
+			 */
+			bool hasEdge(ConstNode_t const& begin, ConstNode_t const& end) const;
+
+			/*! \brief Get the property of a given edge.
+			 *
+			 * \exception std::out_of_range If the edge is not in the graph.
+			 *
+			 * \param begin The node at the start of the edge.
+			 * \param end The node at the end of the edge.
+			 */
+			EdgeProperty getEdgeProperty(ConstNode_t const& begin, ConstNode_t const& end) const;
+
+			/*! \brief Get the property of a given edge.
+			 *
+			 * \exception std::out_of_range If the edge is not in the graph.
+			 *
+			 * \param beginId The id of the node at the start of the edge.
+			 * \param endId The id of the node at the end of the edge.
+			 */
+			EdgeProperty getEdgeProperty(size_t beginId, size_t endId) const;
+
+			/*! \brief Get the offset of the adjacents of each nodes in the target array.
+			 *
+			 * The returned vector contains one more element than the number of vertices.
+			 */
+			std::vector<size_t> const& getOffsets() const;
+
+			/*! \brief Get the contiguous array of the end of each edges.
+			 */
+			std::vector<size_t> const& getTargets() const;
+
+			/*! \brief Get the number of vertices in the graph.
+			 *
+			 * \return the number of vertices in the graph.
+			 */
+			size_t getVerticesCount() const;
+
+			/*! \brief Get the number of edges in the graph.
+			 *
+			 * \return the number of edges in the graph.
+			 */
+			size_t getEdgesCount() const;
+
+			/*! \brief Get one past the greatest id of a node of the graph.
+			 *
+			 * The ids of a CSR graph are always dense, so this is the number of vertices.
+			 */
+			size_t getIdBound() const;
+
+			/*! \brief Check if a given id is the id of a node of the graph.
+			 *
+			 * \param nodeId The id to check.
+			 */
+			bool hasNodeId(size_t nodeId) const;
+
+			/*! \brief Get the name of the node with a given id.
+			 *
+			 * \warning The returned view is invalidated when a node is added or removed.
+			 *
+			 * \param nodeId The id of the node.
+			 */
+			std::string_view getName(size_t nodeId) const;
+
+			/*! \brief Get the property of the node with a given id.
+			 *
+			 * \param nodeId The id of the node.
+			 */
+			NodeProperty const& getNodeProperty(size_t nodeId) const;
+
+			/*! \brief Return a Node representing a node from this graph with a given id.
+			 *
+			 * \param nodeId The id of the node.
+			 * \return The Node representing the given node.
+			 */
+			ConstNode_t getNode(size_t nodeId) const;
+
+			/*! Call a given function for each vertices.
+			 *
+			 * The functor must be convertible to a function of type void(NodeRef_t). A function
+			 * taking a ConstNode_t can also be used, but the node is then built for each call.
+			 *
+			 * \param functor the function to call
+			 */
+			template <typename Functor>
+			void eachVertices(Functor&& functor) const;
+
+			/*! Call a given function for each edges.
+			 *
+			 * The functor must be convertible to a function of type void(NodeRef_t, NodeRef_t).
+			 * A function taking ConstNode_t can also be used, but the nodes are then built for
+			 * each call.
+			 *
+			 * \param functor the function to call
+			 */
+			template <typename Functor>
+			void eachEdges(Functor&& functor) const;
+
+			/*! Call a given function for each vertices adjacent to the given edge.
+			 *
+			 * The functor must be convertible to a function of type void(NodeRef_t). A function
+			 * taking a ConstNode_t can also be used, but the node is then built for each call.
+			 *
+			 * \param vertex the vertex from which to process the adjacents.
+			 * \param functor the function to call
+			 */
+			template <typename Functor>
+			void eachAdjacents(NodeRef_t vertex, Functor&& functor) const;
+
+			/*! Call a given function for each vertices adjacent to the given edge.
+			 *
+			 * \param vertex the vertex from which to process the adjacents.
+			 * \param functor the function to call
+			 * \sa eachAdjacents(NodeRef_t, Functor&&)
+			 */
+			template <typename Functor>
+			void eachAdjacents(ConstNode_t const& vertex, Functor&& functor) const;
+
+			/*! Call a given function for each edge starting from the given vertex.
+			 *
+			 * This gives the property of each edge along with its end, so that weighted
+			 * traversals do not look every edge up with getEdgeProperty().
+			 *
+			 * The functor must be convertible to a function of type
+			 * void(NodeRef_t, EdgeProperty const&).
+			 *
+			 * \param vertex the vertex from which to process the edges.
+			 * \param functor the function to call
+			 */
+			template <typename Functor>
+			void eachAdjacentEdges(NodeRef_t vertex, Functor&& functor) const;
+
+			/*! Call a given function for each edge starting from the given vertex.
+			 *
+			 * \param vertex the vertex from which to process the edges.
+			 * \param functor the function to call
+			 * \sa eachAdjacentEdges(NodeRef_t, Functor&&)
+			 */
+			template <typename Functor>
+			void eachAdjacentEdges(ConstNode_t const& vertex, Functor&& functor) const;
+
+			/*! Call a given function for each vertices which are the start of an edge to the
+			 *  given vertex.
+			 *
+			 * Without the index enabled by setReverseIndex(), this takes a time linear in the
+			 * number of edges.
+			 *
+			 * The functor must be convertible to a function of type void(NodeRef_t).
+			 *
+			 * \param vertex the vertex from which to process the predecessors.
+			 * \param functor the function to call
+			 */
+			template <typename Functor>
+			void eachPredecessors(NodeRef_t vertex, Functor&& functor) const;
+
+			/*! Call a given function for each vertices which are the start of an edge to the
+			 *  given vertex.
+			 *
+			 * \param vertex the vertex from which to process the predecessors.
+			 * \param functor the function to call
+			 * \sa eachPredecessors(NodeRef_t, Functor&&)
+			 */
+			template <typename Functor>
+			void eachPredecessors(ConstNode_t const& vertex, Functor&& functor) const;
+
+			/*! Call a given function for each edge ending at the given vertex, with the start of
+			 *  the edge and its property.
+			 *
+			 * Each parallel edge is given with its own property. Without the index enabled by
+			 * setReverseIndex(), this takes a time linear in the number of edges.
+			 *
+			 * The functor must be convertible to a function of type
+			 * void(NodeRef_t, EdgeProperty const&).
+			 *
+			 * \param vertex the vertex at the end of the edges.
+			 * \param functor the function to call
+			 */
+			template <typename Functor>
+			void eachPredecessorEdges(NodeRef_t vertex, Functor&& functor) const;
+
+			/*! Call a given function for each edge ending at the given vertex, with the start of
+			 *  the edge and its property.
+			 *
+			 * \param vertex the vertex at the end of the edges.
+			 * \param functor the function to call
+			 * \sa eachPredecessorEdges(NodeRef_t, Functor&&)
+			 */
+			template <typename Functor>
+			void eachPredecessorEdges(ConstNode_t const& vertex, Functor&& functor) const;
+
+			/*! \brief Get the vertices of the graph, in increasing order of ids.
+			 *
+			 * \warning The range is invalidated when the graph is modified.
+			 */
+			VertexRange_t vertices() const;
+
+			/*! \brief Get the edges of the graph, grouped by start vertex.
+			 *
+			 * Each edge is a pair of NodeRef_t, the start and the end of the edge.
+			 *
+			 * \warning The range is invalidated when the graph is modified.
+			 */
+			EdgeRange_t edges() const;
+
+			/*! \brief Get the adjacents of a given vertex.
+			 *
+			 * \warning The range is invalidated when the graph is modified.
+			 *
+			 * \param nodeId The id of the vertex.
+			 */
+			AdjacentRange_t adjacents(size_t nodeId) const;
+
+			/*! \brief Get the vertices which are the start of an edge to a given vertex.
+			 *
+			 * The range is read from the reverse index, see setReverseIndex(). Without it, the
+			 * predecessors can still be found with eachPredecessors().
+			 *
+			 * \warning The range is invalidated when the graph is modified.
+			 *
+			 * \param nodeId The id of the vertex.
+			 * \exception std::logic_error If the reverse index is not enabled.
+			 */
+			AdjacentRange_t predecessors(size_t nodeId) const;
+
+			/*! \brief Get the id of from the name of a node.
+			 *
+			 * \param name The name of the node.
+			 * \return The id of the node.
+			 * \exception std::out_of_range If the node is not in the graph.
+			 */
+			size_t getId(std::string_view name) const;
+
+			/*! \brief Get the first node of the graph.
+			 *
+			 * \return The first node in the graph.
+			 */
+			ConstNode_t begin() const;
+
+			/*! \brief Return a Node representing a node from this graph with a given name.
+			 *
+			 * \exception std::out_of_range If the node is not in the graph.
+			 *
+			 * \param nodeName The name of the node.
+			 * \return The Node representing the given node.
+			 */
+			ConstNode_t operator[](std::string_view nodeName) const;
+
+			/*! \brief Return the graph with every edges reversed.
+			 *
+			 * \return The transposed graph.
+			 */
+			Graph transposed() const;
+
+			/*! \brief Check if two graphs are equal.
+			 *
+			 * \param other The other graph to check for equality.
+			 * \return true if the two graphs are equal.
+			 */
+			bool operator==(Graph const& other) const;
+
+			/*! \brief Check if two graphs are not equal.
+			 *
+			 * \param other The other graph to check for equality.
+			 * \return true if the two graphs are not equal.
+			 */
+			bool operator!=(Graph const& other) const;
+
+		protected:
+			/*! \brief Find the position of an edge in the target array.
+			 *
+			 * \param beginId The id of the node at the start of the edge.
+			 * \param endId The id of the node at the end of the edge.
+			 * \return The index of the edge, or `targets.size()` if there is no such edge.
+			 */
+			size_t findEdge(size_t beginId, size_t endId) const;
+
+			/*! \brief The offset of the adjacents of each nodes in the target array.
+			 */
+			std::vector<size_t> offsets{0};
+
+			/*! \brief The end of each edges, grouped by start node.
+			 */
+			std::vector<size_t> targets;
+
+			/*! \brief The properties of each edges, parallel to the target array.
+			 */
+			std::vector<EdgeProperty> edgeProperties;
+
+			/*! \brief The properties of each nodes.
+			 */
+			std::vector<NodeProperty> nodeProperties;
+
+			/*! \brief The name of each nodes.
+			 *
+			 * This is also used for reverse looking up the name of a node from which we know its
+			 * id.
+			 */
+			NameInterner nodeNames;
+
+			/*! \brief Whether the index of the incoming edges is kept.
+			 */
+			bool reverseIndexed = false;
+
+			/*! \brief The offset of the predecessors of each nodes in the reverse target array,
+			 *         when reverseIndexed is set.
+			 */
+			std::vector<size_t> reverseOffsets;
+
+			/*! \brief The start of each edges, grouped by end node, when reverseIndexed is set.
+			 */
+			std::vector<size_t> reverseTargets;
+
+			/*! \brief The position in targets of each edge of reverseTargets, when reverseIndexed
+			 *         is set.
+			 */
+			std::vector<size_t> reverseEdges;
+		};
+
+		/*! \brief A graph to be used by an A* algorithm.
+		 */
+		template <typename State>
+		using AstarGraph    = Graph<AstarNodeProperty<State>, WeightedProperty>;
+
+		/*! \brief A graph with weighted edges
+		 */
+		using WeightedGraph = Graph<NoProperty, WeightedProperty>;
+	}
+
+	/*! \brief Return the symmetric graph of a frozen graph.
+	 *
+	 * Overload of symmetric(Graph const&) which transposes the compressed arrays directly instead
+	 * of inserting every edges one by one.
+	 *
+	 * \param g The Graph from which to create the symmetric graph.
+	 * \return The symmetric graph of the current graph.
+	 */
+	template <typename NodeProperty, typename EdgeProperty>
+	csr::Graph<NodeProperty, EdgeProperty> symmetric(
+	        csr::Graph<NodeProperty, EdgeProperty> const& g);
+}
+
+#include "csr_graph.tcc"
@@ -0,0 +1,462 @@
+#pragma once
+
+#include "csr_graph.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace graph {
+	namespace csr {
+
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename SourceGraph>
+		Graph<NodeProperty, EdgeProperty>::Graph(SourceGraph const& source)
+		      : offsets(source.getVerticesCount() + 1, 0)
+		      , targets(source.getEdgesCount())
+		      , edgeProperties(source.getEdgesCount())
+		      , nodeProperties(source.getVerticesCount()) {
+			using SourceNode = typename SourceGraph::NodeRef_t;
+
+			// The ids of the source graph may not be dense (after some removals of nodes with
+			// RemovalMode::Tombstone), so they are renumbered, keeping their order.
+			std::vector<size_t> newIds(source.getIdBound(), NameInterner::npos);
+			source.eachVertices([&newIds](SourceNode node) { newIds[node.getId()] = 0; });
+			size_t nodesCount = 0;
+			for(size_t& newId : newIds) {
+				if(newId != NameInterner::npos) {
+					newId = nodesCount++;
+				}
+			}
+
+			// The source graph may give its nodes in any order, the names are interned by id so
+			// that the ids are kept.
+			std::vector<std::string> names(nodesCount);
+			source.eachVertices([this, &names, &newIds](SourceNode node) {
+				size_t nodeId          = newIds[node.getId()];
+				names[nodeId]          = node.getName();
+				nodeProperties[nodeId] = node.getProperty();
+			});
+			for(auto const& name : names) {
+				nodeNames.insert(name);
+			}
+
+			// Counting sort of the edges by start node, keeping the order of the source graph for
+			// the adjacents of a given node.
+			source.eachEdges([this, &newIds](SourceNode begin, SourceNode) {
+				++offsets[newIds[begin.getId()] + 1];
+			});
+			std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+			// The properties are taken edge by edge, so that parallel edges keep their own.
+			std::vector<size_t> cursors(offsets.begin(), offsets.end() - 1);
+			source.eachVertices([this, &cursors, &newIds, &source](SourceNode begin) {
+				size_t& cursor = cursors[newIds[begin.getId()]];
+				source.eachAdjacentEdges(begin, [this, &cursor, &newIds](SourceNode end,
+				                                                         auto const& property) {
+					targets[cursor]        = newIds[end.getId()];
+					edgeProperties[cursor] = property;
+					++cursor;
+				});
+			});
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		bool Graph<NodeProperty, EdgeProperty>::hasNode(std::string_view nodeName) const {
+			return nodeNames.contains(nodeName);
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		bool Graph<NodeProperty, EdgeProperty>::hasEdge(ConstNode_t const& begin,
+		                                                ConstNode_t const& end) const {
+			return findEdge(begin.getId(), end.getId()) != targets.size();
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		EdgeProperty Graph<NodeProperty, EdgeProperty>::getEdgeProperty(
+		        ConstNode_t const& begin,
+		        ConstNode_t const& end) const {
+			return getEdgeProperty(begin.getId(), end.getId());
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		EdgeProperty Graph<NodeProperty, EdgeProperty>::getEdgeProperty(size_t beginId,
+		                                                                size_t endId) const {
+			size_t position = findEdge(beginId, endId);
+
+			if(position == targets.size()) {
+				std::ostringstream errMsg;
+				errMsg << "No such edge if the graph: (" << nodeNames[beginId] << ", "
+				       << nodeNames[endId] << "), with id: (" << beginId << ", " << endId << ").";
+				throw std::out_of_range(errMsg.str());
+			}
+
+			return edgeProperties[position];
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		std::vector<size_t> const& Graph<NodeProperty, EdgeProperty>::getOffsets() const {
+			return offsets;
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		std::vector<size_t> const& Graph<NodeProperty, EdgeProperty>::getTargets() const {
+			return targets;
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		size_t Graph<NodeProperty, EdgeProperty>::getVerticesCount() const {
+			return nodeNames.size();
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		size_t Graph<NodeProperty, EdgeProperty>::getEdgesCount() const {
+			return targets.size();
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		size_t Graph<NodeProperty, EdgeProperty>::getIdBound() const {
+			return getVerticesCount();
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		void Graph<NodeProperty, EdgeProperty>::setReverseIndex(bool enabled) {
+			reverseIndexed = enabled;
+			reverseOffsets = std::vector<size_t>();
+			reverseTargets = std::vector<size_t>();
+			reverseEdges   = std::vector<size_t>();
+			if(!enabled) {
+				return;
+			}
+
+			// Counting sort of the edges by end node.
+			reverseOffsets.assign(offsets.size(), 0);
+			reverseTargets.resize(targets.size());
+			reverseEdges.resize(targets.size());
+			for(size_t end : targets) {
+				++reverseOffsets[end + 1];
+			}
+			std::partial_sum(reverseOffsets.begin(), reverseOffsets.end(), reverseOffsets.begin());
+
+			std::vector<size_t> cursors(reverseOffsets.begin(), reverseOffsets.end() - 1);
+			for(size_t begin = 0; begin < nodeNames.size(); ++begin) {
+				for(size_t position = offsets[begin]; position < offsets[begin + 1]; ++position) {
+					size_t reversePosition          = cursors[targets[position]]++;
+					reverseTargets[reversePosition] = begin;
+					reverseEdges[reversePosition]   = position;
+				}
+			}
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		bool Graph<NodeProperty, EdgeProperty>::hasReverseIndex() const {
+			return reverseIndexed;
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		bool Graph<NodeProperty, EdgeProperty>::hasNodeId(size_t nodeId) const {
+			return nodeId < getVerticesCount();
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		std::string_view Graph<NodeProperty, EdgeProperty>::getName(size_t nodeId) const {
+			return nodeNames[nodeId];
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		NodeProperty const& Graph<NodeProperty, EdgeProperty>::getNodeProperty(
+		        size_t nodeId) const {
+			return nodeProperties[nodeId];
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		auto Graph<NodeProperty, EdgeProperty>::getNode(size_t nodeId) const -> ConstNode_t {
+			size_t const* adjacents = targets.data();
+			return ConstNode_t(nodeId,
+			                   adjacents + offsets[nodeId],
+			                   adjacents + offsets[nodeId + 1],
+			                   std::string(nodeNames[nodeId]),
+			                   nodeProperties);
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachVertices(Functor&& functor) const {
+			static_assert(std::is_convertible<Functor, std::function<void(NodeRef_t)>>::value,
+			              "The function must be convertible to a function of type void(NodeRef)");
+
+			for(size_t i = 0; i < nodeNames.size(); ++i) {
+				functor(NodeRef_t(*this, i));
+			}
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachEdges(Functor&& functor) const {
+			static_assert(std::is_convertible<Functor,
+			                                  std::function<void(NodeRef_t, NodeRef_t)>>::value,
+			              "The function must be convertible to a function of type void(NodeRef, "
+			              "NodeRef)");
+
+			for(size_t i = 0; i < nodeNames.size(); ++i) {
+				for(size_t position = offsets[i]; position < offsets[i + 1]; ++position) {
+					functor(NodeRef_t(*this, i), NodeRef_t(*this, targets[position]));
+				}
+			}
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachAdjacents(NodeRef_t vertex,
+		                                                      Functor&& functor) const {
+			static_assert(std::is_convertible<Functor, std::function<void(NodeRef_t)>>::value,
+			              "The function must be convertible to a function of type void(NodeRef)");
+			size_t vertexId = vertex.getId();
+
+			for(size_t position = offsets[vertexId]; position < offsets[vertexId + 1];
+			    ++position) {
+				functor(NodeRef_t(*this, targets[position]));
+			}
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachAdjacents(ConstNode_t const& vertex,
+		                                                      Functor&& functor) const {
+			eachAdjacents(NodeRef_t(*this, vertex.getId()), std::forward<Functor>(functor));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachAdjacentEdges(NodeRef_t vertex,
+		                                                          Functor&& functor) const {
+			static_assert(
+			        std::is_convertible<Functor,
+			                            std::function<void(NodeRef_t, EdgeProperty const&)>>::value,
+			        "The function must be convertible to a function of type "
+			        "void(NodeRef, EdgeProperty const&)");
+			size_t vertexId = vertex.getId();
+
+			for(size_t position = offsets[vertexId]; position < offsets[vertexId + 1];
+			    ++position) {
+				functor(NodeRef_t(*this, targets[position]), edgeProperties[position]);
+			}
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachAdjacentEdges(ConstNode_t const& vertex,
+		                                                          Functor&& functor) const {
+			eachAdjacentEdges(NodeRef_t(*this, vertex.getId()), std::forward<Functor>(functor));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachPredecessors(NodeRef_t vertex,
+		                                                         Functor&& functor) const {
+			static_assert(std::is_convertible<Functor, std::function<void(NodeRef_t)>>::value,
+			              "The function must be convertible to a function of type void(NodeRef)");
+			size_t vertexId = vertex.getId();
+
+			if(reverseIndexed) {
+				for(size_t position = reverseOffsets[vertexId];
+				    position < reverseOffsets[vertexId + 1];
+				    ++position) {
+					functor(NodeRef_t(*this, reverseTargets[position]));
+				}
+				return;
+			}
+
+			for(size_t i = 0; i < nodeNames.size(); ++i) {
+				for(size_t position = offsets[i]; position < offsets[i + 1]; ++position) {
+					if(targets[position] == vertexId) {
+						functor(NodeRef_t(*this, i));
+					}
+				}
+			}
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachPredecessors(ConstNode_t const& vertex,
+		                                                         Functor&& functor) const {
+			eachPredecessors(NodeRef_t(*this, vertex.getId()), std::forward<Functor>(functor));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachPredecessorEdges(NodeRef_t vertex,
+		                                                             Functor&& functor) const {
+			static_assert(
+			        std::is_convertible<Functor,
+			                            std::function<void(NodeRef_t, EdgeProperty const&)>>::value,
+			        "The function must be convertible to a function of type "
+			        "void(NodeRef, EdgeProperty const&)");
+			size_t vertexId = vertex.getId();
+
+			if(reverseIndexed) {
+				for(size_t position = reverseOffsets[vertexId];
+				    position < reverseOffsets[vertexId + 1];
+				    ++position) {
+					functor(NodeRef_t(*this, reverseTargets[position]),
+					        edgeProperties[reverseEdges[position]]);
+				}
+				return;
+			}
+
+			for(size_t i = 0; i < nodeNames.size(); ++i) {
+				for(size_t position = offsets[i]; position < offsets[i + 1]; ++position) {
+					if(targets[position] == vertexId) {
+						functor(NodeRef_t(*this, i), edgeProperties[position]);
+					}
+				}
+			}
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachPredecessorEdges(ConstNode_t const& vertex,
+		                                                             Functor&& functor) const {
+			eachPredecessorEdges(NodeRef_t(*this, vertex.getId()), std::forward<Functor>(functor));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		auto Graph<NodeProperty, EdgeProperty>::vertices() const -> VertexRange_t {
+			return VertexRange_t(VertexIterator<Graph>(*this, 0),
+			                     VertexIterator<Graph>(*this, getIdBound()));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		auto Graph<NodeProperty, EdgeProperty>::edges() const -> EdgeRange_t {
+			VertexRange_t range = vertices();
+			return EdgeRange_t(EdgeIterator<Graph>(range.begin(), range.end()),
+			                   EdgeIterator<Graph>(range.end(), range.end()));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		auto Graph<NodeProperty, EdgeProperty>::adjacents(size_t nodeId) const
+		        -> AdjacentRange_t {
+			using Iterator = typename AdjacentRange_t::iterator;
+
+			size_t const* first = targets.data() + offsets[nodeId];
+			size_t const* last  = targets.data() + offsets[nodeId + 1];
+			return AdjacentRange_t(Iterator(*this, first, last, false),
+			                       Iterator(*this, last, last, false));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		auto Graph<NodeProperty, EdgeProperty>::predecessors(size_t nodeId) const
+		        -> AdjacentRange_t {
+			using Iterator = typename AdjacentRange_t::iterator;
+
+			if(!reverseIndexed) {
+				throw std::logic_error("The predecessors ranges need the reverse index, see "
+				                       "setReverseIndex().");
+			}
+
+			size_t const* first = reverseTargets.data() + reverseOffsets[nodeId];
+			size_t const* last  = reverseTargets.data() + reverseOffsets[nodeId + 1];
+			return AdjacentRange_t(Iterator(*this, first, last, false),
+			                       Iterator(*this, last, last, false));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		size_t Graph<NodeProperty, EdgeProperty>::getId(std::string_view name) const {
+			size_t nodeId = nodeNames.find(name);
+			if(nodeId == NameInterner::npos) {
+				std::ostringstream errMsg;
+				errMsg << "No such node in the graph: " << name << ".";
+				throw std::out_of_range(errMsg.str());
+			}
+			return nodeId;
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		auto Graph<NodeProperty, EdgeProperty>::begin() const -> ConstNode_t {
+			return getNode(0);
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		auto Graph<NodeProperty, EdgeProperty>::operator[](std::string_view nodeName) const
+		        -> ConstNode_t {
+			return getNode(getId(nodeName));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		auto Graph<NodeProperty, EdgeProperty>::transposed() const -> Graph {
+			Graph result;
+			result.offsets        = std::vector<size_t>(offsets.size(), 0);
+			result.targets        = std::vector<size_t>(targets.size());
+			result.edgeProperties = std::vector<EdgeProperty>(edgeProperties.size());
+			result.nodeProperties = nodeProperties;
+			result.nodeNames      = nodeNames;
+
+			for(size_t end : targets) {
+				++result.offsets[end + 1];
+			}
+			std::partial_sum(result.offsets.begin(), result.offsets.end(), result.offsets.begin());
+
+			std::vector<size_t> cursors(result.offsets.begin(), result.offsets.end() - 1);
+			for(size_t begin = 0; begin < nodeNames.size(); ++begin) {
+				for(size_t position = offsets[begin]; position < offsets[begin + 1]; ++position) {
+					size_t newPosition                 = cursors[targets[position]]++;
+					result.targets[newPosition]        = begin;
+					result.edgeProperties[newPosition] = edgeProperties[position];
+				}
+			}
+
+			return result;
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		bool Graph<NodeProperty, EdgeProperty>::operator==(Graph const& other) const {
+
+			// Compare node names and number of nodes
+			if(!nodeNames.hasSameNames(other.nodeNames)) {
+				return false;
+			}
+
+			if(targets.size() != other.targets.size()) {
+				return false;
+			}
+
+			for(size_t begin = 0; begin < nodeNames.size(); ++begin) {
+				size_t otherBegin = other.getId(nodeNames[begin]);
+				for(size_t position = offsets[begin]; position < offsets[begin + 1]; ++position) {
+					size_t otherPosition =
+					        other.findEdge(otherBegin, other.getId(nodeNames[targets[position]]));
+					if(otherPosition == other.targets.size() ||
+					   !(edgeProperties[position] == other.edgeProperties[otherPosition])) {
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		bool Graph<NodeProperty, EdgeProperty>::operator!=(Graph const& other) const {
+			return !(*this == other);
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		size_t Graph<NodeProperty, EdgeProperty>::findEdge(size_t beginId, size_t endId) const {
+			auto rowBegin = targets.begin() + offsets[beginId],
+			     rowEnd   = targets.begin() + offsets[beginId + 1];
+			auto found    = std::find(rowBegin, rowEnd, endId);
+
+			return (found == rowEnd) ? targets.size() : (found - targets.begin());
+		}
+	}
+
+	template <typename NodeProperty, typename EdgeProperty>
+	csr::Graph<NodeProperty, EdgeProperty> symmetric(
+	        csr::Graph<NodeProperty, EdgeProperty> const& g) {
+		return g.transposed();
+	}
+}
@@ -0,0 +1,12 @@
+#include "csr_node.hpp"
+#include "properties.hpp"
+
+namespace graph {
+	namespace csr {
+
+		template class ConstNode<NoProperty>;
+		template class ConstNode<AstarNodeProperty<void>>;
+		template class ConstNode<AstarNodeProperty<std::string>>;
+
+	}
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "node_ref.hpp"
+
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+namespace graph {
+	namespace csr {
+
+		/*! \brief Represents an immutable Node
+		 *
+		 * An object of type ConstNode will store pointers to the compressed adjacency of the parent
+		 * Graph. Therefore, like an iterator, using this object after the destruction of the
+		 * parent Graph will result in a dandling reference.
+		 */
+		template <typename NodeProperty>
+		class ConstNode {
+		public:
+			ConstNode() = delete;
+
+			/*! \brief Node default constructor.
+			 *
+			 * \param id The id of the node to reference.
+			 * \param connectionsBegin The first adjacent id of the node in the parent Graph.
+			 * \param connectionsEnd One past the last adjacent id of the node in the parent Graph.
+			 * \param name The name of the node.
+			 * \param property A reference to the properties vector of the parent Graph.
+			 */
+			ConstNode(size_t id,
+			          size_t const* connectionsBegin,
+			          size_t const* connectionsEnd,
+			          std::string name,
+			          std::vector<NodeProperty> const& property);
+
+			/*! \brief Convert a NodeRef to a ConstNode.
+			 *
+			 * \param node The handle to convert.
+			 */
+			template <typename Graph>
+			ConstNode(NodeRef<Graph> const& node);
+
+			/*! \brief Return true if two nodes are the same node (by name).
+			 *
+			 * This function will not check if the nodes are from the same graph.
+			 *
+			 * \param other the other node to compare to.
+			 * \return true if the two nodes are the same node.
+			 */
+			bool operator==(ConstNode const& other) const;
+
+			/*! \brief Compare two nodes arbitrarily.
+			 *
+			 * \param other the other node to compare to.
+			 * \return true or false.
+			 */
+			bool operator<(ConstNode const& other) const;
+
+			/*! \brief Return true if the current node is connected to the given node.
+			 *
+			 * \param other the other node to check.
+			 * \return true if the current node is connected to the given node.
+			 */
+			bool isConnectedTo(ConstNode const& other) const;
+
+			/*! \brief Get the id of the current node.
+			 *
+			 * \return The id of the current node.
+			 */
+			size_t getId() const;
+
+			/*! \brief Get the name of the current node.
+			 *
+			 * \return The name of the current node.
+			 */
+			std::string getName() const;
+
+			/*! \brief Return the ids of the adjacent nodes.
+			 *
+			 * \return A copy of the adjacent ids of the node.
+			 */
+			std::vector<size_t> getConnections() const;
+
+			/*! \brief Return the property of the current Node.
+			 *
+			 * \return The current node's property.
+			 */
+			NodeProperty const& getProperty() const;
+
+		protected:
+			/*! \brief The id of the node to reference.
+			 */
+			size_t const id;
+
+			/*! \brief The first adjacent id of the node.
+			 */
+			size_t const* connectionsBegin;
+
+			/*! \brief One past the last adjacent id of the node.
+			 */
+			size_t const* connectionsEnd;
+
+			/*! \brief The name of the node to refer.
+			 */
+			std::string const name;
+
+			/*! \brief The properties vector of the parent Graph.
+			 */
+			std::vector<NodeProperty> const& property;
+		};
+	}
+}
+
+#include "csr_node.tcc"
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "csr_node.hpp"
+
+#include <algorithm>
+
+namespace graph {
+	namespace csr {
+
+		template <typename NodeProperty>
+		ConstNode<NodeProperty>::ConstNode(size_t id,
+		                                   size_t const* connectionsBegin,
+		                                   size_t const* connectionsEnd,
+		                                   std::string name,
+		                                   std::vector<NodeProperty> const& property)
+		      : id(id)
+		      , connectionsBegin(connectionsBegin)
+		      , connectionsEnd(connectionsEnd)
+		      , name(std::move(name))
+		      , property(property) {}
+
+		template <typename NodeProperty>
+		bool ConstNode<NodeProperty>::operator==(ConstNode const& other) const {
+			return name == other.name;
+		}
+
+		template <typename NodeProperty>
+		bool ConstNode<NodeProperty>::operator<(ConstNode const& other) const {
+			return id < other.id;
+		}
+
+		template <typename NodeProperty>
+		bool ConstNode<NodeProperty>::isConnectedTo(ConstNode const& other) const {
+			return std::find(connectionsBegin, connectionsEnd, other.getId()) != connectionsEnd;
+		}
+
+		template <typename NodeProperty>
+		size_t ConstNode<NodeProperty>::getId() const {
+			return id;
+		}
+
+		template <typename NodeProperty>
+		std::string ConstNode<NodeProperty>::getName() const {
+			return name;
+		}
+
+		template <typename NodeProperty>
+		std::vector<size_t> ConstNode<NodeProperty>::getConnections() const {
+			return std::vector<size_t>(connectionsBegin, connectionsEnd);
+		}
+
+		template <typename NodeProperty>
+		auto ConstNode<NodeProperty>::getProperty() const -> NodeProperty const& {
+			return property[id];
+		}
+
+		template <typename NodeProperty>
+		template <typename Graph>
+		ConstNode<NodeProperty>::ConstNode(NodeRef<Graph> const& node)
+		      : ConstNode(node.getGraph().getNode(node.getId())) {}
+	}
+}
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "properties.hpp"
+
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+namespace graph {
+
+	/*! \brief The properties of the edges starting from a given node.
+	 *
+	 * The properties are stored in the same order as the adjacents of the node, so that the
+	 * property of the edge to the i-th adjacent is the i-th property.
+	 */
+	template <typename EdgeProperty>
+	class AdjacentProperties {
+	public:
+		/*! \brief Add the property of a new last adjacent.
+		 *
+		 * \param property The property to add.
+		 */
+		void push_back(EdgeProperty property) {
+			properties.push_back(std::move(property));
+		}
+
+		/*! \brief Remove the property of an adjacent, by replacing it with the last one.
+		 *
+		 * \param position The position of the adjacent.
+		 */
+		void swapAndPop(size_t position) {
+			properties[position] = std::move(properties.back());
+			properties.pop_back();
+		}
+
+		/*! \brief Get the property of an adjacent.
+		 *
+		 * \param position The position of the adjacent.
+		 */
+		EdgeProperty const& get(size_t position) const {
+			return properties[position];
+		}
+
+		/*! \brief Set the property of an adjacent.
+		 *
+		 * \param position The position of the adjacent.
+		 * \param property The property to set.
+		 */
+		void set(size_t position, EdgeProperty property) {
+			properties[position] = std::move(property);
+		}
+
+	protected:
+		/*! \brief The property of each adjacent.
+		 */
+		std::vector<EdgeProperty> properties;
+	};
+
+	/*! \brief The properties of the edges starting from a given node, when edges have no
+	 *         properties.
+	 *
+	 * Nothing is stored.
+	 */
+	template <>
+	class AdjacentProperties<NoProperty> {
+	public:
+		/*! \brief Do nothing.
+		 */
+		void push_back(NoProperty) {}
+
+		/*! \brief Do nothing.
+		 */
+		void swapAndPop(size_t) {}
+
+		/*! \brief Get an empty property.
+		 */
+		NoProperty get(size_t) const {
+			return NoProperty();
+		}
+
+		/*! \brief Do nothing.
+		 */
+		void set(size_t, NoProperty) {}
+	};
+
+	/*! \brief The properties of the edges of a graph, indexed by the ids of their nodes.
+	 *
+	 * Only the existing edges have a stored property, which makes it suitable for graphs where
+	 * the existence of the edges is known by other means (for example an adjacency matrix).
+	 */
+	template <typename EdgeProperty>
+	class EdgePropertyMap {
+	public:
+		/*! \brief Get the property of an edge.
+		 *
+		 * \warning The edge must have a property.
+		 *
+		 * \param beginId The id of the start of the edge.
+		 * \param endId The id of the end of the edge.
+		 */
+		EdgeProperty const& get(size_t beginId, size_t endId) const {
+			return properties.find({beginId, endId})->second;
+		}
+
+		/*! \brief Set the property of an edge.
+		 *
+		 * \param beginId The id of the start of the edge.
+		 * \param endId The id of the end of the edge.
+		 * \param property The property to set.
+		 */
+		void set(size_t beginId, size_t endId, EdgeProperty property) {
+			properties[{beginId, endId}] = std::move(property);
+		}
+
+		/*! \brief Remove the property of an edge.
+		 *
+		 * \param beginId The id of the start of the edge.
+		 * \param endId The id of the end of the edge.
+		 */
+		void erase(size_t beginId, size_t endId) {
+			properties.erase({beginId, endId});
+		}
+
+		/*! \brief Change the ids of the nodes.
+		 *
+		 * \param newIds The new id of each node, or `static_cast<size_t>(-1)` to remove the
+		 *               properties of the edges of a node.
+		 */
+		void renumber(std::vector<size_t> const& newIds) {
+			size_t const removed = static_cast<size_t>(-1);
+
+			decltype(properties) result;
+			result.reserve(properties.size());
+
+			for(auto& edge : properties) {
+				size_t beginId = newIds[edge.first.first], endId = newIds[edge.first.second];
+				if(beginId != removed && endId != removed) {
+					result.emplace(Key{beginId, endId}, std::move(edge.second));
+				}
+			}
+
+			properties.swap(result);
+		}
+
+	protected:
+		/*! \brief The ids of the start and of the end of an edge.
+		 */
+		using Key = std::pair<size_t, size_t>;
+
+		/*! \brief Hash the ids of an edge.
+		 */
+		struct KeyHash {
+			/*! \brief Hash the ids of an edge.
+			 *
+			 * \param key The ids of the edge.
+			 */
+			size_t operator()(Key const& key) const {
+				std::hash<size_t> hash;
+				size_t seed = hash(key.first);
+				seed ^= hash(key.second) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+				return seed;
+			}
+		};
+
+		/*! \brief The property of each edge.
+		 */
+		std::unordered_map<Key, EdgeProperty, KeyHash> properties;
+	};
+
+	/*! \brief The properties of the edges of a graph, when edges have no properties.
+	 *
+	 * Nothing is stored.
+	 */
+	template <>
+	class EdgePropertyMap<NoProperty> {
+	public:
+		/*! \brief Get an empty property.
+		 */
+		NoProperty get(size_t, size_t) const {
+			return NoProperty();
+		}
+
+		/*! \brief Do nothing.
+		 */
+		void set(size_t, size_t, NoProperty) {}
+
+		/*! \brief Do nothing.
+		 */
+		void erase(size_t, size_t) {}
+
+		/*! \brief Do nothing.
+		 */
+		void renumber(std::vector<size_t> const&) {}
+	};
+}
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace graph {
+
+	/*! \brief A flow network built from a weighted graph, whose maximum flows are found with the
+	 *         push-relabel algorithm.
+	 *
+	 * The weight of each edge is its capacity. The network is a residual graph stored in
+	 * compressed sparse rows, as in csr::Graph: each edge gives a forward arc and a reverse arc,
+	 * each one knowing the position of the other, so that a push updates both in constant time.
+	 *
+	 * A search first computes a maximum preflow, then sends the excess of the vertices which
+	 * cannot reach the sink back to the source. Both phases discharge the active vertex of
+	 * highest label first, and use two heuristics:
+	 *  - the global relabeling, a breadth-first search from the target over the residual arcs
+	 *    which sets every label to the exact distance, done at the start and then periodically;
+	 *  - the gap heuristic: when no vertex has some label anymore, the vertices above it cannot
+	 *    reach the target and are set aside.
+	 *
+	 * The network keeps the flow of its last search, and can be searched again for other
+	 * vertices without being built again.
+	 *
+	 * \tparam Capacity The type of the capacities of the edges.
+	 */
+	template <typename Capacity>
+	class FlowNetwork {
+	public:
+		/*! \brief The position of the arcs of the edges which are self-loops.
+		 */
+		static constexpr size_t const noArc = static_cast<size_t>(-1);
+
+		/*! \brief Create an empty network.
+		 */
+		FlowNetwork() = default;
+
+		/*! \brief Build the network of a given graph.
+		 *
+		 * \param g The graph, with a `weight` in its edge property. The weights must not be
+		 *          negative.
+		 */
+		template <typename Graph>
+		explicit FlowNetwork(Graph const& g);
+
+		/*! \brief Get one past the greatest id of the network.
+		 */
+		size_t getIdBound() const;
+
+		/*! \brief Get the number of edges of the graph the network was built from.
+		 */
+		size_t getEdgesCount() const;
+
+		/*! \brief Find a maximum flow between two vertices, and a minimum cut.
+		 *
+		 * \param sourceId The id of the vertex the flow comes from.
+		 * \param sinkId The id of the vertex the flow goes to.
+		 * \return The value of the flow, which is also the capacity of the cut.
+		 * \exception std::invalid_argument If the source and the sink are the same vertex.
+		 */
+		Capacity maximumFlow(size_t sourceId, size_t sinkId);
+
+		/*! \brief Get the value of the flow found by the last search.
+		 */
+		Capacity getFlowValue() const;
+
+		/*! \brief Get the flow of an edge.
+		 *
+		 * \param edgeIndex The position of the edge in the edges() of the graph.
+		 */
+		Capacity getFlow(size_t edgeIndex) const;
+
+		/*! \brief Get the flow of each edge, in the order of the edges() of the graph.
+		 */
+		std::vector<Capacity> getFlows() const;
+
+		/*! \brief Check if a vertex is on the side of the source of the minimum cut.
+		 *
+		 * These are the vertices which the source can reach in the residual graph. Every edge
+		 * from them to the other side is saturated.
+		 *
+		 * \param id The id of the vertex.
+		 */
+		bool isOnSourceSide(size_t id) const;
+
+		/*! \brief Get the side of the minimum cut of each id, true for the side of the source.
+		 */
+		std::vector<bool> const& getSourceSide() const;
+
+	protected:
+		/*! \brief The end of the lists of vertices.
+		 */
+		static constexpr size_t const none = static_cast<size_t>(-1);
+
+		/*! \brief Find a maximum preflow to a target, or send the excess back to it.
+		 *
+		 * \param targetId The vertex the excess goes to.
+		 * \param excludedId The vertex which keeps its excess and is never relabeled.
+		 */
+		void runPhase(size_t targetId, size_t excludedId);
+
+		/*! \brief Set the label of every vertex to its distance to the target in the residual
+		 *         graph, and rebuild the buckets.
+		 *
+		 * \param targetId The vertex the excess goes to.
+		 * \param excludedId The vertex which keeps its excess and is never relabeled.
+		 */
+		void globalRelabel(size_t targetId, size_t excludedId);
+
+		/*! \brief Push the excess of a vertex along its admissible arcs, relabeling it until it
+		 *         has no excess or cannot reach the target.
+		 *
+		 * \param id The vertex.
+		 * \param targetId The vertex the excess goes to.
+		 * \param excludedId The vertex which keeps its excess and is never relabeled.
+		 * \return The work done, the number of arcs scanned by the relabels.
+		 */
+		size_t discharge(size_t id, size_t targetId, size_t excludedId);
+
+		/*! \brief Set aside the vertices whose label is above a label which no vertex has.
+		 *
+		 * \param label The empty label.
+		 */
+		void removeGap(size_t label);
+
+		/*! \brief Add a vertex to the bucket of its label.
+		 */
+		void addToBucket(size_t id);
+
+		/*! \brief Remove a vertex from the bucket of its label.
+		 */
+		void removeFromBucket(size_t id);
+
+		/*! \brief Add a vertex to the active vertices of its label.
+		 */
+		void pushActive(size_t id);
+
+		/*! \brief One past the greatest id.
+		 */
+		size_t idBound = 0;
+
+		/*! \brief The position of the first arc of each id, and the number of arcs.
+		 */
+		std::vector<size_t> offsets;
+
+		/*! \brief The end of each arc.
+		 */
+		std::vector<std::uint32_t> heads;
+
+		/*! \brief The position of the arc in the opposite direction of each arc.
+		 */
+		std::vector<size_t> pairs;
+
+		/*! \brief The capacity of each arc, 0 for the reverse arcs.
+		 */
+		std::vector<Capacity> capacities;
+
+		/*! \brief The residual capacity of each arc.
+		 */
+		std::vector<Capacity> residuals;
+
+		/*! \brief The position of the forward arc of each edge, or noArc.
+		 */
+		std::vector<size_t> edgeArcs;
+
+		/*! \brief The value of the flow of the last search.
+		 */
+		Capacity flowValue{};
+
+		/*! \brief The side of the minimum cut of each id.
+		 */
+		std::vector<bool> sourceSide;
+
+		/*! \brief The flow entering each vertex minus the flow leaving it.
+		 */
+		std::vector<Capacity> excesses;
+
+		/*! \brief The label of each vertex, a lower bound of its distance to the target, or
+		 *         idBound when it cannot reach it.
+		 */
+		std::vector<size_t> labels;
+
+		/*! \brief The next arc to look at when discharging each vertex.
+		 */
+		std::vector<size_t> currentArcs;
+
+		/*! \brief The first vertex of each label, whose vertices are in a doubly linked list.
+		 */
+		std::vector<size_t> bucketFirsts;
+
+		/*! \brief The next vertex with the same label.
+		 */
+		std::vector<size_t> bucketNexts;
+
+		/*! \brief The previous vertex with the same label.
+		 */
+		std::vector<size_t> bucketPrevious;
+
+		/*! \brief The first active vertex of each label, whose active vertices are in a stack.
+		 */
+		std::vector<size_t> activeFirsts;
+
+		/*! \brief The next active vertex with the same label.
+		 */
+		std::vector<size_t> activeNexts;
+
+		/*! \brief The greatest label of a vertex in a bucket.
+		 */
+		size_t highestLabel = 0;
+
+		/*! \brief An upper bound of the greatest label of an active vertex.
+		 */
+		size_t highestActive = 0;
+	};
+
+	/*! \brief A maximum flow between two vertices of a graph, as given by maximumFlow().
+	 *
+	 * \tparam Capacity The type of the capacities of the edges.
+	 */
+	template <typename Capacity>
+	struct MaximumFlow {
+		/*! \brief The value of the flow.
+		 */
+		Capacity value{};
+
+		/*! \brief The flow of each edge, in the order of the edges() of the graph.
+		 */
+		std::vector<Capacity> flows;
+
+		/*! \brief The side of a minimum cut of each id, true for the side of the source.
+		 */
+		std::vector<bool> sourceSide;
+	};
+
+	/*! \brief Find a maximum flow and a minimum cut between two vertices of a graph.
+	 *
+	 * \param g The graph, with a `weight` in its edge property which is the capacity of the
+	 *          edge. The weights must not be negative.
+	 * \param sourceId The id of the vertex the flow comes from.
+	 * \param sinkId The id of the vertex the flow goes to.
+	 * \return The value of the flow, the flow of each edge and the side of each vertex.
+	 * \exception std::invalid_argument If the source and the sink are the same vertex.
+	 * \sa FlowNetwork
+	 */
+	template <typename Graph>
+	auto maximumFlow(Graph const& g, size_t sourceId, size_t sinkId);
+}
+
+#include "flow_network.tcc"
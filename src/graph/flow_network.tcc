@@ -0,0 +1,309 @@
+#pragma once
+
+#include "flow_network.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+namespace graph {
+
+	template <typename Capacity>
+	template <typename Graph>
+	FlowNetwork<Capacity>::FlowNetwork(Graph const& g)
+	      : idBound(g.getIdBound())
+	      , offsets(g.getIdBound() + 1, 0)
+	      , sourceSide(g.getIdBound(), false) {
+		using NodeRef = typename Graph::NodeRef_t;
+
+		// Each edge gives an arc from its beginning and an arc from its end.
+		for(auto [begin, end] : g.edges()) {
+			if(begin.getId() != end.getId()) {
+				++offsets[begin.getId() + 1];
+				++offsets[end.getId() + 1];
+			}
+		}
+		for(size_t id = 0; id < idBound; ++id) {
+			offsets[id + 1] += offsets[id];
+		}
+
+		size_t arcsCount = offsets[idBound];
+		heads.resize(arcsCount);
+		pairs.resize(arcsCount);
+		capacities.resize(arcsCount, Capacity());
+		edgeArcs.reserve(g.getEdgesCount());
+		std::vector<size_t> positions(offsets.begin(), offsets.end() - 1);
+		for(auto vertex : g.vertices()) {
+			size_t beginId = vertex.getId();
+			g.eachAdjacentEdges(vertex, [&](NodeRef end, auto const& property) {
+				size_t endId = end.getId();
+				if(beginId == endId) {
+					// A self-loop never carries any flow.
+					edgeArcs.push_back(noArc);
+					return;
+				}
+
+				size_t forward      = positions[beginId]++;
+				size_t backward     = positions[endId]++;
+				heads[forward]      = static_cast<std::uint32_t>(endId);
+				heads[backward]     = static_cast<std::uint32_t>(beginId);
+				pairs[forward]      = backward;
+				pairs[backward]     = forward;
+				capacities[forward] = property.weight;
+				edgeArcs.push_back(forward);
+			});
+		}
+		residuals = capacities;
+	}
+
+	template <typename Capacity>
+	size_t FlowNetwork<Capacity>::getIdBound() const {
+		return idBound;
+	}
+
+	template <typename Capacity>
+	size_t FlowNetwork<Capacity>::getEdgesCount() const {
+		return edgeArcs.size();
+	}
+
+	template <typename Capacity>
+	Capacity FlowNetwork<Capacity>::maximumFlow(size_t sourceId, size_t sinkId) {
+		if(sourceId == sinkId) {
+			throw std::invalid_argument("The source and the sink must be different vertices.");
+		}
+
+		residuals = capacities;
+		excesses.assign(idBound, Capacity());
+		labels.assign(idBound, idBound);
+		currentArcs.assign(offsets.begin(), offsets.end() - 1);
+		bucketFirsts.assign(idBound, none);
+		bucketNexts.assign(idBound, none);
+		bucketPrevious.assign(idBound, none);
+		activeFirsts.assign(idBound, none);
+		activeNexts.assign(idBound, none);
+
+		// The preflow starts with every arc from the source saturated.
+		for(size_t arc = offsets[sourceId]; arc < offsets[sourceId + 1]; ++arc) {
+			Capacity amount = residuals[arc];
+			if(amount > Capacity()) {
+				residuals[arc] = Capacity();
+				residuals[pairs[arc]] += amount;
+				excesses[heads[arc]] += amount;
+				excesses[sourceId] -= amount;
+			}
+		}
+
+		runPhase(sinkId, sourceId);
+		flowValue = excesses[sinkId];
+		runPhase(sourceId, sinkId);
+
+		// The source side of the cut is what the source can still reach.
+		sourceSide.assign(idBound, false);
+		sourceSide[sourceId] = true;
+		std::vector<size_t> queue{sourceId};
+		for(size_t i = 0; i < queue.size(); ++i) {
+			for(size_t arc = offsets[queue[i]]; arc < offsets[queue[i] + 1]; ++arc) {
+				if(residuals[arc] > Capacity() && !sourceSide[heads[arc]]) {
+					sourceSide[heads[arc]] = true;
+					queue.push_back(heads[arc]);
+				}
+			}
+		}
+		return flowValue;
+	}
+
+	template <typename Capacity>
+	Capacity FlowNetwork<Capacity>::getFlowValue() const {
+		return flowValue;
+	}
+
+	template <typename Capacity>
+	Capacity FlowNetwork<Capacity>::getFlow(size_t edgeIndex) const {
+		size_t arc = edgeArcs[edgeIndex];
+		return arc == noArc ? Capacity() : capacities[arc] - residuals[arc];
+	}
+
+	template <typename Capacity>
+	std::vector<Capacity> FlowNetwork<Capacity>::getFlows() const {
+		std::vector<Capacity> flows(edgeArcs.size());
+		for(size_t edgeIndex = 0; edgeIndex < edgeArcs.size(); ++edgeIndex) {
+			flows[edgeIndex] = getFlow(edgeIndex);
+		}
+		return flows;
+	}
+
+	template <typename Capacity>
+	bool FlowNetwork<Capacity>::isOnSourceSide(size_t id) const {
+		return sourceSide[id];
+	}
+
+	template <typename Capacity>
+	std::vector<bool> const& FlowNetwork<Capacity>::getSourceSide() const {
+		return sourceSide;
+	}
+
+	template <typename Capacity>
+	void FlowNetwork<Capacity>::runPhase(size_t targetId, size_t excludedId) {
+		// The global relabeling is done again once the relabels have scanned about as many
+		// arcs as it does.
+		size_t const relabelingWork = 6 * idBound + heads.size();
+
+		globalRelabel(targetId, excludedId);
+		size_t work = 0;
+		while(true) {
+			while(highestActive > 0 && activeFirsts[highestActive] == none) {
+				--highestActive;
+			}
+			size_t id = activeFirsts[highestActive];
+			if(id == none) {
+				return;
+			}
+			activeFirsts[highestActive] = activeNexts[id];
+
+			work += discharge(id, targetId, excludedId);
+			if(work > relabelingWork) {
+				globalRelabel(targetId, excludedId);
+				work = 0;
+			}
+		}
+	}
+
+	template <typename Capacity>
+	void FlowNetwork<Capacity>::globalRelabel(size_t targetId, size_t excludedId) {
+		std::fill(labels.begin(), labels.end(), idBound);
+		std::fill(bucketFirsts.begin(), bucketFirsts.end(), none);
+		std::fill(activeFirsts.begin(), activeFirsts.end(), none);
+		highestLabel  = 0;
+		highestActive = 0;
+
+		// A breadth-first search from the target, going up the arcs with a residual capacity.
+		// The target is not in the buckets, so the bucket of label 0 stays empty.
+		labels[targetId] = 0;
+		std::vector<size_t> queue{targetId};
+		for(size_t i = 0; i < queue.size(); ++i) {
+			size_t id = queue[i];
+			for(size_t arc = offsets[id]; arc < offsets[id + 1]; ++arc) {
+				size_t otherId = heads[arc];
+				if(labels[otherId] == idBound && otherId != excludedId &&
+				   residuals[pairs[arc]] > Capacity()) {
+					labels[otherId]      = labels[id] + 1;
+					currentArcs[otherId] = offsets[otherId];
+					addToBucket(otherId);
+					if(excesses[otherId] > Capacity()) {
+						pushActive(otherId);
+					}
+					queue.push_back(otherId);
+				}
+			}
+		}
+	}
+
+	template <typename Capacity>
+	size_t FlowNetwork<Capacity>::discharge(size_t id, size_t targetId, size_t excludedId) {
+		// The cost of a relabel besides the arcs it scans.
+		size_t const relabelCost = 12;
+
+		size_t work = 0;
+		size_t last = offsets[id + 1];
+		while(true) {
+			for(size_t& arc = currentArcs[id]; arc < last; ++arc) {
+				size_t headId = heads[arc];
+				if(residuals[arc] > Capacity() && labels[id] == labels[headId] + 1) {
+					Capacity amount = std::min(excesses[id], residuals[arc]);
+					residuals[arc] -= amount;
+					residuals[pairs[arc]] += amount;
+					if(excesses[headId] == Capacity() && headId != targetId &&
+					   headId != excludedId) {
+						pushActive(headId);
+					}
+					excesses[headId] += amount;
+					excesses[id] -= amount;
+					if(excesses[id] == Capacity()) {
+						return work;
+					}
+				}
+			}
+
+			// Every arc is saturated or goes up: the vertex goes just above its lowest
+			// neighbour.
+			size_t oldLabel = labels[id], newLabel = idBound, newArc = last;
+			for(size_t arc = offsets[id]; arc < last; ++arc) {
+				if(residuals[arc] > Capacity() && labels[heads[arc]] + 1 < newLabel) {
+					newLabel = labels[heads[arc]] + 1;
+					newArc   = arc;
+				}
+			}
+			work += relabelCost + last - offsets[id];
+
+			removeFromBucket(id);
+			if(bucketFirsts[oldLabel] == none) {
+				labels[id] = idBound;
+				removeGap(oldLabel);
+				return work;
+			}
+			labels[id] = newLabel;
+			if(newLabel >= idBound) {
+				return work;
+			}
+			currentArcs[id] = newArc;
+			addToBucket(id);
+		}
+	}
+
+	template <typename Capacity>
+	void FlowNetwork<Capacity>::removeGap(size_t label) {
+		for(size_t above = label + 1; above <= highestLabel; ++above) {
+			for(size_t id = bucketFirsts[above]; id != none; id = bucketNexts[id]) {
+				labels[id] = idBound;
+			}
+			bucketFirsts[above] = none;
+			activeFirsts[above] = none;
+		}
+		highestLabel  = label;
+		highestActive = std::min(highestActive, label);
+	}
+
+	template <typename Capacity>
+	void FlowNetwork<Capacity>::addToBucket(size_t id) {
+		size_t label       = labels[id];
+		bucketPrevious[id] = none;
+		bucketNexts[id]    = bucketFirsts[label];
+		if(bucketFirsts[label] != none) {
+			bucketPrevious[bucketFirsts[label]] = id;
+		}
+		bucketFirsts[label] = id;
+		highestLabel        = std::max(highestLabel, label);
+	}
+
+	template <typename Capacity>
+	void FlowNetwork<Capacity>::removeFromBucket(size_t id) {
+		if(bucketPrevious[id] == none) {
+			bucketFirsts[labels[id]] = bucketNexts[id];
+		} else {
+			bucketNexts[bucketPrevious[id]] = bucketNexts[id];
+		}
+		if(bucketNexts[id] != none) {
+			bucketPrevious[bucketNexts[id]] = bucketPrevious[id];
+		}
+	}
+
+	template <typename Capacity>
+	void FlowNetwork<Capacity>::pushActive(size_t id) {
+		size_t label        = labels[id];
+		activeNexts[id]     = activeFirsts[label];
+		activeFirsts[label] = id;
+		highestActive       = std::max(highestActive, label);
+	}
+
+	template <typename Graph>
+	auto maximumFlow(Graph const& g, size_t sourceId, size_t sinkId) {
+		using Capacity = std::decay_t<decltype(g.getEdgeProperty(sourceId, sinkId).weight)>;
+
+		FlowNetwork<Capacity> network(g);
+		MaximumFlow<Capacity> result;
+		result.value      = network.maximumFlow(sourceId, sinkId);
+		result.flows      = network.getFlows();
+		result.sourceSide = network.getSourceSide();
+		return result;
+	}
+}
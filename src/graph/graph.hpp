@@ -7,4 +7,5 @@ namespace graph {
 
 #include "matrix_graph.hpp"
 #include "list_graph.hpp"
+#include "csr_graph.hpp"
 #include "printing.hpp"
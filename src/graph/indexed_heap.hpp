@@ -0,0 +1,264 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+namespace graph {
+
+	/*! \brief A d-ary min-heap of ids with a key each, which can decrease the key of an id in
+	 *         place.
+	 *
+	 * The position of each id in the heap is stored in an array indexed by the ids, so the ids
+	 * must be lower than the bound given at construction or by reset(), and each id can be in
+	 * the heap only once. Looking up an id is done in constant time, and decreasing its key in
+	 * a time logarithmic in the size of the heap.
+	 *
+	 * A wider heap (Arity > 2) is shallower, which makes decrease() cheaper and keeps the
+	 * children of a node in a single cache line.
+	 *
+	 * The heap can be cleared and reused for another search without releasing its memory, in a
+	 * time linear in the number of ids left in it.
+	 *
+	 * \tparam Key The type of the keys.
+	 * \tparam Arity The number of children of each node of the heap.
+	 * \tparam Compare The order of the keys, the top of the heap is the lowest key.
+	 */
+	template <typename Key, size_t Arity = 4, typename Compare = std::less<Key>>
+	class IndexedHeap {
+		static_assert(Arity >= 2, "The heap needs at least two children per node");
+
+	public:
+		/*! \brief The position of the ids which are not in the heap.
+		 */
+		static constexpr size_t const npos = static_cast<size_t>(-1);
+
+		/*! \brief Create an empty heap.
+		 *
+		 * \param idBound One past the greatest id which can be pushed.
+		 * \param compare The order of the keys.
+		 */
+		explicit IndexedHeap(size_t idBound = 0, Compare compare = Compare())
+		      : positions(idBound, npos)
+		      , compare(std::move(compare)) {}
+
+		/*! \brief Remove every id and change the bound of the ids.
+		 *
+		 * \param idBound One past the greatest id which can be pushed.
+		 */
+		void reset(size_t idBound) {
+			clear();
+			positions.resize(idBound, npos);
+		}
+
+		/*! \brief Remove every id.
+		 */
+		void clear() {
+			for(auto const& entry : entries) {
+				positions[entry.id] = npos;
+			}
+			entries.clear();
+		}
+
+		/*! \brief Get the number of ids in the heap.
+		 */
+		size_t size() const {
+			return entries.size();
+		}
+
+		/*! \brief Check if the heap has no ids.
+		 */
+		bool empty() const {
+			return entries.empty();
+		}
+
+		/*! \brief Check if an id is in the heap.
+		 *
+		 * \param id The id to look for.
+		 */
+		bool contains(size_t id) const {
+			return positions[id] != npos;
+		}
+
+		/*! \brief Get the key of an id of the heap.
+		 *
+		 * \param id The id, which must be in the heap.
+		 */
+		Key const& getKey(size_t id) const {
+			return entries[positions[id]].key;
+		}
+
+		/*! \brief Get the id with the lowest key.
+		 */
+		size_t top() const {
+			return entries.front().id;
+		}
+
+		/*! \brief Get the lowest key.
+		 */
+		Key const& topKey() const {
+			return entries.front().key;
+		}
+
+		/*! \brief Add an id to the heap.
+		 *
+		 * \param id The id, which must not be in the heap.
+		 * \param key The key of the id.
+		 */
+		void push(size_t id, Key key) {
+			positions[id] = entries.size();
+			entries.push_back(Entry{std::move(key), id});
+			siftUp(entries.size() - 1);
+		}
+
+		/*! \brief Decrease the key of an id of the heap.
+		 *
+		 * \param id The id, which must be in the heap.
+		 * \param key The new key, which must not be greater than the current one.
+		 */
+		void decrease(size_t id, Key key) {
+			size_t position       = positions[id];
+			entries[position].key = std::move(key);
+			siftUp(position);
+		}
+
+		/*! \brief Change the key of an id of the heap, in either direction.
+		 *
+		 * \param id The id, which must be in the heap.
+		 * \param key The new key.
+		 */
+		void update(size_t id, Key key) {
+			size_t position       = positions[id];
+			bool increased        = compare(entries[position].key, key);
+			entries[position].key = std::move(key);
+			if(increased) {
+				siftDown(position);
+			} else {
+				siftUp(position);
+			}
+		}
+
+		/*! \brief Add an id to the heap, or decrease its key if it is in the heap with a greater
+		 *         key.
+		 *
+		 * \param id The id.
+		 * \param key The key of the id.
+		 * \return true if the id was added or its key decreased.
+		 */
+		bool pushOrDecrease(size_t id, Key key) {
+			if(!contains(id)) {
+				push(id, std::move(key));
+				return true;
+			}
+			if(compare(key, getKey(id))) {
+				decrease(id, std::move(key));
+				return true;
+			}
+			return false;
+		}
+
+		/*! \brief Remove the id with the lowest key.
+		 *
+		 * \return The removed id.
+		 */
+		size_t pop() {
+			size_t id     = entries.front().id;
+			positions[id] = npos;
+
+			if(entries.size() > 1) {
+				entries.front()               = std::move(entries.back());
+				positions[entries.front().id] = 0;
+				entries.pop_back();
+				siftDown(0);
+			} else {
+				entries.pop_back();
+			}
+
+			return id;
+		}
+
+	protected:
+		/*! \brief An id in the heap, with its key.
+		 */
+		struct Entry {
+			/*! \brief The key of the id.
+			 */
+			Key key;
+
+			/*! \brief The id.
+			 */
+			size_t id;
+		};
+
+		/*! \brief Move an entry up until its parent has a lower key.
+		 *
+		 * \param position The position of the entry.
+		 */
+		void siftUp(size_t position) {
+			Entry entry = std::move(entries[position]);
+			while(position > 0) {
+				size_t parent = (position - 1) / Arity;
+				if(!compare(entry.key, entries[parent].key)) {
+					break;
+				}
+				place(position, std::move(entries[parent]));
+				position = parent;
+			}
+			place(position, std::move(entry));
+		}
+
+		/*! \brief Move an entry down until its children have greater keys.
+		 *
+		 * \param position The position of the entry.
+		 */
+		void siftDown(size_t position) {
+			Entry entry = std::move(entries[position]);
+			while(true) {
+				size_t firstChild = position * Arity + 1;
+				if(firstChild >= entries.size()) {
+					break;
+				}
+
+				size_t lastChild = std::min(firstChild + Arity, entries.size());
+				size_t best      = firstChild;
+				for(size_t child = firstChild + 1; child < lastChild; ++child) {
+					if(compare(entries[child].key, entries[best].key)) {
+						best = child;
+					}
+				}
+
+				if(!compare(entries[best].key, entry.key)) {
+					break;
+				}
+				place(position, std::move(entries[best]));
+				position = best;
+			}
+			place(position, std::move(entry));
+		}
+
+		/*! \brief Store an entry at a given position and update the position of its id.
+		 *
+		 * \param position The position of the entry.
+		 * \param entry The entry.
+		 */
+		void place(size_t position, Entry entry) {
+			positions[entry.id] = position;
+			entries[position]   = std::move(entry);
+		}
+
+		/*! \brief The entries of the heap, in the order of a d-ary heap.
+		 */
+		std::vector<Entry> entries;
+
+		/*! \brief The position of each id in the entries, or npos.
+		 */
+		std::vector<size_t> positions;
+
+		/*! \brief The order of the keys.
+		 */
+		Compare compare;
+	};
+}
@@ -1,14 +1,17 @@
 #pragma once
 
 #include "edge.hpp"
+#include "edge_properties.hpp"
 #include "list_node.hpp"
+#include "name_interner.hpp"
+#include "node_range.hpp"
 #include "properties.hpp"
+#include "removal_mode.hpp"
 #include "utility.hpp"
 
-#include <list>
-#include <map>
 #include <ostream>
 #include <set>
+#include <string_view>
 #include <vector>
 
 #include <cstddef>
@@ -36,6 +39,22 @@ namespace graph {
 			 */
 			using ConstNode_t = ConstNode<NodeProperty>;
 
+			/*! \brief The lightweight node handle given by the iteration functions.
+			 */
+			using NodeRef_t   = NodeRef<Graph>;
+
+			/*! \brief The range of vertices returned by vertices().
+			 */
+			using VertexRange_t   = IteratorRange<VertexIterator<Graph>>;
+
+			/*! \brief The range of adjacents returned by adjacents().
+			 */
+			using AdjacentRange_t = IteratorRange<AdjacentIterator<Graph, size_t const*>>;
+
+			/*! \brief The range of edges returned by edges().
+			 */
+			using EdgeRange_t     = IteratorRange<EdgeIterator<Graph>>;
+
 			/*! \brief Create an empty graph
 			 */
 			Graph() = default;
@@ -57,32 +76,66 @@ namespace graph {
 			 *
 			 * \param nodeName The name of the node.
 			 */
-			bool hasNode(std::string const& nodeName) const;
+			bool hasNode(std::string_view nodeName) const;
 
 			/*! \brief Add a node to the graph.
 			 *
 			 * \param nodeName The name of the node to add.
 			 * \param property The property of the node to add.
 			 */
-			void addNode(std::string const& nodeName, NodeProperty property);
+			void addNode(std::string_view nodeName, NodeProperty property);
 
 			/*! \brief Add a node to the graph.
 			 *
 			 * \param nodeName The name of the node to add.
 			 */
-			void addNode(std::string const& nodeName);
+			void addNode(std::string_view nodeName);
 
 			/*! \brief Remove a node from the graph.
 			 *
-			 * \warning This will invalidate every ConstNode or Node object from the graph that have
-			 *          an id greater than the node to be removed.
+			 * With RemovalMode::Tombstone, the ids of the other nodes do not change, and the id of
+			 * the removed node may be given to a node added later.
 			 *
-			 * \exception std::out_of_range If the node is not in the graph.
+			 * \warning With RemovalMode::Renumber, this will invalidate every ConstNode or Node
+			 *          object from the graph that have an id greater than the node to be removed.
 			 *
 			 * \param node The node to remove.
 			 */
 			void removeNode(ConstNode_t const& node);
 
+			/*! \brief Choose how removeNode() removes the nodes.
+			 *
+			 * \param mode The removal mode, RemovalMode::Renumber by default.
+			 */
+			void setRemovalMode(RemovalMode mode);
+
+			/*! \brief Get how removeNode() removes the nodes.
+			 */
+			RemovalMode getRemovalMode() const;
+
+			/*! \brief Choose whether the graph keeps an index of the incoming edges of each node.
+			 *
+			 * The index is updated with every change of the graph, which makes eachPredecessors()
+			 * as fast as eachAdjacents(). Enabling it builds it in a time linear in the size of
+			 * the graph, disabling it frees it.
+			 *
+			 * \param enabled Whether the index is kept, it is not by default.
+			 */
+			void setReverseIndex(bool enabled);
+
+			/*! \brief Check if the graph keeps an index of the incoming edges of each node.
+			 */
+			bool hasReverseIndex() const;
+
+			/*! \brief Renumber the nodes so that their ids are dense again, keeping their order.
+			 *
+			 * This is only needed after removing nodes with RemovalMode::Tombstone, and takes a
+			 * time linear in the size of the graph.
+			 *
+			 * \warning This will invalidate every ConstNode or Node object from the graph.
+			 */
+			void compact();
+
 			/*! \brief Check if an edge exists between two nodes.
 			 *
 			 * \param begin The start of the edge.
@@ -128,6 +181,9 @@ namespace graph {
 			void connect(ConstNode_t const& begin, ConstNode_t const& end);
 
 			/*! \brief Remove an edge from the graph.
+			 *
+			 * The removal takes constant time once the edge is found, but changes the order of the
+			 * adjacents of the start of the edge.
 			 *
 			 * \exception std::out_of_range If the edge is not in the graph.
 			 *
@@ -143,6 +199,15 @@ namespace graph {
 			 */
 			EdgeProperty getEdgeProperty(ConstNode_t const& begin, ConstNode_t const& end) const;
 
+			/*! \brief Get the property of a given edge.
+			 *
+			 * \exception std::out_of_range If the edge is not in the graph.
+			 *
+			 * \param beginId The id of the node at the start of the edge.
+			 * \param endId The id of the node at the end of the edge.
+			 */
+			EdgeProperty getEdgeProperty(size_t beginId, size_t endId) const;
+
 			/*! \brief Set the property of the given edge.
 			 *
 			 * \param begin The node at the start of the edge.
@@ -153,9 +218,14 @@ namespace graph {
 			                     ConstNode_t const& end,
 			                     EdgeProperty property);
 
-			/*! \brief Get the matrix of connections for this graph.
+			/*! \brief Get the adjacents of every nodes of this graph.
+			 *
+			 * After a removal with RemovalMode::Tombstone, the adjacents may contain the id of a
+			 * removed node until compact() is called, these can be skipped with hasNodeId().
+			 *
+			 * \warning The view is invalidated when the graph is modified.
 			 */
-			std::vector<std::list<size_t>> getConnections() const;
+			ConnectionsView getConnections() const;
 
 			/*! \brief Get the number of vertices in the graph.
 			 *
@@ -169,9 +239,45 @@ namespace graph {
 			 */
 			size_t getEdgesCount() const;
 
+			/*! \brief Get one past the greatest id of a node of the graph.
+			 *
+			 * This is the size of an array indexed by node ids. It is equal to getVerticesCount()
+			 * unless some nodes were removed with RemovalMode::Tombstone since the last
+			 * compact().
+			 */
+			size_t getIdBound() const;
+
+			/*! \brief Check if a given id is the id of a node of the graph.
+			 *
+			 * \param nodeId The id to check.
+			 */
+			bool hasNodeId(size_t nodeId) const;
+
+			/*! \brief Get the name of the node with a given id.
+			 *
+			 * \warning The returned view is invalidated when a node is added or removed.
+			 *
+			 * \param nodeId The id of the node.
+			 */
+			std::string_view getName(size_t nodeId) const;
+
+			/*! \brief Get the property of the node with a given id.
+			 *
+			 * \param nodeId The id of the node.
+			 */
+			NodeProperty const& getNodeProperty(size_t nodeId) const;
+
+			/*! \brief Return a Node representing a node from this graph with a given id.
+			 *
+			 * \param nodeId The id of the node.
+			 * \return The Node representing the given node.
+			 */
+			ConstNode_t getNode(size_t nodeId) const;
+
 			/*! Call a given function for each vertices.
 			 *
-			 * The functor must be convertible to a function of type void(Node)
+			 * The functor must be convertible to a function of type void(NodeRef_t). A function
+			 * taking a ConstNode_t can also be used, but the node is then built for each call.
 			 *
 			 * \param functor the function to call
 			 */
@@ -180,7 +286,9 @@ namespace graph {
 
 			/*! Call a given function for each edges.
 			 *
-			 * The functor must be convertible to a function of type void(Node, Node)
+			 * The functor must be convertible to a function of type void(NodeRef_t, NodeRef_t).
+			 * A function taking ConstNode_t can also be used, but the nodes are then built for
+			 * each call.
 			 *
 			 * \param functor the function to call
 			 */
@@ -189,14 +297,130 @@ namespace graph {
 
 			/*! Call a given function for each vertices adjacent to the given edge.
 			 *
-			 * The functor must be convertible to a function of type void(Node)
+			 * The functor must be convertible to a function of type void(NodeRef_t). A function
+			 * taking a ConstNode_t can also be used, but the node is then built for each call.
+			 *
+			 * \param vertex the vertex from which to process the adjacents.
+			 * \param functor the function to call
+			 */
+			template <typename Functor>
+			void eachAdjacents(NodeRef_t vertex, Functor&& functor) const;
+
+			/*! Call a given function for each vertices adjacent to the given edge.
 			 *
 			 * \param vertex the vertex from which to process the adjacents.
 			 * \param functor the function to call
+			 * \sa eachAdjacents(NodeRef_t, Functor&&)
 			 */
 			template <typename Functor>
 			void eachAdjacents(ConstNode_t const& vertex, Functor&& functor) const;
 
+			/*! Call a given function for each edge starting from the given vertex.
+			 *
+			 * This gives the property of each edge along with its end, so that weighted
+			 * traversals do not look every edge up with getEdgeProperty().
+			 *
+			 * The functor must be convertible to a function of type
+			 * void(NodeRef_t, EdgeProperty const&).
+			 *
+			 * \param vertex the vertex from which to process the edges.
+			 * \param functor the function to call
+			 */
+			template <typename Functor>
+			void eachAdjacentEdges(NodeRef_t vertex, Functor&& functor) const;
+
+			/*! Call a given function for each edge starting from the given vertex.
+			 *
+			 * \param vertex the vertex from which to process the edges.
+			 * \param functor the function to call
+			 * \sa eachAdjacentEdges(NodeRef_t, Functor&&)
+			 */
+			template <typename Functor>
+			void eachAdjacentEdges(ConstNode_t const& vertex, Functor&& functor) const;
+
+			/*! Call a given function for each vertices which are the start of an edge to the
+			 *  given vertex.
+			 *
+			 * Without the index enabled by setReverseIndex(), this takes a time linear in
+			 * the size of the graph.
+			 *
+			 * The functor must be convertible to a function of type void(NodeRef_t).
+			 *
+			 * \param vertex the vertex from which to process the predecessors.
+			 * \param functor the function to call
+			 */
+			template <typename Functor>
+			void eachPredecessors(NodeRef_t vertex, Functor&& functor) const;
+
+			/*! Call a given function for each vertices which are the start of an edge to the
+			 *  given vertex.
+			 *
+			 * \param vertex the vertex from which to process the predecessors.
+			 * \param functor the function to call
+			 * \sa eachPredecessors(NodeRef_t, Functor&&)
+			 */
+			template <typename Functor>
+			void eachPredecessors(ConstNode_t const& vertex, Functor&& functor) const;
+
+			/*! Call a given function for each edge ending at the given vertex, with the start of
+			 *  the edge and its property.
+			 *
+			 * Each parallel edge is given with its own property. Without the index enabled by
+			 * setReverseIndex(), this takes a time linear in the size of the graph.
+			 *
+			 * The functor must be convertible to a function of type
+			 * void(NodeRef_t, EdgeProperty const&).
+			 *
+			 * \param vertex the vertex at the end of the edges.
+			 * \param functor the function to call
+			 */
+			template <typename Functor>
+			void eachPredecessorEdges(NodeRef_t vertex, Functor&& functor) const;
+
+			/*! Call a given function for each edge ending at the given vertex, with the start of
+			 *  the edge and its property.
+			 *
+			 * \param vertex the vertex at the end of the edges.
+			 * \param functor the function to call
+			 * \sa eachPredecessorEdges(NodeRef_t, Functor&&)
+			 */
+			template <typename Functor>
+			void eachPredecessorEdges(ConstNode_t const& vertex, Functor&& functor) const;
+
+			/*! \brief Get the vertices of the graph, in increasing order of ids.
+			 *
+			 * \warning The range is invalidated when the graph is modified.
+			 */
+			VertexRange_t vertices() const;
+
+			/*! \brief Get the edges of the graph, grouped by start vertex.
+			 *
+			 * Each edge is a pair of NodeRef_t, the start and the end of the edge.
+			 *
+			 * \warning The range is invalidated when the graph is modified.
+			 */
+			EdgeRange_t edges() const;
+
+			/*! \brief Get the adjacents of a given vertex.
+			 *
+			 * \warning The range is invalidated when the graph is modified.
+			 *
+			 * \param nodeId The id of the vertex.
+			 */
+			AdjacentRange_t adjacents(size_t nodeId) const;
+
+			/*! \brief Get the vertices which are the start of an edge to a given vertex.
+			 *
+			 * The range is read from the reverse index, see setReverseIndex(). Without it, the
+			 * predecessors can still be found with eachPredecessors().
+			 *
+			 * \warning The range is invalidated when the graph is modified.
+			 *
+			 * \param nodeId The id of the vertex.
+			 * \exception std::logic_error If the reverse index is not enabled.
+			 */
+			AdjacentRange_t predecessors(size_t nodeId) const;
+
 			/*! \brief Get the id of from the name of a node.
 			 *
 			 * If the node is not in the graph, it will be added.
@@ -204,7 +428,7 @@ namespace graph {
 			 * \param name The name of the node.
 			 * \return The id of the node.
 			 */
-			size_t getId(std::string const& name);
+			size_t getId(std::string_view name);
 
 			/*! \brief Get the id of from the name of a node.
 			 *
@@ -212,7 +436,7 @@ namespace graph {
 			 * \return The id of the node.
 			 * \exception std::out_of_range If the node is not in the graph.
 			 */
-			size_t getId(std::string const& name) const;
+			size_t getId(std::string_view name) const;
 
 			/*! \brief Get the first node of the graph.
 			 *
@@ -231,14 +455,14 @@ namespace graph {
 			 * \param nodeName The name of the node.
 			 * \return The Node representing the given node.
 			 */
-			Node_t operator[](std::string const& nodeName);
+			Node_t operator[](std::string_view nodeName);
 
 			/*! \brief Return a Node representing a node from this graph with a given name.
 			 *
 			 * \param nodeName The name of the node.
 			 * \return The Node representing the given node.
 			 */
-			ConstNode_t operator[](std::string const& nodeName) const;
+			ConstNode_t operator[](std::string_view nodeName) const;
 
 			/*! \brief Check if two graphs are equal.
 			 *
@@ -257,27 +481,91 @@ namespace graph {
 			bool operator!=(Graph<OtherNodeProperty, OtherEdgeProperty> const& other) const;
 
 		protected:
+			/*! \brief Get the position of an edge in the adjacents of its start.
+			 *
+			 * \param beginId The id of the node at the start of the edge.
+			 * \param endId The id of the node at the end of the edge.
+			 * \return The position of the edge, or the number of adjacents of the start if the
+			 *         edge is not in the graph.
+			 */
+			size_t findEdge(size_t beginId, size_t endId) const;
+
+			/*! \brief Get the id of the first node of the graph.
+			 */
+			size_t firstId() const;
+
+			/*! \brief Remove a node without changing the ids of the other nodes.
+			 *
+			 * \param nodeId The id of the node.
+			 */
+			void tombstoneNode(size_t nodeId);
+
+			/*! \brief Build the index of the incoming edges from the connections.
+			 */
+			void rebuildReverseIndex();
+
+			/*! \brief Find an edge in the index of the incoming edges.
+			 *
+			 * \param beginId The id of the node at the start of the edge.
+			 * \param endId The id of the node at the end of the edge.
+			 * \param position The position of the edge in the adjacents of its start.
+			 * \return The position of the edge in the incoming edges of its end, or their number
+			 *         if the edge is not in the index.
+			 */
+			size_t findReverseEdge(size_t beginId, size_t endId, size_t position) const;
+
+			/*! \brief Remove every edge to a node removed with tombstoneNode(), so that the ids of
+			 *         these nodes can be reused.
+			 */
+			void purgeRemovedEdges();
+
 			/*! \brief The matrix representing the connections in the graph.
 			 */
-			std::vector<std::list<size_t>> connections;
+			std::vector<Adjacents> connections;
 
 			/*! \brief The properties of each nodes.
 			 */
 			std::vector<NodeProperty> nodeProperties;
 
-			/*! \brief The properties of each edges.
+			/*! \brief The properties of each edges, in the same order as the connections.
 			 */
-			std::map<std::pair<std::string, std::string>, EdgeProperty> edgeProperties;
+			std::vector<AdjacentProperties<EdgeProperty>> edgeProperties;
 
 			/*! \brief The name of each nodes.
+			 *
+			 * This is also used for reverse looking up the name of a node from which we know its
+			 * id.
+			 */
+			NameInterner nodeNames;
+
+			/*! \brief How removeNode() removes the nodes.
 			 */
-			std::map<std::string, size_t> nodeNames;
+			RemovalMode removalMode = RemovalMode::Renumber;
 
-			/*! \brief A list of each node names
+			/*! \brief The ids of the removed nodes which may still be the end of some edges.
 			 *
-			 * This is useful for reverse looking up the name of a node from which we know its id.
+			 * These edges are ignored, and are only removed by purgeRemovedEdges().
+			 */
+			std::vector<size_t> removedIds;
+
+			/*! \brief The ids of the removed nodes which can be given to new nodes.
+			 */
+			std::vector<size_t> freeIds;
+
+			/*! \brief Whether the index of the incoming edges is kept.
+			 */
+			bool reverseIndexed = false;
+
+			/*! \brief The start of each edge to each node, when reverseIndexed is set.
+			 *
+			 * Unlike the connections, it never contains the id of a removed node.
+			 */
+			std::vector<Adjacents> reverseConnections;
+
+			/*! \brief The position of each edge of reverseConnections in the adjacents of its
+			 *         start, when reverseIndexed is set.
 			 */
-			std::vector<std::string> nameList;
+			std::vector<Adjacents> reversePositions;
 		};
 
 		/*! \brief A graph to be used by an A* algorithm.
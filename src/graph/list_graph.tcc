@@ -2,9 +2,12 @@
 
 #include "list_graph.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <sstream>
+#include <stdexcept>
 #include <type_traits>
+#include <utility>
 
 namespace graph {
 	namespace list {
@@ -26,24 +29,34 @@ namespace graph {
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
-		bool Graph<NodeProperty, EdgeProperty>::hasNode(std::string const& nodeName) const {
-			return static_cast<bool>(nodeNames.count(nodeName));
+		bool Graph<NodeProperty, EdgeProperty>::hasNode(std::string_view nodeName) const {
+			return nodeNames.contains(nodeName);
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
-		void Graph<NodeProperty, EdgeProperty>::addNode(std::string const& nodeName,
+		void Graph<NodeProperty, EdgeProperty>::addNode(std::string_view nodeName,
 		                                                NodeProperty property) {
-			if(!hasNode(nodeName)) {
-				size_t nodeId       = connections.size();
-				nodeNames[nodeName] = nodeId;
-				nodeProperties.push_back(property);
-				nameList.push_back(nodeName);
-				connections.push_back(std::list<size_t>());
+			if(freeIds.empty()) {
+				if(nodeNames.insert(nodeName) == connections.size()) {
+					nodeProperties.push_back(property);
+					connections.emplace_back();
+					edgeProperties.emplace_back();
+					if(reverseIndexed) {
+						reverseConnections.emplace_back();
+						reversePositions.emplace_back();
+					}
+				}
+			} else if(!nodeNames.contains(nodeName)) {
+				size_t nodeId = freeIds.back();
+				freeIds.pop_back();
+
+				nodeNames.insertAt(nodeName, nodeId);
+				nodeProperties[nodeId] = std::move(property);
 			}
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
-		void Graph<NodeProperty, EdgeProperty>::addNode(std::string const& nodeName) {
+		void Graph<NodeProperty, EdgeProperty>::addNode(std::string_view nodeName) {
 			addNode(nodeName, NodeProperty());
 		}
 
@@ -53,41 +66,118 @@ namespace graph {
 			std::string nodeName = node.getName();
 
 			if(hasNode(nodeName)) {
-				size_t nodeId = nodeNames[nodeName];
+				if(removalMode == RemovalMode::Tombstone) {
+					tombstoneNode(nodeNames.find(nodeName));
+					return;
+				}
+
+				// The renumbering below needs dense ids.
+				compact();
+
+				size_t nodeId = nodeNames.find(nodeName);
 
 				connections.erase(connections.begin() + nodeId);
+				edgeProperties.erase(edgeProperties.begin() + nodeId);
 
 				for(size_t beginId = 0; beginId < connections.size(); ++beginId) {
 
-					auto edgeEndIt = connections[beginId].begin();
-					while(edgeEndIt != connections[beginId].end()) {
-						if(*edgeEndIt == nodeId) {
-							edgeProperties.erase({nameList[beginId], nameList[*edgeEndIt]});
-							edgeEndIt = connections[beginId].erase(edgeEndIt);
+					auto& adjacents = connections[beginId];
+					size_t position = 0;
+					while(position < adjacents.size()) {
+						if(adjacents[position] == nodeId) {
+							// The last adjacent is moved here, so it must be checked too
+							adjacents.swapAndPop(position);
+							edgeProperties[beginId].swapAndPop(position);
 							continue;
-						} else if(*edgeEndIt > nodeId) {
-							--*edgeEndIt;
+						} else if(adjacents[position] > nodeId) {
+							--adjacents[position];
 						}
 
-						++edgeEndIt;
+						++position;
 					}
 				}
 
-				nodeNames.erase(node.getName());
-				for(auto& node : nodeNames) {
-					if(node.second > nodeId) {
-						--node.second;
+				nodeNames.erase(nodeId);
+
+				// The removed edges have moved the other ones in the adjacents.
+				if(reverseIndexed) {
+					rebuildReverseIndex();
+				}
+			}
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		void Graph<NodeProperty, EdgeProperty>::setRemovalMode(RemovalMode mode) {
+			removalMode = mode;
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		RemovalMode Graph<NodeProperty, EdgeProperty>::getRemovalMode() const {
+			return removalMode;
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		void Graph<NodeProperty, EdgeProperty>::setReverseIndex(bool enabled) {
+			reverseIndexed = enabled;
+			if(enabled) {
+				rebuildReverseIndex();
+			} else {
+				reverseConnections = std::vector<Adjacents>();
+				reversePositions   = std::vector<Adjacents>();
+			}
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		bool Graph<NodeProperty, EdgeProperty>::hasReverseIndex() const {
+			return reverseIndexed;
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		void Graph<NodeProperty, EdgeProperty>::compact() {
+			if(nodeNames.size() == connections.size()) {
+				return;
+			}
+
+			std::vector<size_t> newIds = nodeNames.compact();
+
+			std::vector<Adjacents> newConnections(nodeNames.size());
+			std::vector<AdjacentProperties<EdgeProperty>> newEdgeProperties(nodeNames.size());
+			std::vector<NodeProperty> newNodeProperties;
+			newNodeProperties.reserve(nodeNames.size());
+
+			for(size_t beginId = 0; beginId < connections.size(); ++beginId) {
+				size_t newBeginId = newIds[beginId];
+				if(newBeginId == NameInterner::npos) {
+					continue;
+				}
+
+				newNodeProperties.push_back(std::move(nodeProperties[beginId]));
+				for(size_t position = 0; position < connections[beginId].size(); ++position) {
+					size_t newEndId = newIds[connections[beginId][position]];
+					if(newEndId != NameInterner::npos) {
+						newConnections[newBeginId].push_back(newEndId);
+						newEdgeProperties[newBeginId].push_back(
+						        edgeProperties[beginId].get(position));
 					}
 				}
+			}
+
+			connections.swap(newConnections);
+			edgeProperties.swap(newEdgeProperties);
+			nodeProperties.swap(newNodeProperties);
+			removedIds.clear();
+			freeIds.clear();
 
-				nameList.erase(nameList.begin() + nodeId);
+			if(reverseIndexed) {
+				rebuildReverseIndex();
 			}
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
 		bool Graph<NodeProperty, EdgeProperty>::hasEdge(ConstNode_t const& begin,
 		                                                ConstNode_t const& end) const {
-			return static_cast<bool>(edgeProperties.count({begin.getName(), end.getName()}));
+			size_t beginId = begin.getId();
+			return findEdge(beginId, end.getId()) != connections[beginId].size();
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
@@ -95,7 +185,11 @@ namespace graph {
 			std::string start = std::move(std::get<0>(edge)), end = std::move(std::get<1>(edge));
 			size_t beginId = getId(start), endId = getId(end);
 			connections[beginId].push_back(endId);
-			edgeProperties[{start, end}] = std::get<EdgeProperty>(edge);
+			edgeProperties[beginId].push_back(std::get<EdgeProperty>(edge));
+			if(reverseIndexed) {
+				reverseConnections[endId].push_back(beginId);
+				reversePositions[endId].push_back(connections[beginId].size() - 1);
+			}
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
@@ -120,7 +214,11 @@ namespace graph {
 		                                                EdgeProperty property) {
 			size_t beginId = begin.getId(), endId = end.getId();
 			connections[beginId].push_back(endId);
-			edgeProperties[{begin.getName(), end.getName()}] = std::move(property);
+			edgeProperties[beginId].push_back(std::move(property));
+			if(reverseIndexed) {
+				reverseConnections[endId].push_back(beginId);
+				reversePositions[endId].push_back(connections[beginId].size() - 1);
+			}
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
@@ -133,70 +231,137 @@ namespace graph {
 		void Graph<NodeProperty, EdgeProperty>::removeEdge(ConstNode_t const& begin,
 		                                                   ConstNode_t const& end) {
 			size_t beginId = begin.getId(), endId = end.getId();
-			auto& nodeConnections = connections[beginId];
-			bool found = false;
-			for(auto adjacentIt = nodeConnections.begin(); adjacentIt != nodeConnections.end();
-			    ++adjacentIt) {
-				if(*adjacentIt == endId) {
-					found = true;
-					nodeConnections.erase(adjacentIt);
-					break;
-				}
-			}
+			size_t position = findEdge(beginId, endId);
 
-			if(!found) {
+			if(position == connections[beginId].size()) {
 				std::ostringstream errMsg;
 				errMsg << "No such edge if the graph: (" << begin.getName() << ", " << end.getName()
 				       << "), with id: (" << begin.getId() << ", " << end.getId() << ").";
 				throw std::out_of_range(errMsg.str());
 			}
 
-			edgeProperties.erase({begin.getName(), end.getName()});
+			size_t lastPosition = connections[beginId].size() - 1;
+			size_t lastEndId    = connections[beginId][lastPosition];
+			connections[beginId].swapAndPop(position);
+			edgeProperties[beginId].swapAndPop(position);
+			if(reverseIndexed) {
+				size_t reversePosition = findReverseEdge(beginId, endId, position);
+				reverseConnections[endId].swapAndPop(reversePosition);
+				reversePositions[endId].swapAndPop(reversePosition);
+
+				// The last edge of the start has been moved to the position of the removed one.
+				// Its end is not in the index if it has been removed.
+				if(position != lastPosition) {
+					reversePosition = findReverseEdge(beginId, lastEndId, lastPosition);
+					if(reversePosition != reverseConnections[lastEndId].size()) {
+						reversePositions[lastEndId][reversePosition] = position;
+					}
+				}
+			}
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
 		EdgeProperty Graph<NodeProperty, EdgeProperty>::getEdgeProperty(
 		        ConstNode_t const& begin,
 		        ConstNode_t const& end) const {
-			// Use .at() instead of operator[] because the method .at() throw if the key does not
-			// exists, instead of inserting a new key, allowing "getEdgeProperty" to be const.
-			return edgeProperties.at({begin.getName(), end.getName()});
+			return getEdgeProperty(begin.getId(), end.getId());
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		EdgeProperty Graph<NodeProperty, EdgeProperty>::getEdgeProperty(size_t beginId,
+		                                                                size_t endId) const {
+			size_t position = findEdge(beginId, endId);
+
+			if(position == connections[beginId].size()) {
+				std::ostringstream errMsg;
+				errMsg << "No such edge if the graph: (" << nodeNames[beginId] << ", "
+				       << nodeNames[endId] << "), with id: (" << beginId << ", " << endId << ").";
+				throw std::out_of_range(errMsg.str());
+			}
+
+			return edgeProperties[beginId].get(position);
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
 		void Graph<NodeProperty, EdgeProperty>::setEdgeProperty(ConstNode_t const& begin,
 		                                                        ConstNode_t const& end,
 		                                                        EdgeProperty property) {
-			edgeProperties.at({begin.getName(), end.getName()}) = std::move(property);
+			size_t beginId = begin.getId(), endId = end.getId();
+			size_t position = findEdge(beginId, endId);
+
+			if(position == connections[beginId].size()) {
+				std::ostringstream errMsg;
+				errMsg << "No such edge if the graph: (" << begin.getName() << ", " << end.getName()
+				       << "), with id: (" << beginId << ", " << endId << ").";
+				throw std::out_of_range(errMsg.str());
+			}
+
+			edgeProperties[beginId].set(position, std::move(property));
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
-		std::vector<std::list<size_t>> Graph<NodeProperty, EdgeProperty>::getConnections() const {
-			return connections;
+		ConnectionsView Graph<NodeProperty, EdgeProperty>::getConnections() const {
+			return ConnectionsView(connections);
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
 		size_t Graph<NodeProperty, EdgeProperty>::getVerticesCount() const {
-			return connections.size();
+			return nodeNames.size();
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
 		size_t Graph<NodeProperty, EdgeProperty>::getEdgesCount() const {
 			size_t count = 0;
 			for(auto const& subArray : connections) {
-				count += subArray.size();
+				if(removedIds.empty()) {
+					count += subArray.size();
+				} else {
+					count += static_cast<size_t>(std::count_if(
+					        subArray.begin(), subArray.end(), [this](size_t endId) {
+						        return nodeNames.hasId(endId);
+					        }));
+				}
 			}
 			return count;
 		}
 
+		template <typename NodeProperty, typename EdgeProperty>
+		size_t Graph<NodeProperty, EdgeProperty>::getIdBound() const {
+			return connections.size();
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		bool Graph<NodeProperty, EdgeProperty>::hasNodeId(size_t nodeId) const {
+			return nodeNames.hasId(nodeId);
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		std::string_view Graph<NodeProperty, EdgeProperty>::getName(size_t nodeId) const {
+			return nodeNames[nodeId];
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		NodeProperty const& Graph<NodeProperty, EdgeProperty>::getNodeProperty(
+		        size_t nodeId) const {
+			return nodeProperties[nodeId];
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		auto Graph<NodeProperty, EdgeProperty>::getNode(size_t nodeId) const -> ConstNode_t {
+			return ConstNode_t(nodeId, connections[nodeId], std::string(nodeNames[nodeId]),
+			                   nodeProperties);
+		}
+
 		template <typename NodeProperty, typename EdgeProperty>
 		template <typename Functor>
 		void Graph<NodeProperty, EdgeProperty>::eachVertices(Functor&& functor) const {
-			static_assert(std::is_convertible<Functor, std::function<void(ConstNode_t)>>::value,
-			              "The function must be convertible to a function of type void(ConstNode)");
+			static_assert(std::is_convertible<Functor, std::function<void(NodeRef_t)>>::value,
+			              "The function must be convertible to a function of type void(NodeRef)");
 
 			for(size_t i = 0; i < connections.size(); ++i) {
-				functor(std::move((*this)[nameList[i]]));
+				if(nodeNames.hasId(i)) {
+					functor(NodeRef_t(*this, i));
+				}
 			}
 		}
 
@@ -204,61 +369,214 @@ namespace graph {
 		template <typename Functor>
 		void Graph<NodeProperty, EdgeProperty>::eachEdges(Functor&& functor) const {
 			static_assert(std::is_convertible<Functor,
-			                                  std::function<void(ConstNode_t, ConstNode_t)>>::value,
-			              "The function must be convertible to a function of type void(ConstNode, "
-			              "ConstNode)");
+			                                  std::function<void(NodeRef_t, NodeRef_t)>>::value,
+			              "The function must be convertible to a function of type void(NodeRef, "
+			              "NodeRef)");
 			for(size_t i = 0; i < connections.size(); ++i) {
 				for(auto j : connections[i]) {
-					functor(std::move((*this)[nameList[i]]), std::move((*this)[nameList[j]]));
+					if(nodeNames.hasId(j)) {
+						functor(NodeRef_t(*this, i), NodeRef_t(*this, j));
+					}
 				}
 			}
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
 		template <typename Functor>
-		void Graph<NodeProperty, EdgeProperty>::eachAdjacents(ConstNode_t const& vertex,
+		void Graph<NodeProperty, EdgeProperty>::eachAdjacents(NodeRef_t vertex,
 		                                                      Functor&& functor) const {
-			static_assert(std::is_convertible<Functor, std::function<void(ConstNode_t)>>::value,
-			              "The function must be convertible to a function of type void(ConstNode)");
+			static_assert(std::is_convertible<Functor, std::function<void(NodeRef_t)>>::value,
+			              "The function must be convertible to a function of type void(NodeRef)");
 			for(auto i : connections[vertex.getId()]) {
-				functor(std::move((*this)[nameList[i]]));
+				if(nodeNames.hasId(i)) {
+					functor(NodeRef_t(*this, i));
+				}
 			}
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
-		size_t Graph<NodeProperty, EdgeProperty>::getId(std::string const& name) {
-			if(!hasNode(name)) {
-				addNode(name);
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachAdjacents(ConstNode_t const& vertex,
+		                                                      Functor&& functor) const {
+			eachAdjacents(NodeRef_t(*this, vertex.getId()), std::forward<Functor>(functor));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachAdjacentEdges(NodeRef_t vertex,
+		                                                          Functor&& functor) const {
+			static_assert(
+			        std::is_convertible<Functor,
+			                            std::function<void(NodeRef_t, EdgeProperty const&)>>::value,
+			        "The function must be convertible to a function of type "
+			        "void(NodeRef, EdgeProperty const&)");
+			size_t vertexId = vertex.getId();
+
+			auto const& adjacents = connections[vertexId];
+			for(size_t position = 0; position < adjacents.size(); ++position) {
+				if(nodeNames.hasId(adjacents[position])) {
+					functor(NodeRef_t(*this, adjacents[position]),
+					        edgeProperties[vertexId].get(position));
+				}
 			}
-			return nodeNames[name];
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
-		size_t Graph<NodeProperty, EdgeProperty>::getId(std::string const& name) const {
-			return nodeNames.at(name);
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachAdjacentEdges(ConstNode_t const& vertex,
+		                                                          Functor&& functor) const {
+			eachAdjacentEdges(NodeRef_t(*this, vertex.getId()), std::forward<Functor>(functor));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachPredecessors(NodeRef_t vertex,
+		                                                         Functor&& functor) const {
+			static_assert(std::is_convertible<Functor, std::function<void(NodeRef_t)>>::value,
+			              "The function must be convertible to a function of type void(NodeRef)");
+			size_t vertexId = vertex.getId();
+
+			if(reverseIndexed) {
+				for(auto i : reverseConnections[vertexId]) {
+					functor(NodeRef_t(*this, i));
+				}
+				return;
+			}
+
+			for(size_t i = 0; i < connections.size(); ++i) {
+				if(nodeNames.hasId(i)) {
+					for(auto j : connections[i]) {
+						if(j == vertexId) {
+							functor(NodeRef_t(*this, i));
+						}
+					}
+				}
+			}
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachPredecessors(ConstNode_t const& vertex,
+		                                                         Functor&& functor) const {
+			eachPredecessors(NodeRef_t(*this, vertex.getId()), std::forward<Functor>(functor));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachPredecessorEdges(NodeRef_t vertex,
+		                                                             Functor&& functor) const {
+			static_assert(
+			        std::is_convertible<Functor,
+			                            std::function<void(NodeRef_t, EdgeProperty const&)>>::value,
+			        "The function must be convertible to a function of type "
+			        "void(NodeRef, EdgeProperty const&)");
+			size_t vertexId = vertex.getId();
+
+			if(reverseIndexed) {
+				auto const& starts    = reverseConnections[vertexId];
+				auto const& positions = reversePositions[vertexId];
+				for(size_t i = 0; i < starts.size(); ++i) {
+					size_t beginId = starts[i];
+					functor(NodeRef_t(*this, beginId), edgeProperties[beginId].get(positions[i]));
+				}
+				return;
+			}
+
+			for(size_t i = 0; i < connections.size(); ++i) {
+				if(nodeNames.hasId(i)) {
+					for(size_t position = 0; position < connections[i].size(); ++position) {
+						if(connections[i][position] == vertexId) {
+							functor(NodeRef_t(*this, i), edgeProperties[i].get(position));
+						}
+					}
+				}
+			}
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachPredecessorEdges(ConstNode_t const& vertex,
+		                                                             Functor&& functor) const {
+			eachPredecessorEdges(NodeRef_t(*this, vertex.getId()), std::forward<Functor>(functor));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		auto Graph<NodeProperty, EdgeProperty>::vertices() const -> VertexRange_t {
+			return VertexRange_t(VertexIterator<Graph>(*this, 0),
+			                     VertexIterator<Graph>(*this, getIdBound()));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		auto Graph<NodeProperty, EdgeProperty>::edges() const -> EdgeRange_t {
+			VertexRange_t range = vertices();
+			return EdgeRange_t(EdgeIterator<Graph>(range.begin(), range.end()),
+			                   EdgeIterator<Graph>(range.end(), range.end()));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		auto Graph<NodeProperty, EdgeProperty>::adjacents(size_t nodeId) const
+		        -> AdjacentRange_t {
+			using Iterator = typename AdjacentRange_t::iterator;
+
+			// Edges to removed nodes can only exist while some removed ids are pending.
+			bool skipRemovedIds = !removedIds.empty();
+			auto const& row     = connections[nodeId];
+			return AdjacentRange_t(Iterator(*this, row.begin(), row.end(), skipRemovedIds),
+			                       Iterator(*this, row.end(), row.end(), skipRemovedIds));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		auto Graph<NodeProperty, EdgeProperty>::predecessors(size_t nodeId) const
+		        -> AdjacentRange_t {
+			using Iterator = typename AdjacentRange_t::iterator;
+
+			if(!reverseIndexed) {
+				throw std::logic_error("The predecessors ranges need the reverse index, see "
+				                       "setReverseIndex().");
+			}
+
+			auto const& row = reverseConnections[nodeId];
+			return AdjacentRange_t(Iterator(*this, row.begin(), row.end(), false),
+			                       Iterator(*this, row.end(), row.end(), false));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		size_t Graph<NodeProperty, EdgeProperty>::getId(std::string_view name) {
+			addNode(name);
+			return nodeNames.find(name);
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		size_t Graph<NodeProperty, EdgeProperty>::getId(std::string_view name) const {
+			size_t nodeId = nodeNames.find(name);
+			if(nodeId == NameInterner::npos) {
+				std::ostringstream errMsg;
+				errMsg << "No such node in the graph: " << name << ".";
+				throw std::out_of_range(errMsg.str());
+			}
+			return nodeId;
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
 		auto Graph<NodeProperty, EdgeProperty>::begin() -> Node_t {
-			return (*this)[nameList[0]];
+			return (*this)[nodeNames[firstId()]];
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
 		auto Graph<NodeProperty, EdgeProperty>::begin() const -> ConstNode_t {
-			return (*this)[nameList[0]];
+			return getNode(firstId());
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
-		auto Graph<NodeProperty, EdgeProperty>::operator[](std::string const& nodeName) -> Node_t {
+		auto Graph<NodeProperty, EdgeProperty>::operator[](std::string_view nodeName) -> Node_t {
 			size_t nodeId = getId(nodeName);
-			return Node_t(nodeId, connections[nodeId], nodeName, nodeProperties);
+			return Node_t(nodeId, connections[nodeId], std::string(nodeName), nodeProperties);
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
-		auto Graph<NodeProperty, EdgeProperty>::operator[](std::string const& nodeName) const
+		auto Graph<NodeProperty, EdgeProperty>::operator[](std::string_view nodeName) const
 		        -> ConstNode_t {
-			size_t nodeId = getId(nodeName);
-			return ConstNode_t(nodeId, connections[nodeId], nodeName, nodeProperties);
+			return getNode(getId(nodeName));
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
@@ -267,18 +585,38 @@ namespace graph {
 		        Graph<OtherNodeProperty, OtherEdgeProperty> const& other) const {
 
 			// Compare node names and number of nodes
-			if(!std::equal(nodeNames.begin(),
-			               nodeNames.end(),
-			               other.nodeNames.begin(),
-			               other.nodeNames.end(),
-			               [](std::pair<std::string, size_t> const& a,
-			                  std::pair<std::string, size_t> const& b) {
-				               return a.first == b.first;
-				           })) {
+			if(!nodeNames.hasSameNames(other.nodeNames)) {
+				return false;
+			}
+
+			if(getEdgesCount() != other.getEdgesCount()) {
 				return false;
 			}
 
-			return edgeProperties == other.edgeProperties;
+			// Compare the edges by the names of their nodes, as the ids may differ
+			for(size_t beginId = 0; beginId < connections.size(); ++beginId) {
+				if(connections[beginId].empty()) {
+					continue;
+				}
+
+				size_t otherBeginId = other.getId(nodeNames[beginId]);
+				for(size_t position = 0; position < connections[beginId].size(); ++position) {
+					size_t endId = connections[beginId][position];
+					if(!nodeNames.hasId(endId)) {
+						continue;
+					}
+
+					size_t otherEndId    = other.getId(nodeNames[endId]);
+					size_t otherPosition = other.findEdge(otherBeginId, otherEndId);
+					if(otherPosition == other.connections[otherBeginId].size() ||
+					   !(edgeProperties[beginId].get(position) ==
+					     other.edgeProperties[otherBeginId].get(otherPosition))) {
+						return false;
+					}
+				}
+			}
+
+			return true;
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
@@ -287,5 +625,102 @@ namespace graph {
 		        Graph<OtherNodeProperty, OtherEdgeProperty> const& other) const {
 			return !(*this == other);
 		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		size_t Graph<NodeProperty, EdgeProperty>::findEdge(size_t beginId, size_t endId) const {
+			auto const& adjacents = connections[beginId];
+			return static_cast<size_t>(std::find(adjacents.begin(), adjacents.end(), endId) -
+			                           adjacents.begin());
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		size_t Graph<NodeProperty, EdgeProperty>::firstId() const {
+			size_t nodeId = 0;
+			while(!nodeNames.hasId(nodeId)) {
+				++nodeId;
+			}
+			return nodeId;
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		void Graph<NodeProperty, EdgeProperty>::tombstoneNode(size_t nodeId) {
+			// The edges to the node are left in place, they are ignored until they are purged.
+			if(reverseIndexed) {
+				for(size_t position = 0; position < connections[nodeId].size(); ++position) {
+					size_t endId = connections[nodeId][position];
+					if(nodeNames.hasId(endId)) {
+						size_t reversePosition = findReverseEdge(nodeId, endId, position);
+						reverseConnections[endId].swapAndPop(reversePosition);
+						reversePositions[endId].swapAndPop(reversePosition);
+					}
+				}
+				reverseConnections[nodeId].clear();
+				reversePositions[nodeId].clear();
+			}
+			connections[nodeId].clear();
+			edgeProperties[nodeId] = AdjacentProperties<EdgeProperty>();
+			nodeProperties[nodeId] = NodeProperty();
+			nodeNames.release(nodeId);
+			removedIds.push_back(nodeId);
+
+			// Purging takes a time linear in the size of the graph, so it is only done once enough
+			// nodes have been removed for its cost to be amortized.
+			if(8 * removedIds.size() > connections.size()) {
+				purgeRemovedEdges();
+			}
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		void Graph<NodeProperty, EdgeProperty>::purgeRemovedEdges() {
+			for(size_t beginId = 0; beginId < connections.size(); ++beginId) {
+				auto& adjacents = connections[beginId];
+				size_t position = 0;
+				while(position < adjacents.size()) {
+					if(!nodeNames.hasId(adjacents[position])) {
+						adjacents.swapAndPop(position);
+						edgeProperties[beginId].swapAndPop(position);
+					} else {
+						++position;
+					}
+				}
+			}
+
+			freeIds.insert(freeIds.end(), removedIds.begin(), removedIds.end());
+			removedIds.clear();
+
+			// The removed edges have moved the other ones in the adjacents.
+			if(reverseIndexed) {
+				rebuildReverseIndex();
+			}
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		void Graph<NodeProperty, EdgeProperty>::rebuildReverseIndex() {
+			reverseConnections.assign(connections.size(), Adjacents());
+			reversePositions.assign(connections.size(), Adjacents());
+			for(size_t beginId = 0; beginId < connections.size(); ++beginId) {
+				for(size_t position = 0; position < connections[beginId].size(); ++position) {
+					size_t endId = connections[beginId][position];
+					if(nodeNames.hasId(endId)) {
+						reverseConnections[endId].push_back(beginId);
+						reversePositions[endId].push_back(position);
+					}
+				}
+			}
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		size_t Graph<NodeProperty, EdgeProperty>::findReverseEdge(size_t beginId,
+		                                                          size_t endId,
+		                                                          size_t position) const {
+			auto const& starts    = reverseConnections[endId];
+			auto const& positions = reversePositions[endId];
+			size_t reversePosition = 0;
+			while(reversePosition < starts.size() &&
+			      (starts[reversePosition] != beginId || positions[reversePosition] != position)) {
+				++reversePosition;
+			}
+			return reversePosition;
+		}
 	}
 }
@@ -4,6 +4,21 @@
 namespace graph {
 	namespace list {
 
+		ConnectionsView::ConnectionsView(std::vector<Adjacents> const& connections)
+		      : connections(&connections) {}
+
+		size_t ConnectionsView::size() const {
+			return connections->size();
+		}
+
+		bool ConnectionsView::empty() const {
+			return connections->empty();
+		}
+
+		ArrayView<size_t> ConnectionsView::operator[](size_t nodeId) const {
+			return (*connections)[nodeId].view();
+		}
+
 		template class Node<NoProperty>;
 		template class Node<AstarNodeProperty<void>>;
 		template class Node<AstarNodeProperty<std::string>>;
@@ -1,6 +1,8 @@
 #pragma once
 
-#include <list>
+#include "node_ref.hpp"
+#include "small_vector.hpp"
+
 #include <string>
 #include <vector>
 
@@ -9,6 +11,44 @@
 namespace graph {
 	namespace list {
 
+		/*! \brief The ids of the adjacents of a node.
+		 *
+		 * Most nodes have a few adjacents, which are then stored without any heap allocation.
+		 */
+		using Adjacents = SmallVector<size_t, 4>;
+
+		/*! \brief A read-only view on the adjacents of every nodes of a graph.
+		 *
+		 * Like an iterator, the view is invalidated when the graph is modified.
+		 */
+		class ConnectionsView {
+		public:
+			/*! \brief Create a view on the adjacents of every nodes.
+			 *
+			 * \param connections The adjacents of each node.
+			 */
+			explicit ConnectionsView(std::vector<Adjacents> const& connections);
+
+			/*! \brief Get the number of nodes.
+			 */
+			size_t size() const;
+
+			/*! \brief Check if there are no nodes.
+			 */
+			bool empty() const;
+
+			/*! \brief Get the adjacents of a given node.
+			 *
+			 * \param nodeId The id of the node.
+			 */
+			ArrayView<size_t> operator[](size_t nodeId) const;
+
+		protected:
+			/*! \brief The adjacents of each node.
+			 */
+			std::vector<Adjacents> const* connections;
+		};
+
 		/*! \brief Represents a Node
 		 *
 		 * An object of type Node will store a reference to the adjacency list of the parent Graph.
@@ -19,8 +59,8 @@ namespace graph {
 		class GenericNode {
 			using NodeProperty = typename std::decay_t<NodePropertyVector>::value_type;
 		public:
-			friend class GenericNode<NodePropertyVector, std::list<size_t>&>;
-			friend class GenericNode<NodePropertyVector, std::list<size_t> const&>;
+			friend class GenericNode<NodePropertyVector, Adjacents&>;
+			friend class GenericNode<NodePropertyVector, Adjacents const&>;
 
 			GenericNode() = delete;
 
@@ -88,11 +128,11 @@ namespace graph {
 			 */
 			std::string getName() const;
 
-			/*! \brief Return the internal boolean matrix.
+			/*! \brief Return the adjacents of the node.
 			 *
-			 * \return A copy of the internale boolean matrix.
+			 * \return A view on the ids of the adjacents of the node.
 			 */
-			std::list<size_t> getConnections() const;
+			ArrayView<size_t> getConnections() const;
 
 			/*! \brief Return the property of the current Node.
 			 *
@@ -128,8 +168,8 @@ namespace graph {
 		 * will result in a dandling reference.
 		 */
 		template <typename NodeProperty>
-		class Node : public GenericNode<std::vector<NodeProperty>&, std::list<size_t>&> {
-			using ParentClass = GenericNode<std::vector<NodeProperty>&, std::list<size_t>&>;
+		class Node : public GenericNode<std::vector<NodeProperty>&, Adjacents&> {
+			using ParentClass = GenericNode<std::vector<NodeProperty>&, Adjacents&>;
 		public:
 			/*! \brief Node default constructor.
 			 *
@@ -139,7 +179,7 @@ namespace graph {
 			 * \param property The property of the node.
 			 */
 			Node(size_t id,
-			     std::list<size_t>& connections,
+			     Adjacents& connections,
 			     std::string name,
 			     std::vector<NodeProperty>& property);
 
@@ -164,9 +204,9 @@ namespace graph {
 		 */
 		template <typename NodeProperty>
 		class ConstNode
-		        : public GenericNode<std::vector<NodeProperty> const&, std::list<size_t> const&> {
+		        : public GenericNode<std::vector<NodeProperty> const&, Adjacents const&> {
 			using ParentClass =
-			        GenericNode<std::vector<NodeProperty> const&, std::list<size_t> const&>;
+			        GenericNode<std::vector<NodeProperty> const&, Adjacents const&>;
 
 		public:
 			/*! \brief Node default constructor.
@@ -177,7 +217,7 @@ namespace graph {
 			 * \param property a reference to the properties vector of the parent Graph.
 			 */
 			ConstNode(size_t id,
-			          std::list<size_t> const& connections,
+			          Adjacents const& connections,
 			          std::string name,
 			          std::vector<NodeProperty> const& property);
 
@@ -186,6 +226,13 @@ namespace graph {
 			 * \param other The Node to convert.
 			 */
 			ConstNode(Node<NodeProperty> const& other);
+
+			/*! \brief Convert a NodeRef to a ConstNode.
+			 *
+			 * \param node The handle to convert.
+			 */
+			template <typename Graph>
+			ConstNode(NodeRef<Graph> const& node);
 		};
 	}
 }
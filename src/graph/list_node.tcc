@@ -68,8 +68,8 @@ namespace graph {
 		}
 
 		template <typename NodePropertyVector, typename Connections>
-		std::list<size_t> GenericNode<NodePropertyVector, Connections>::getConnections() const {
-			return connections;
+		ArrayView<size_t> GenericNode<NodePropertyVector, Connections>::getConnections() const {
+			return connections.view();
 		}
 
 		template <typename NodePropertyVector, typename Connections>
@@ -80,7 +80,7 @@ namespace graph {
 
 		template <typename NodeProperty>
 		Node<NodeProperty>::Node(size_t id,
-		                         std::list<size_t>& connections,
+		                         Adjacents& connections,
 		                         std::string name,
 		                         std::vector<NodeProperty>& property)
 		      : ParentClass(id, connections, std::move(name), property) {}
@@ -97,7 +97,7 @@ namespace graph {
 
 		template <typename NodeProperty>
 		ConstNode<NodeProperty>::ConstNode(size_t id,
-		                                   std::list<size_t> const& connections,
+		                                   Adjacents const& connections,
 		                                   std::string name,
 		                                   std::vector<NodeProperty> const& property)
 		      : ParentClass(id, connections, std::move(name), property) {}
@@ -105,5 +105,10 @@ namespace graph {
 		template <typename NodePropertyVector>
 		ConstNode<NodePropertyVector>::ConstNode(Node<NodePropertyVector> const& other)
 		      : ParentClass(other.id, other.connections, other.name, other.property) {}
+
+		template <typename NodeProperty>
+		template <typename Graph>
+		ConstNode<NodeProperty>::ConstNode(NodeRef<Graph> const& node)
+		      : ConstNode(node.getGraph().getNode(node.getId())) {}
 	}
 }
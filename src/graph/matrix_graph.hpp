@@ -1,13 +1,18 @@
 #pragma once
 
+#include "bit_matrix.hpp"
 #include "edge.hpp"
+#include "edge_properties.hpp"
 #include "utility.hpp"
 #include "properties.hpp"
+#include "removal_mode.hpp"
 #include "matrix_node.hpp"
+#include "name_interner.hpp"
+#include "node_range.hpp"
 
-#include <map>
 #include <ostream>
 #include <set>
+#include <string_view>
 #include <vector>
 
 #include <cstddef>
@@ -35,6 +40,22 @@ namespace graph {
 			 */
 			using ConstNode_t = ConstNode<NodeProperty>;
 
+			/*! \brief The lightweight node handle given by the iteration functions.
+			 */
+			using NodeRef_t   = NodeRef<Graph>;
+
+			/*! \brief The range of vertices returned by vertices().
+			 */
+			using VertexRange_t   = IteratorRange<VertexIterator<Graph>>;
+
+			/*! \brief The range of adjacents returned by adjacents().
+			 */
+			using AdjacentRange_t = IteratorRange<AdjacentIterator<Graph, bits::SetBitIterator>>;
+
+			/*! \brief The range of edges returned by edges().
+			 */
+			using EdgeRange_t     = IteratorRange<EdgeIterator<Graph>>;
+
 			/*! \brief Create an empty graph
 			 */
 			Graph() = default;
@@ -56,32 +77,66 @@ namespace graph {
 			 *
 			 * \param nodeName The name of the node.
 			 */
-			bool hasNode(std::string const& nodeName) const;
+			bool hasNode(std::string_view nodeName) const;
 
 			/*! \brief Add a node to the graph.
 			 *
 			 * \param nodeName The name of the node to add.
 			 * \param property The property of the node to add.
 			 */
-			void addNode(std::string const& nodeName, NodeProperty property);
+			void addNode(std::string_view nodeName, NodeProperty property);
 
 			/*! \brief Add a node to the graph.
 			 *
 			 * \param nodeName The name of the node to add.
 			 */
-			void addNode(std::string const& nodeName);
+			void addNode(std::string_view nodeName);
 
 			/*! \brief Remove a node from the graph.
 			 *
-			 * \warning This will invalidate every ConstNode or Node object from the graph that have
-			 *          an id greater than the node to be removed.
+			 * With RemovalMode::Tombstone, the ids of the other nodes do not change, and the id of
+			 * the removed node may be given to a node added later.
 			 *
-			 * \exception std::out_of_range If the node is not in the graph.
+			 * \warning With RemovalMode::Renumber, this will invalidate every ConstNode or Node
+			 *          object from the graph that have an id greater than the node to be removed.
 			 *
 			 * \param node The node to remove.
 			 */
 			void removeNode(ConstNode_t const& node);
 
+			/*! \brief Choose how removeNode() removes the nodes.
+			 *
+			 * \param mode The removal mode, RemovalMode::Renumber by default.
+			 */
+			void setRemovalMode(RemovalMode mode);
+
+			/*! \brief Get how removeNode() removes the nodes.
+			 */
+			RemovalMode getRemovalMode() const;
+
+			/*! \brief Choose whether the graph keeps an index of the incoming edges of each node.
+			 *
+			 * The index is updated with every change of the graph, which makes eachPredecessors()
+			 * as fast as eachAdjacents(). Enabling it builds it in a time linear in the size of
+			 * the graph, disabling it frees it.
+			 *
+			 * \param enabled Whether the index is kept, it is not by default.
+			 */
+			void setReverseIndex(bool enabled);
+
+			/*! \brief Check if the graph keeps an index of the incoming edges of each node.
+			 */
+			bool hasReverseIndex() const;
+
+			/*! \brief Renumber the nodes so that their ids are dense again, keeping their order.
+			 *
+			 * This is only needed after removing nodes with RemovalMode::Tombstone, and takes a
+			 * time linear in the size of the graph.
+			 *
+			 * \warning This will invalidate every ConstNode or Node object from the graph.
+			 */
+			void compact();
+
 			/*! \brief Check if an edge exists between two nodes.
 			 *
 			 * \param begin The start of the edge.
@@ -142,6 +197,15 @@ namespace graph {
 			 */
 			EdgeProperty getEdgeProperty(ConstNode_t const& begin, ConstNode_t const& end) const;
 
+			/*! \brief Get the property of a given edge.
+			 *
+			 * \exception std::out_of_range If the edge is not in the graph.
+			 *
+			 * \param beginId The id of the node at the start of the edge.
+			 * \param endId The id of the node at the end of the edge.
+			 */
+			EdgeProperty getEdgeProperty(size_t beginId, size_t endId) const;
+
 			/*! \brief Set the property of the given edge.
 			 *
 			 * \param begin The node at the start of the edge.
@@ -156,6 +220,13 @@ namespace graph {
 			 */
 			std::vector<std::vector<bool>> getConnections() const;
 
+			/*! \brief Get the packed adjacency matrix of this graph.
+			 *
+			 * The bit at row `i` and column `j` is set if there is an edge from the node of id `i`
+			 * to the node of id `j`.
+			 */
+			BitMatrix const& getMatrix() const;
+
 			/*! \brief Get the number of vertices in the graph.
 			 *
 			 * \return the number of vertices in the graph.
@@ -168,9 +239,45 @@ namespace graph {
 			 */
 			size_t getEdgesCount() const;
 
+			/*! \brief Get one past the greatest id of a node of the graph.
+			 *
+			 * This is the size of an array indexed by node ids. It is equal to getVerticesCount()
+			 * unless some nodes were removed with RemovalMode::Tombstone since the last
+			 * compact().
+			 */
+			size_t getIdBound() const;
+
+			/*! \brief Check if a given id is the id of a node of the graph.
+			 *
+			 * \param nodeId The id to check.
+			 */
+			bool hasNodeId(size_t nodeId) const;
+
+			/*! \brief Get the name of the node with a given id.
+			 *
+			 * \warning The returned view is invalidated when a node is added or removed.
+			 *
+			 * \param nodeId The id of the node.
+			 */
+			std::string_view getName(size_t nodeId) const;
+
+			/*! \brief Get the property of the node with a given id.
+			 *
+			 * \param nodeId The id of the node.
+			 */
+			NodeProperty const& getNodeProperty(size_t nodeId) const;
+
+			/*! \brief Return a Node representing a node from this graph with a given id.
+			 *
+			 * \param nodeId The id of the node.
+			 * \return The Node representing the given node.
+			 */
+			ConstNode_t getNode(size_t nodeId) const;
+
 			/*! Call a given function for each vertices.
 			 *
-			 * The functor must be convertible to a function of type void(Node)
+			 * The functor must be convertible to a function of type void(NodeRef_t). A function
+			 * taking a ConstNode_t can also be used, but the node is then built for each call.
 			 *
 			 * \param functor the function to call
 			 */
@@ -179,7 +286,9 @@ namespace graph {
 
 			/*! Call a given function for each edges.
 			 *
-			 * The functor must be convertible to a function of type void(Node, Node)
+			 * The functor must be convertible to a function of type void(NodeRef_t, NodeRef_t).
+			 * A function taking ConstNode_t can also be used, but the nodes are then built for
+			 * each call.
 			 *
 			 * \param functor the function to call
 			 */
@@ -188,14 +297,130 @@ namespace graph {
 
 			/*! Call a given function for each vertices adjacent to the given edge.
 			 *
-			 * The functor must be convertible to a function of type void(Node)
+			 * The functor must be convertible to a function of type void(NodeRef_t). A function
+			 * taking a ConstNode_t can also be used, but the node is then built for each call.
 			 *
 			 * \param vertex the vertex from which to process the adjacents.
 			 * \param functor the function to call
 			 */
 			template <typename Functor>
+			void eachAdjacents(NodeRef_t vertex, Functor&& functor) const;
+
+			/*! Call a given function for each vertices adjacent to the given edge.
+			 *
+			 * \param vertex the vertex from which to process the adjacents.
+			 * \param functor the function to call
+			 * \sa eachAdjacents(NodeRef_t, Functor&&)
+			 */
+			template <typename Functor>
 			void eachAdjacents(ConstNode_t const& vertex, Functor&& functor) const;
 
+			/*! Call a given function for each edge starting from the given vertex.
+			 *
+			 * This gives the property of each edge along with its end, so that weighted
+			 * traversals do not look every edge up with getEdgeProperty().
+			 *
+			 * The functor must be convertible to a function of type
+			 * void(NodeRef_t, EdgeProperty const&).
+			 *
+			 * \param vertex the vertex from which to process the edges.
+			 * \param functor the function to call
+			 */
+			template <typename Functor>
+			void eachAdjacentEdges(NodeRef_t vertex, Functor&& functor) const;
+
+			/*! Call a given function for each edge starting from the given vertex.
+			 *
+			 * \param vertex the vertex from which to process the edges.
+			 * \param functor the function to call
+			 * \sa eachAdjacentEdges(NodeRef_t, Functor&&)
+			 */
+			template <typename Functor>
+			void eachAdjacentEdges(ConstNode_t const& vertex, Functor&& functor) const;
+
+			/*! Call a given function for each vertices which are the start of an edge to the
+			 *  given vertex.
+			 *
+			 * Without the index enabled by setReverseIndex(), this takes a time linear in
+			 * the number of nodes.
+			 *
+			 * The functor must be convertible to a function of type void(NodeRef_t).
+			 *
+			 * \param vertex the vertex from which to process the predecessors.
+			 * \param functor the function to call
+			 */
+			template <typename Functor>
+			void eachPredecessors(NodeRef_t vertex, Functor&& functor) const;
+
+			/*! Call a given function for each vertices which are the start of an edge to the
+			 *  given vertex.
+			 *
+			 * \param vertex the vertex from which to process the predecessors.
+			 * \param functor the function to call
+			 * \sa eachPredecessors(NodeRef_t, Functor&&)
+			 */
+			template <typename Functor>
+			void eachPredecessors(ConstNode_t const& vertex, Functor&& functor) const;
+
+			/*! Call a given function for each edge ending at the given vertex, with the start of
+			 *  the edge and its property.
+			 *
+			 * Each parallel edge is given with its own property. Without the index enabled by
+			 * setReverseIndex(), this takes a time linear in the number of vertices.
+			 *
+			 * The functor must be convertible to a function of type
+			 * void(NodeRef_t, EdgeProperty const&).
+			 *
+			 * \param vertex the vertex at the end of the edges.
+			 * \param functor the function to call
+			 */
+			template <typename Functor>
+			void eachPredecessorEdges(NodeRef_t vertex, Functor&& functor) const;
+
+			/*! Call a given function for each edge ending at the given vertex, with the start of
+			 *  the edge and its property.
+			 *
+			 * \param vertex the vertex at the end of the edges.
+			 * \param functor the function to call
+			 * \sa eachPredecessorEdges(NodeRef_t, Functor&&)
+			 */
+			template <typename Functor>
+			void eachPredecessorEdges(ConstNode_t const& vertex, Functor&& functor) const;
+
+			/*! \brief Get the vertices of the graph, in increasing order of ids.
+			 *
+			 * \warning The range is invalidated when the graph is modified.
+			 */
+			VertexRange_t vertices() const;
+
+			/*! \brief Get the edges of the graph, grouped by start vertex.
+			 *
+			 * Each edge is a pair of NodeRef_t, the start and the end of the edge.
+			 *
+			 * \warning The range is invalidated when the graph is modified.
+			 */
+			EdgeRange_t edges() const;
+
+			/*! \brief Get the adjacents of a given vertex.
+			 *
+			 * \warning The range is invalidated when the graph is modified.
+			 *
+			 * \param nodeId The id of the vertex.
+			 */
+			AdjacentRange_t adjacents(size_t nodeId) const;
+
+			/*! \brief Get the vertices which are the start of an edge to a given vertex.
+			 *
+			 * The range is read from the reverse index, see setReverseIndex(). Without it, the
+			 * predecessors can still be found with eachPredecessors().
+			 *
+			 * \warning The range is invalidated when the graph is modified.
+			 *
+			 * \param nodeId The id of the vertex.
+			 * \exception std::logic_error If the reverse index is not enabled.
+			 */
+			AdjacentRange_t predecessors(size_t nodeId) const;
+
 			/*! \brief Get the id of from the name of a node.
 			 *
 			 * If the node is not in the graph, it will be added.
@@ -203,7 +428,7 @@ namespace graph {
 			 * \param name The name of the node.
 			 * \return The id of the node.
 			 */
-			size_t getId(std::string const& name);
+			size_t getId(std::string_view name);
 
 			/*! \brief Get the id of from the name of a node.
 			 *
@@ -211,7 +436,7 @@ namespace graph {
 			 * \return The id of the node.
 			 * \exception std::out_of_range If the node is not in the graph.
 			 */
-			size_t getId(std::string const& name) const;
+			size_t getId(std::string_view name) const;
 
 			/*! \brief Get the first node of the graph.
 			 *
@@ -230,14 +455,14 @@ namespace graph {
 			 * \param nodeName The name of the node.
 			 * \return The Node representing the given node.
 			 */
-			Node_t operator[](std::string const& nodeName);
+			Node_t operator[](std::string_view nodeName);
 
 			/*! \brief Return a Node representing a node from this graph with a given name.
 			 *
 			 * \param nodeName The name of the node.
 			 * \return The Node representing the given node.
 			 */
-			ConstNode_t operator[](std::string const& nodeName) const;
+			ConstNode_t operator[](std::string_view nodeName) const;
 
 			/*! \brief Check if two graphs are equal.
 			 *
@@ -256,9 +481,23 @@ namespace graph {
 			bool operator!=(Graph<OtherNodeProperty, OtherEdgeProperty> const& other) const;
 
 		protected:
+			/*! \brief Get the lowest name of the graph, in lexicographic order.
+			 */
+			std::string_view firstName() const;
+
+			/*! \brief Remove a node without changing the ids of the other nodes.
+			 *
+			 * \param nodeId The id of the node.
+			 */
+			void tombstoneNode(size_t nodeId);
+
+			/*! \brief Build the index of the incoming edges from the connections.
+			 */
+			void rebuildReverseIndex();
+
 			/*! \brief The matrix representing the connections in the graph.
 			 */
-			std::vector<std::vector<bool>> connections;
+			BitMatrix connections;
 
 			/*! \brief The properties of each nodes.
 			 */
@@ -266,11 +505,30 @@ namespace graph {
 
 			/*! \brief The properties of each edges.
 			 */
-			std::map<std::pair<std::string, std::string>, EdgeProperty> edgeProperties;
+			EdgePropertyMap<EdgeProperty> edgeProperties;
 
 			/*! \brief The name of each nodes.
+			 *
+			 * This is also used for reverse looking up the name of a node from which we know its
+			 * id.
+			 */
+			NameInterner nodeNames;
+
+			/*! \brief How removeNode() removes the nodes.
+			 */
+			RemovalMode removalMode = RemovalMode::Renumber;
+
+			/*! \brief The ids of the removed nodes which can be given to new nodes.
+			 */
+			std::vector<size_t> freeIds;
+
+			/*! \brief Whether the index of the incoming edges is kept.
+			 */
+			bool reverseIndexed = false;
+
+			/*! \brief The transpose of the connections, when reverseIndexed is set.
 			 */
-			std::map<std::string, size_t> nodeNames;
+			BitMatrix reverseConnections;
 		};
 
 		/*! \brief A graph to be used by an A* algorithm.
@@ -5,7 +5,9 @@
 #include <algorithm>
 #include <functional>
 #include <sstream>
+#include <stdexcept>
 #include <type_traits>
+#include <utility>
 
 namespace graph {
 	namespace matrix {
@@ -27,26 +29,34 @@ namespace graph {
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
-		bool Graph<NodeProperty, EdgeProperty>::hasNode(std::string const& nodeName) const {
-			return static_cast<bool>(nodeNames.count(nodeName));
+		bool Graph<NodeProperty, EdgeProperty>::hasNode(std::string_view nodeName) const {
+			return nodeNames.contains(nodeName);
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
-		void Graph<NodeProperty, EdgeProperty>::addNode(std::string const& nodeName,
+		void Graph<NodeProperty, EdgeProperty>::addNode(std::string_view nodeName,
 		                                                NodeProperty property) {
-			if(!hasNode(nodeName)) {
-				size_t nodeId       = connections.size();
-				nodeNames[nodeName] = nodeId;
-				nodeProperties.push_back(property);
-				for(auto& eachConnections : connections) {
-					eachConnections.push_back(false);
+			if(freeIds.empty()) {
+				size_t nodeId = nodeNames.insert(nodeName);
+				if(nodeId == nodeProperties.size()) {
+					nodeProperties.push_back(property);
+					connections.resize(nodeId + 1, nodeId + 1);
+					if(reverseIndexed) {
+						reverseConnections.resize(nodeId + 1, nodeId + 1);
+					}
 				}
-				connections.push_back(std::vector<bool>(nodeId + 1, false));
+			} else if(!nodeNames.contains(nodeName)) {
+				// The row and the column of a removed node are already empty.
+				size_t nodeId = freeIds.back();
+				freeIds.pop_back();
+
+				nodeNames.insertAt(nodeName, nodeId);
+				nodeProperties[nodeId] = std::move(property);
 			}
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
-		void Graph<NodeProperty, EdgeProperty>::addNode(std::string const& nodeName) {
+		void Graph<NodeProperty, EdgeProperty>::addNode(std::string_view nodeName) {
 			addNode(nodeName, NodeProperty());
 		}
 
@@ -56,40 +66,107 @@ namespace graph {
 			std::string nodeName = node.getName();
 
 			if(hasNode(nodeName)) {
-				size_t nodeId = nodeNames[nodeName];
+				if(removalMode == RemovalMode::Tombstone) {
+					tombstoneNode(nodeNames.find(nodeName));
+					return;
+				}
 
-				nodeNames.erase(node.getName());
-				for(auto& node : nodeNames) {
-					if(node.second > nodeId) {
-						--node.second;
-					}
+				// The renumbering below needs dense ids.
+				compact();
+
+				size_t nodeId = nodeNames.find(nodeName);
+
+				std::vector<size_t> newIds(nodeProperties.size());
+				for(size_t oldId = 0; oldId < newIds.size(); ++oldId) {
+					newIds[oldId] = oldId < nodeId ? oldId : oldId - 1;
 				}
+				newIds[nodeId] = NameInterner::npos;
 
-				connections.erase(connections.begin() + nodeId);
-				this->eachEdges([this, nodeId](ConstNode_t const& begin, ConstNode_t const& end) {
-					if(end.getId() == nodeId) {
-						removeEdge((*this)[begin.getName()], (*this)[end.getName()]);
-					}
-				});
+				edgeProperties.renumber(newIds);
+				connections.eraseRowAndColumn(nodeId);
+				if(reverseIndexed) {
+					reverseConnections.eraseRowAndColumn(nodeId);
+				}
+				nodeNames.erase(nodeId);
+				nodeProperties.erase(nodeProperties.begin() + nodeId);
+			}
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		void Graph<NodeProperty, EdgeProperty>::setRemovalMode(RemovalMode mode) {
+			removalMode = mode;
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		RemovalMode Graph<NodeProperty, EdgeProperty>::getRemovalMode() const {
+			return removalMode;
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		void Graph<NodeProperty, EdgeProperty>::setReverseIndex(bool enabled) {
+			reverseIndexed = enabled;
+			if(enabled) {
+				rebuildReverseIndex();
+			} else {
+				reverseConnections = BitMatrix();
+			}
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		bool Graph<NodeProperty, EdgeProperty>::hasReverseIndex() const {
+			return reverseIndexed;
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		void Graph<NodeProperty, EdgeProperty>::compact() {
+			if(freeIds.empty()) {
+				return;
+			}
+
+			std::vector<size_t> newIds = nodeNames.compact();
 
-				for(auto& nodeConnections : connections) {
-					nodeConnections.erase(nodeConnections.begin() + nodeId);
+			BitMatrix newConnections(nodeNames.size(), nodeNames.size());
+			std::vector<NodeProperty> newNodeProperties;
+			newNodeProperties.reserve(nodeNames.size());
+
+			for(size_t beginId = 0; beginId < newIds.size(); ++beginId) {
+				size_t newBeginId = newIds[beginId];
+				if(newBeginId == NameInterner::npos) {
+					continue;
 				}
+
+				newNodeProperties.push_back(std::move(nodeProperties[beginId]));
+				connections.eachSetBits(
+				        beginId, [&newConnections, &newIds, newBeginId](size_t endId) {
+					        newConnections.set(newBeginId, newIds[endId]);
+				        });
+			}
+
+			edgeProperties.renumber(newIds);
+			connections = std::move(newConnections);
+			nodeProperties.swap(newNodeProperties);
+			freeIds.clear();
+
+			if(reverseIndexed) {
+				rebuildReverseIndex();
 			}
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
 		bool Graph<NodeProperty, EdgeProperty>::hasEdge(ConstNode_t const& begin,
 		                                                ConstNode_t const& end) const {
-			return static_cast<bool>(edgeProperties.count({begin.getName(), end.getName()}));
+			return connections.test(begin.getId(), end.getId());
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
 		void Graph<NodeProperty, EdgeProperty>::addEdges(Edge_t const& edge) {
 			std::string start = std::move(std::get<0>(edge)), end = std::move(std::get<1>(edge));
 			size_t beginId = getId(start), endId = getId(end);
-			connections[beginId][endId]  = true;
-			edgeProperties[{start, end}] = std::get<EdgeProperty>(edge);
+			connections.set(beginId, endId);
+			edgeProperties.set(beginId, endId, std::get<EdgeProperty>(edge));
+			if(reverseIndexed) {
+				reverseConnections.set(endId, beginId);
+			}
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
@@ -113,8 +190,11 @@ namespace graph {
 		                                                ConstNode_t const& end,
 		                                                EdgeProperty property) {
 			size_t beginId = begin.getId(), endId = end.getId();
-			connections[beginId][endId] = true;
-			edgeProperties[{begin.getName(), end.getName()}] = std::move(property);
+			connections.set(beginId, endId);
+			edgeProperties.set(beginId, endId, std::move(property));
+			if(reverseIndexed) {
+				reverseConnections.set(endId, beginId);
+			}
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
@@ -128,61 +208,117 @@ namespace graph {
 		                                                   ConstNode_t const& end) {
 			size_t beginId = begin.getId(), endId = end.getId();
 
-			if(!connections[beginId][endId]) {
+			if(!connections.test(beginId, endId)) {
 				std::ostringstream errMsg;
 				errMsg << "No such edge if the graph: (" << begin.getName() << ", " << end.getName()
 				       << "), with id: (" << begin.getId() << ", " << end.getId() << ").";
 				throw std::out_of_range(errMsg.str());
 			}
 
-			connections[beginId][endId] = false;
-
-			edgeProperties.erase({begin.getName(), end.getName()});
+			connections.reset(beginId, endId);
+			edgeProperties.erase(beginId, endId);
+			if(reverseIndexed) {
+				reverseConnections.reset(endId, beginId);
+			}
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
 		EdgeProperty Graph<NodeProperty, EdgeProperty>::getEdgeProperty(
 		        ConstNode_t const& begin,
 		        ConstNode_t const& end) const {
-			// Use .at() instead of operator[] because the method .at() throw if the key does not
-			// exists, instead of inserting a new key, allowing "getEdgeProperty" to be const.
-			return edgeProperties.at({begin.getName(), end.getName()});
+			return getEdgeProperty(begin.getId(), end.getId());
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		EdgeProperty Graph<NodeProperty, EdgeProperty>::getEdgeProperty(size_t beginId,
+		                                                                size_t endId) const {
+			if(!connections.test(beginId, endId)) {
+				std::ostringstream errMsg;
+				errMsg << "No such edge if the graph: (" << nodeNames[beginId] << ", "
+				       << nodeNames[endId] << "), with id: (" << beginId << ", " << endId << ").";
+				throw std::out_of_range(errMsg.str());
+			}
+
+			return edgeProperties.get(beginId, endId);
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
 		void Graph<NodeProperty, EdgeProperty>::setEdgeProperty(ConstNode_t const& begin,
 		                                                        ConstNode_t const& end,
 		                                                        EdgeProperty property) {
-			edgeProperties.at({begin.getName(), end.getName()}) = std::move(property);
+			size_t beginId = begin.getId(), endId = end.getId();
+
+			if(!connections.test(beginId, endId)) {
+				std::ostringstream errMsg;
+				errMsg << "No such edge if the graph: (" << begin.getName() << ", " << end.getName()
+				       << "), with id: (" << beginId << ", " << endId << ").";
+				throw std::out_of_range(errMsg.str());
+			}
+
+			edgeProperties.set(beginId, endId, std::move(property));
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
 		std::vector<std::vector<bool>> Graph<NodeProperty, EdgeProperty>::getConnections() const {
+			std::vector<std::vector<bool>> result;
+			result.reserve(connections.getRowsCount());
+			for(size_t i = 0; i < connections.getRowsCount(); ++i) {
+				result.push_back(connections.getRow(i));
+			}
+			return result;
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		BitMatrix const& Graph<NodeProperty, EdgeProperty>::getMatrix() const {
 			return connections;
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
 		size_t Graph<NodeProperty, EdgeProperty>::getVerticesCount() const {
-			return connections.size();
+			return nodeNames.size();
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
 		size_t Graph<NodeProperty, EdgeProperty>::getEdgesCount() const {
-			size_t count = 0;
-			for(auto const& subArray : connections) {
-				count += std::count(subArray.begin(), subArray.end(), true);
-			}
-			return count;
+			return connections.count();
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		size_t Graph<NodeProperty, EdgeProperty>::getIdBound() const {
+			return nodeNames.getIdBound();
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		bool Graph<NodeProperty, EdgeProperty>::hasNodeId(size_t nodeId) const {
+			return nodeNames.hasId(nodeId);
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		std::string_view Graph<NodeProperty, EdgeProperty>::getName(size_t nodeId) const {
+			return nodeNames[nodeId];
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		NodeProperty const& Graph<NodeProperty, EdgeProperty>::getNodeProperty(
+		        size_t nodeId) const {
+			return nodeProperties[nodeId];
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		auto Graph<NodeProperty, EdgeProperty>::getNode(size_t nodeId) const -> ConstNode_t {
+			return ConstNode_t(nodeId, connections, std::string(nodeNames[nodeId]), nodeProperties);
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
 		template <typename Functor>
 		void Graph<NodeProperty, EdgeProperty>::eachVertices(Functor&& functor) const {
-			static_assert(std::is_convertible<Functor, std::function<void(ConstNode_t)>>::value,
-			              "The function must be convertible to a function of type void(ConstNode)");
+			static_assert(std::is_convertible<Functor, std::function<void(NodeRef_t)>>::value,
+			              "The function must be convertible to a function of type void(NodeRef)");
 
-			for(auto const& node : nodeNames) {
-				functor(std::move((*this)[node.first]));
+			for(size_t nodeId = 0; nodeId < nodeNames.getIdBound(); ++nodeId) {
+				if(nodeNames.hasId(nodeId)) {
+					functor(NodeRef_t(*this, nodeId));
+				}
 			}
 		}
 
@@ -190,68 +326,203 @@ namespace graph {
 		template <typename Functor>
 		void Graph<NodeProperty, EdgeProperty>::eachEdges(Functor&& functor) const {
 			static_assert(std::is_convertible<Functor,
-			                                  std::function<void(ConstNode_t, ConstNode_t)>>::value,
-			              "The function must be convertible to a function of type void(ConstNode, "
-			              "ConstNode)");
-
-			for(auto const& begin: nodeNames) {
-				for(auto const& end: nodeNames) {
-					if(connections[begin.second][end.second]) {
-						functor(std::move((*this)[begin.first]), std::move((*this)[end.first]));
-					}
+			                                  std::function<void(NodeRef_t, NodeRef_t)>>::value,
+			              "The function must be convertible to a function of type void(NodeRef, "
+			              "NodeRef)");
+
+			// The edges of removed nodes are always unset, so only the rows need to be checked.
+			for(size_t beginId = 0; beginId < nodeNames.getIdBound(); ++beginId) {
+				if(nodeNames.hasId(beginId)) {
+					connections.eachSetBits(beginId, [this, &functor, beginId](size_t endId) {
+						functor(NodeRef_t(*this, beginId), NodeRef_t(*this, endId));
+					});
 				}
 			}
 		}
 
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachAdjacents(NodeRef_t vertex,
+		                                                      Functor&& functor) const {
+			static_assert(std::is_convertible<Functor, std::function<void(NodeRef_t)>>::value,
+			              "The function must be convertible to a function of type void(NodeRef)");
+
+			connections.eachSetBits(vertex.getId(), [this, &functor](size_t endId) {
+				functor(NodeRef_t(*this, endId));
+			});
+		}
+
 		template <typename NodeProperty, typename EdgeProperty>
 		template <typename Functor>
 		void Graph<NodeProperty, EdgeProperty>::eachAdjacents(ConstNode_t const& vertex,
 		                                                      Functor&& functor) const {
-			static_assert(std::is_convertible<Functor, std::function<void(ConstNode_t)>>::value,
-			              "The function must be convertible to a function of type void(ConstNode)");
+			eachAdjacents(NodeRef_t(*this, vertex.getId()), std::forward<Functor>(functor));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachAdjacentEdges(NodeRef_t vertex,
+		                                                          Functor&& functor) const {
+			static_assert(
+			        std::is_convertible<Functor,
+			                            std::function<void(NodeRef_t, EdgeProperty const&)>>::value,
+			        "The function must be convertible to a function of type "
+			        "void(NodeRef, EdgeProperty const&)");
+			size_t vertexId = vertex.getId();
+
+			connections.eachSetBits(vertexId, [this, &functor, vertexId](size_t endId) {
+				functor(NodeRef_t(*this, endId), edgeProperties.get(vertexId, endId));
+			});
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachAdjacentEdges(ConstNode_t const& vertex,
+		                                                          Functor&& functor) const {
+			eachAdjacentEdges(NodeRef_t(*this, vertex.getId()), std::forward<Functor>(functor));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachPredecessors(NodeRef_t vertex,
+		                                                         Functor&& functor) const {
+			static_assert(std::is_convertible<Functor, std::function<void(NodeRef_t)>>::value,
+			              "The function must be convertible to a function of type void(NodeRef)");
 			size_t vertexId = vertex.getId();
 
-			for(auto const& vertex : nodeNames) {
-				if(connections[vertexId][vertex.second]) {
-					functor(std::move((*this)[vertex.first]));
+			if(reverseIndexed) {
+				reverseConnections.eachSetBits(vertexId, [this, &functor](size_t beginId) {
+					functor(NodeRef_t(*this, beginId));
+				});
+				return;
+			}
+
+			// The edges of removed nodes are always unset, so there is no need to check the ids.
+			for(size_t beginId = 0; beginId < connections.getRowsCount(); ++beginId) {
+				if(connections.test(beginId, vertexId)) {
+					functor(NodeRef_t(*this, beginId));
 				}
 			}
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
-		size_t Graph<NodeProperty, EdgeProperty>::getId(std::string const& name) {
-			if(!hasNode(name)) {
-				addNode(name);
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachPredecessors(ConstNode_t const& vertex,
+		                                                         Functor&& functor) const {
+			eachPredecessors(NodeRef_t(*this, vertex.getId()), std::forward<Functor>(functor));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachPredecessorEdges(NodeRef_t vertex,
+		                                                             Functor&& functor) const {
+			static_assert(
+			        std::is_convertible<Functor,
+			                            std::function<void(NodeRef_t, EdgeProperty const&)>>::value,
+			        "The function must be convertible to a function of type "
+			        "void(NodeRef, EdgeProperty const&)");
+			size_t vertexId = vertex.getId();
+
+			if(reverseIndexed) {
+				reverseConnections.eachSetBits(vertexId,
+				                               [this, &functor, vertexId](size_t beginId) {
+					                               functor(NodeRef_t(*this, beginId),
+					                                       edgeProperties.get(beginId, vertexId));
+				                               });
+				return;
+			}
+
+			for(size_t beginId = 0; beginId < connections.getRowsCount(); ++beginId) {
+				if(connections.test(beginId, vertexId)) {
+					functor(NodeRef_t(*this, beginId), edgeProperties.get(beginId, vertexId));
+				}
 			}
-			return nodeNames[name];
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
-		size_t Graph<NodeProperty, EdgeProperty>::getId(std::string const& name) const {
-			return nodeNames.at(name);
+		template <typename Functor>
+		void Graph<NodeProperty, EdgeProperty>::eachPredecessorEdges(ConstNode_t const& vertex,
+		                                                             Functor&& functor) const {
+			eachPredecessorEdges(NodeRef_t(*this, vertex.getId()), std::forward<Functor>(functor));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		auto Graph<NodeProperty, EdgeProperty>::vertices() const -> VertexRange_t {
+			return VertexRange_t(VertexIterator<Graph>(*this, 0),
+			                     VertexIterator<Graph>(*this, getIdBound()));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		auto Graph<NodeProperty, EdgeProperty>::edges() const -> EdgeRange_t {
+			VertexRange_t range = vertices();
+			return EdgeRange_t(EdgeIterator<Graph>(range.begin(), range.end()),
+			                   EdgeIterator<Graph>(range.end(), range.end()));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		auto Graph<NodeProperty, EdgeProperty>::adjacents(size_t nodeId) const
+		        -> AdjacentRange_t {
+			using Iterator = typename AdjacentRange_t::iterator;
+
+			bits::SetBitIterator first = connections.beginSetBits(nodeId),
+			                     last  = connections.endSetBits(nodeId);
+			return AdjacentRange_t(Iterator(*this, first, last, false),
+			                       Iterator(*this, last, last, false));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		auto Graph<NodeProperty, EdgeProperty>::predecessors(size_t nodeId) const
+		        -> AdjacentRange_t {
+			using Iterator = typename AdjacentRange_t::iterator;
+
+			if(!reverseIndexed) {
+				throw std::logic_error("The predecessors ranges need the reverse index, see "
+				                       "setReverseIndex().");
+			}
+
+			bits::SetBitIterator first = reverseConnections.beginSetBits(nodeId),
+			                     last  = reverseConnections.endSetBits(nodeId);
+			return AdjacentRange_t(Iterator(*this, first, last, false),
+			                       Iterator(*this, last, last, false));
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		size_t Graph<NodeProperty, EdgeProperty>::getId(std::string_view name) {
+			addNode(name);
+			return nodeNames.find(name);
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		size_t Graph<NodeProperty, EdgeProperty>::getId(std::string_view name) const {
+			size_t nodeId = nodeNames.find(name);
+			if(nodeId == NameInterner::npos) {
+				std::ostringstream errMsg;
+				errMsg << "No such node in the graph: " << name << ".";
+				throw std::out_of_range(errMsg.str());
+			}
+			return nodeId;
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
 		auto Graph<NodeProperty, EdgeProperty>::begin() -> Node_t {
-			return (*this)[nodeNames.begin()->first];
+			return (*this)[firstName()];
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
 		auto Graph<NodeProperty, EdgeProperty>::begin() const -> ConstNode_t {
-			return (*this)[nodeNames.begin()->first];
+			return (*this)[firstName()];
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
-		auto Graph<NodeProperty, EdgeProperty>::operator[](std::string const& nodeName) -> Node_t {
+		auto Graph<NodeProperty, EdgeProperty>::operator[](std::string_view nodeName) -> Node_t {
 			size_t nodeId = getId(nodeName);
-			return Node_t(nodeId, connections[nodeId], nodeName, nodeProperties);
+			return Node_t(nodeId, connections, std::string(nodeName), nodeProperties);
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
-		auto Graph<NodeProperty, EdgeProperty>::operator[](std::string const& nodeName) const
+		auto Graph<NodeProperty, EdgeProperty>::operator[](std::string_view nodeName) const
 		        -> ConstNode_t {
-			size_t nodeId = getId(nodeName);
-			return ConstNode_t(nodeId, connections[nodeId], nodeName, nodeProperties);
+			return getNode(getId(nodeName));
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
@@ -260,18 +531,35 @@ namespace graph {
 		        Graph<OtherNodeProperty, OtherEdgeProperty> const& other) const {
 
 			// Compare node names and number of nodes
-			if(!std::equal(nodeNames.begin(),
-			               nodeNames.end(),
-			               other.nodeNames.begin(),
-			               other.nodeNames.end(),
-			               [](std::pair<std::string, size_t> const& a,
-			                  std::pair<std::string, size_t> const& b) {
-				               return a.first == b.first;
-				           })) {
+			if(!nodeNames.hasSameNames(other.nodeNames)) {
+				return false;
+			}
+
+			if(getEdgesCount() != other.getEdgesCount()) {
 				return false;
 			}
 
-			return edgeProperties == other.edgeProperties;
+			// Compare the edges by the names of their nodes, as the ids may differ
+			for(size_t beginId = 0; beginId < nodeNames.getIdBound(); ++beginId) {
+				if(!nodeNames.hasId(beginId)) {
+					continue;
+				}
+
+				size_t otherBeginId = other.getId(nodeNames[beginId]);
+				bool equal          = true;
+				connections.eachSetBits(
+				        beginId, [this, &other, &equal, beginId, otherBeginId](size_t endId) {
+					        size_t otherEndId = other.getId(nodeNames[endId]);
+					        equal = equal && other.connections.test(otherBeginId, otherEndId) &&
+					                edgeProperties.get(beginId, endId) ==
+					                        other.edgeProperties.get(otherBeginId, otherEndId);
+				        });
+				if(!equal) {
+					return false;
+				}
+			}
+
+			return true;
 		}
 
 		template <typename NodeProperty, typename EdgeProperty>
@@ -280,5 +568,59 @@ namespace graph {
 		        Graph<OtherNodeProperty, OtherEdgeProperty> const& other) const {
 			return !(*this == other);
 		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		std::string_view Graph<NodeProperty, EdgeProperty>::firstName() const {
+			size_t firstId = NameInterner::npos;
+			for(size_t nodeId = 0; nodeId < nodeNames.getIdBound(); ++nodeId) {
+				if(nodeNames.hasId(nodeId) &&
+				   (firstId == NameInterner::npos || nodeNames[nodeId] < nodeNames[firstId])) {
+					firstId = nodeId;
+				}
+			}
+			return nodeNames[firstId];
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		void Graph<NodeProperty, EdgeProperty>::tombstoneNode(size_t nodeId) {
+			connections.eachSetBits(nodeId, [this, nodeId](size_t endId) {
+				edgeProperties.erase(nodeId, endId);
+				if(reverseIndexed) {
+					reverseConnections.reset(endId, nodeId);
+				}
+			});
+			connections.resetRow(nodeId);
+
+			if(reverseIndexed) {
+				// The index gives the edges to the node without scanning the whole column.
+				reverseConnections.eachSetBits(nodeId, [this, nodeId](size_t beginId) {
+					connections.reset(beginId, nodeId);
+					edgeProperties.erase(beginId, nodeId);
+				});
+				reverseConnections.resetRow(nodeId);
+			} else {
+				for(size_t beginId = 0; beginId < connections.getRowsCount(); ++beginId) {
+					if(connections.test(beginId, nodeId)) {
+						connections.reset(beginId, nodeId);
+						edgeProperties.erase(beginId, nodeId);
+					}
+				}
+			}
+
+			nodeProperties[nodeId] = NodeProperty();
+			nodeNames.release(nodeId);
+			freeIds.push_back(nodeId);
+		}
+
+		template <typename NodeProperty, typename EdgeProperty>
+		void Graph<NodeProperty, EdgeProperty>::rebuildReverseIndex() {
+			reverseConnections =
+			      BitMatrix(connections.getRowsCount(), connections.getColumnsCount());
+			for(size_t beginId = 0; beginId < connections.getRowsCount(); ++beginId) {
+				connections.eachSetBits(beginId, [this, beginId](size_t endId) {
+					reverseConnections.set(endId, beginId);
+				});
+			}
+		}
 	}
 }
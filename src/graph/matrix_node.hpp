@@ -1,5 +1,8 @@
 #pragma once
 
+#include "bit_matrix.hpp"
+#include "node_ref.hpp"
+
 #include <vector>
 #include <string>
 
@@ -16,8 +19,8 @@ namespace graph {
 		class GenericNode {
 			using NodeProperty = typename std::decay_t<NodePropertyVector>::value_type;
 		public:
-			friend class GenericNode<NodePropertyVector, std::vector<bool>&>;
-			friend class GenericNode<NodePropertyVector, std::vector<bool> const&>;
+			friend class GenericNode<NodePropertyVector, BitMatrix&>;
+			friend class GenericNode<NodePropertyVector, BitMatrix const&>;
 
 			GenericNode() = delete;
 
@@ -125,8 +128,8 @@ namespace graph {
 		 * will result in a dandling reference.
 		 */
 		template <typename NodeProperty>
-		class Node : public GenericNode<std::vector<NodeProperty>&, std::vector<bool>&> {
-			using ParentClass = GenericNode<std::vector<NodeProperty>&, std::vector<bool>&>;
+		class Node : public GenericNode<std::vector<NodeProperty>&, BitMatrix&> {
+			using ParentClass = GenericNode<std::vector<NodeProperty>&, BitMatrix&>;
 		public:
 			/*! \brief Node default constructor.
 			 *
@@ -136,7 +139,7 @@ namespace graph {
 			 * \param property The property of the node.
 			 */
 			Node(size_t id,
-			     std::vector<bool>& connections,
+			     BitMatrix& connections,
 			     std::string name,
 			     std::vector<NodeProperty>& property);
 
@@ -161,9 +164,9 @@ namespace graph {
 		 */
 		template <typename NodeProperty>
 		class ConstNode
-		        : public GenericNode<std::vector<NodeProperty> const&, std::vector<bool> const&> {
+		        : public GenericNode<std::vector<NodeProperty> const&, BitMatrix const&> {
 			using ParentClass =
-			        GenericNode<std::vector<NodeProperty> const&, std::vector<bool> const&>;
+			        GenericNode<std::vector<NodeProperty> const&, BitMatrix const&>;
 
 		public:
 			/*! \brief Node default constructor.
@@ -174,7 +177,7 @@ namespace graph {
 			 * \param property a reference to the properties vector of the parent Graph.
 			 */
 			ConstNode(size_t id,
-			          std::vector<bool> const& connections,
+			          BitMatrix const& connections,
 			          std::string name,
 			          std::vector<NodeProperty> const& property);
 
@@ -183,6 +186,13 @@ namespace graph {
 			 * \param other The Node to convert.
 			 */
 			ConstNode(Node<NodeProperty> const& other);
+
+			/*! \brief Convert a NodeRef to a ConstNode.
+			 *
+			 * \param node The handle to convert.
+			 */
+			template <typename Graph>
+			ConstNode(NodeRef<Graph> const& node);
 		};
 	}
 }
@@ -51,7 +51,7 @@ namespace graph {
 		template <typename NodePropertyVector, typename Connections>
 		bool GenericNode<NodePropertyVector, Connections>::isConnectedTo(
 		        GenericNode<NodePropertyVector, Connections> const& other) const {
-			return connections[other.getId()];
+			return connections.test(id, other.getId());
 		}
 
 		template <typename NodePropertyVector, typename Connections>
@@ -66,7 +66,7 @@ namespace graph {
 
 		template <typename NodePropertyVector, typename Connections>
 		std::vector<bool> GenericNode<NodePropertyVector, Connections>::getConnections() const {
-			return connections;
+			return connections.getRow(id);
 		}
 
 		template <typename NodePropertyVector, typename Connections>
@@ -77,7 +77,7 @@ namespace graph {
 
 		template <typename NodeProperty>
 		Node<NodeProperty>::Node(size_t id,
-		                         std::vector<bool>& connections,
+		                         BitMatrix& connections,
 		                         std::string name,
 		                         std::vector<NodeProperty>& property)
 		      : ParentClass(id, connections, std::move(name), property) {}
@@ -94,7 +94,7 @@ namespace graph {
 
 		template <typename NodeProperty>
 		ConstNode<NodeProperty>::ConstNode(size_t id,
-		                                   std::vector<bool> const& connections,
+		                                   BitMatrix const& connections,
 		                                   std::string name,
 		                                   std::vector<NodeProperty> const& property)
 		      : ParentClass(id, connections, std::move(name), property) {}
@@ -102,5 +102,10 @@ namespace graph {
 		template <typename NodePropertyVector>
 		ConstNode<NodePropertyVector>::ConstNode(Node<NodePropertyVector> const& other)
 		      : ParentClass(other.id, other.connections, other.name, other.property) {}
+
+		template <typename NodeProperty>
+		template <typename Graph>
+		ConstNode<NodeProperty>::ConstNode(NodeRef<Graph> const& node)
+		      : ConstNode(node.getGraph().getNode(node.getId())) {}
 	}
 }
@@ -0,0 +1,217 @@
+#include "name_interner.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace graph {
+
+	namespace {
+		// The table is grown when more than 7/10th of the slots are used.
+		constexpr size_t const maxLoadNumerator   = 7;
+		constexpr size_t const maxLoadDenominator = 10;
+
+		constexpr size_t const minimumSlotsCount = 16;
+	}
+
+	size_t NameInterner::size() const {
+		return count;
+	}
+
+	size_t NameInterner::getIdBound() const {
+		return spans.size();
+	}
+
+	bool NameInterner::hasId(size_t id) const {
+		return id < spans.size() && spans[id].length != npos;
+	}
+
+	bool NameInterner::contains(std::string_view name) const {
+		return find(name) != npos;
+	}
+
+	size_t NameInterner::find(std::string_view name) const {
+		if(slots.empty()) {
+			return npos;
+		}
+		return slots[findSlot(name, hash(name))].id;
+	}
+
+	size_t NameInterner::insert(std::string_view name) {
+		reserveSlot();
+
+		std::uint64_t nameHash = hash(name);
+		Slot& slot             = slots[findSlot(name, nameHash)];
+
+		if(slot.id == npos) {
+			slot.id   = spans.size();
+			slot.hash = nameHash;
+			spans.push_back(Span{pool.size(), name.size()});
+			pool.append(name.data(), name.size());
+			++count;
+		}
+
+		return slot.id;
+	}
+
+	void NameInterner::insertAt(std::string_view name, size_t id) {
+		reserveSlot();
+
+		std::uint64_t nameHash = hash(name);
+		slots[findSlot(name, nameHash)] = Slot{nameHash, id};
+
+		if(id == spans.size()) {
+			spans.push_back(Span{0, 0});
+		}
+		spans[id] = Span{pool.size(), name.size()};
+		pool.append(name.data(), name.size());
+		++count;
+	}
+
+	void NameInterner::erase(size_t id) {
+		if(hasId(id)) {
+			unusedCharacters += spans[id].length;
+			--count;
+		}
+		spans.erase(spans.begin() + id);
+
+		// Every following id changes, so the whole table is rebuilt.
+		rehash(slots.size());
+		shrinkPool();
+	}
+
+	void NameInterner::release(size_t id) {
+		removeSlot(findSlot((*this)[id], hash((*this)[id])));
+
+		unusedCharacters += spans[id].length;
+		spans[id].length = npos;
+		--count;
+
+		shrinkPool();
+	}
+
+	std::vector<size_t> NameInterner::compact() {
+		std::vector<size_t> newIds(spans.size(), npos);
+
+		size_t newId = 0;
+		for(size_t id = 0; id < spans.size(); ++id) {
+			if(hasId(id)) {
+				newIds[id]    = newId;
+				spans[newId] = spans[id];
+				++newId;
+			}
+		}
+		spans.resize(newId);
+
+		rehash(slots.size());
+		shrinkPool();
+
+		return newIds;
+	}
+
+	std::string_view NameInterner::operator[](size_t id) const {
+		return std::string_view(pool.data() + spans[id].offset, spans[id].length);
+	}
+
+	std::vector<size_t> NameInterner::getSortedIds() const {
+		std::vector<size_t> ids;
+		ids.reserve(count);
+		for(size_t id = 0; id < spans.size(); ++id) {
+			if(hasId(id)) {
+				ids.push_back(id);
+			}
+		}
+
+		std::sort(ids.begin(), ids.end(), [this](size_t a, size_t b) {
+			return (*this)[a] < (*this)[b];
+		});
+		return ids;
+	}
+
+	bool NameInterner::hasSameNames(NameInterner const& other) const {
+		if(size() != other.size()) {
+			return false;
+		}
+
+		for(size_t id = 0; id < spans.size(); ++id) {
+			if(hasId(id) && !other.contains((*this)[id])) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	std::uint64_t NameInterner::hash(std::string_view name) {
+		return std::hash<std::string_view>()(name);
+	}
+
+	size_t NameInterner::findSlot(std::string_view name, std::uint64_t nameHash) const {
+		size_t mask = slots.size() - 1;
+
+		for(size_t position = nameHash & mask;; position = (position + 1) & mask) {
+			Slot const& slot = slots[position];
+			if(slot.id == npos || (slot.hash == nameHash && (*this)[slot.id] == name)) {
+				return position;
+			}
+		}
+	}
+
+	void NameInterner::reserveSlot() {
+		if((count + 1) * maxLoadDenominator > slots.size() * maxLoadNumerator) {
+			rehash(std::max(minimumSlotsCount, 2 * slots.size()));
+		}
+	}
+
+	void NameInterner::removeSlot(size_t position) {
+		size_t mask = slots.size() - 1, hole = position;
+
+		// A following slot of the cluster can fill the hole if its ideal position is not between
+		// the hole and itself.
+		for(size_t next = (hole + 1) & mask; slots[next].id != npos; next = (next + 1) & mask) {
+			size_t ideal = slots[next].hash & mask;
+			if(((next - ideal) & mask) >= ((next - hole) & mask)) {
+				slots[hole] = slots[next];
+				hole        = next;
+			}
+		}
+
+		slots[hole].id = npos;
+	}
+
+	void NameInterner::rehash(size_t slotsCount) {
+		slots.assign(slotsCount, Slot{0, npos});
+
+		size_t mask = slotsCount - 1;
+		for(size_t id = 0; id < spans.size(); ++id) {
+			if(!hasId(id)) {
+				continue;
+			}
+
+			std::uint64_t nameHash = hash((*this)[id]);
+
+			size_t position = nameHash & mask;
+			while(slots[position].id != npos) {
+				position = (position + 1) & mask;
+			}
+			slots[position] = Slot{nameHash, id};
+		}
+	}
+
+	void NameInterner::shrinkPool() {
+		if(unusedCharacters <= pool.size() / 2) {
+			return;
+		}
+
+		std::string newPool;
+		newPool.reserve(pool.size() - unusedCharacters);
+		for(auto& span : spans) {
+			if(span.length != npos) {
+				size_t offset = newPool.size();
+				newPool.append(pool, span.offset, span.length);
+				span.offset = offset;
+			}
+		}
+
+		pool.swap(newPool);
+		unusedCharacters = 0;
+	}
+}
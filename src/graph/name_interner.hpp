@@ -0,0 +1,198 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace graph {
+
+	/*! \brief Associate a dense id to each name of a set of names.
+	 *
+	 * The names are stored one after the other in a single contiguous pool, and are looked up
+	 * through an open-addressing (linear probing) hash table which stores the hash of each name
+	 * next to its id, so that most unsuccessful comparisons never touch the pool.
+	 *
+	 * Lookups take a `std::string_view`, so that callers holding a `char const*` or a part of a
+	 * bigger string do not need to build a `std::string`.
+	 *
+	 * The ids are given in insertion order, starting from 0. A name can also be released without
+	 * changing the other ids, in which case its id stays unused until it is given again through
+	 * insertAt() or until the ids are renumbered by compact().
+	 */
+	class NameInterner {
+	public:
+		/*! \brief The value returned by find() when the name is not in the interner.
+		 */
+		static constexpr size_t const npos = static_cast<size_t>(-1);
+
+		/*! \brief Create an empty interner.
+		 */
+		NameInterner() = default;
+
+		/*! \brief Get the number of names in the interner.
+		 */
+		size_t size() const;
+
+		/*! \brief Get one past the greatest id given by the interner.
+		 *
+		 * This is equal to size() when no id is released.
+		 */
+		size_t getIdBound() const;
+
+		/*! \brief Check if an id is associated to a name.
+		 *
+		 * \param id The id to check.
+		 */
+		bool hasId(size_t id) const;
+
+		/*! \brief Check if a name is in the interner.
+		 *
+		 * \param name The name to look up.
+		 */
+		bool contains(std::string_view name) const;
+
+		/*! \brief Get the id of a name.
+		 *
+		 * \param name The name to look up.
+		 * \return The id of the name, or npos if the name is not in the interner.
+		 */
+		size_t find(std::string_view name) const;
+
+		/*! \brief Add a name to the interner, if it is not already in it.
+		 *
+		 * A new name is given the id getIdBound().
+		 *
+		 * \param name The name to add.
+		 * \return The id of the name.
+		 */
+		size_t insert(std::string_view name);
+
+		/*! \brief Add a name which is not in the interner with a given id.
+		 *
+		 * \param name The name to add.
+		 * \param id A released id, or getIdBound().
+		 */
+		void insertAt(std::string_view name, size_t id);
+
+		/*! \brief Remove a name from the interner.
+		 *
+		 * The id of every name added after the removed one is decremented.
+		 *
+		 * \param id The id of the name to remove.
+		 */
+		void erase(size_t id);
+
+		/*! \brief Remove a name from the interner, without changing the other ids.
+		 *
+		 * \param id The id of the name to remove.
+		 */
+		void release(size_t id);
+
+		/*! \brief Renumber the ids so that they are dense again, keeping their order.
+		 *
+		 * \return The new id of each old id, or npos for the released ids.
+		 */
+		std::vector<size_t> compact();
+
+		/*! \brief Get the name associated to an id.
+		 *
+		 * \warning The returned view is invalidated when a name is added or removed.
+		 *
+		 * \param id The id of the name.
+		 */
+		std::string_view operator[](size_t id) const;
+
+		/*! \brief Get every ids, sorted by the lexicographic order of their names.
+		 */
+		std::vector<size_t> getSortedIds() const;
+
+		/*! \brief Check if two interners contain the same names, regardless of their ids.
+		 *
+		 * \param other The other interner.
+		 */
+		bool hasSameNames(NameInterner const& other) const;
+
+	protected:
+		/*! \brief A slot of the hash table.
+		 */
+		struct Slot {
+			/*! \brief The hash of the name.
+			 */
+			std::uint64_t hash;
+
+			/*! \brief The id of the name, or npos if the slot is empty.
+			 */
+			size_t id;
+		};
+
+		/*! \brief The location of a name in the pool.
+		 */
+		struct Span {
+			/*! \brief The offset of the name in the pool.
+			 */
+			size_t offset;
+
+			/*! \brief The length of the name, or npos if the id is released.
+			 */
+			size_t length;
+		};
+
+		/*! \brief Hash a name.
+		 *
+		 * \param name The name to hash.
+		 */
+		static std::uint64_t hash(std::string_view name);
+
+		/*! \brief Find the slot of a name, or the empty slot where it should be inserted.
+		 *
+		 * \param name The name to look up.
+		 * \param nameHash The hash of the name.
+		 */
+		size_t findSlot(std::string_view name, std::uint64_t nameHash) const;
+
+		/*! \brief Grow the hash table if adding a name would make it too full.
+		 */
+		void reserveSlot();
+
+		/*! \brief Empty a slot of the hash table, moving back the following slots of its cluster.
+		 *
+		 * \param position The position of the slot.
+		 */
+		void removeSlot(size_t position);
+
+		/*! \brief Rebuild the hash table with a given number of slots.
+		 *
+		 * \param slotsCount The new number of slots, must be a power of two.
+		 */
+		void rehash(size_t slotsCount);
+
+		/*! \brief Rebuild the pool if the names of the removed ids take too much space.
+		 */
+		void shrinkPool();
+
+		/*! \brief Every name, one after the other.
+		 *
+		 * The pool also contains the names of the removed ids, until it is rebuilt.
+		 */
+		std::string pool;
+
+		/*! \brief The location of the name of each id in the pool.
+		 */
+		std::vector<Span> spans;
+
+		/*! \brief The number of names in the interner.
+		 */
+		size_t count = 0;
+
+		/*! \brief The number of characters of the pool which do not belong to a name anymore.
+		 */
+		size_t unusedCharacters = 0;
+
+		/*! \brief The hash table, its size is always zero or a power of two.
+		 */
+		std::vector<Slot> slots;
+	};
+}
@@ -0,0 +1,399 @@
+#pragma once
+
+#include "node_ref.hpp"
+
+#include <iterator>
+#include <utility>
+
+#include <cstddef>
+
+namespace graph {
+
+	/*! \brief A pair of iterators usable in a range-based for loop.
+	 */
+	template <typename Iterator>
+	class IteratorRange {
+	public:
+		/*! \brief The iterator type of the range.
+		 */
+		using iterator = Iterator;
+
+		/*! \brief Create a range from two iterators.
+		 *
+		 * \param first The first element.
+		 * \param last One past the last element.
+		 */
+		IteratorRange(Iterator first, Iterator last)
+		      : first(first)
+		      , last(last) {}
+
+		/*! \brief Get the first element of the range.
+		 */
+		Iterator begin() const {
+			return first;
+		}
+
+		/*! \brief Get one past the last element of the range.
+		 */
+		Iterator end() const {
+			return last;
+		}
+
+		/*! \brief Check if the range has no elements.
+		 */
+		bool empty() const {
+			return first == last;
+		}
+
+	protected:
+		/*! \brief The first element.
+		 */
+		Iterator first;
+
+		/*! \brief One past the last element.
+		 */
+		Iterator last;
+	};
+
+	/*! \brief An iterator on the vertices of a graph, in increasing order of ids.
+	 *
+	 * The ids which are not used by a node of the graph are skipped.
+	 */
+	template <typename Graph>
+	class VertexIterator {
+	public:
+		/*! \brief The category of the iterator.
+		 */
+		using iterator_category = std::forward_iterator_tag;
+
+		/*! \brief The type of the vertices.
+		 */
+		using value_type        = NodeRef<Graph>;
+
+		/*! \brief The type of the distance between two iterators.
+		 */
+		using difference_type   = std::ptrdiff_t;
+
+		/*! \brief The type returned by operator->().
+		 */
+		using pointer           = NodeRef<Graph> const*;
+
+		/*! \brief The type returned by operator*().
+		 */
+		using reference         = NodeRef<Graph>;
+
+		/*! \brief Create an iterator which does not reference any graph.
+		 */
+		VertexIterator() = default;
+
+		/*! \brief Create an iterator on the first vertex with an id not less than a given id.
+		 *
+		 * \param graph The graph of the vertices.
+		 * \param id The id from which to look for a vertex, `graph.getIdBound()` to create an
+		 *           iterator past the end.
+		 */
+		VertexIterator(Graph const& graph, size_t id)
+		      : graph(&graph)
+		      , id(id) {
+			skipRemoved();
+		}
+
+		/*! \brief Get the current vertex.
+		 */
+		NodeRef<Graph> operator*() const {
+			return NodeRef<Graph>(*graph, id);
+		}
+
+		/*! \brief Go to the next vertex.
+		 */
+		VertexIterator& operator++() {
+			++id;
+			skipRemoved();
+			return *this;
+		}
+
+		/*! \brief Go to the next vertex.
+		 */
+		VertexIterator operator++(int) {
+			VertexIterator result = *this;
+			++*this;
+			return result;
+		}
+
+		/*! \brief Check if two iterators are on the same vertex.
+		 *
+		 * \param other The other iterator.
+		 */
+		bool operator==(VertexIterator const& other) const {
+			return id == other.id;
+		}
+
+		/*! \brief Check if two iterators are on different vertices.
+		 *
+		 * \param other The other iterator.
+		 */
+		bool operator!=(VertexIterator const& other) const {
+			return !(*this == other);
+		}
+
+	protected:
+		/*! \brief Go to the first id used by a node, starting from the current one.
+		 */
+		void skipRemoved() {
+			size_t bound = graph->getIdBound();
+			while(id < bound && !graph->hasNodeId(id)) {
+				++id;
+			}
+		}
+
+		/*! \brief The graph of the vertices.
+		 */
+		Graph const* graph = nullptr;
+
+		/*! \brief The id of the current vertex.
+		 */
+		size_t id = 0;
+	};
+
+	/*! \brief An iterator on the adjacents of a vertex, built on an iterator on their ids.
+	 *
+	 * \tparam IdIterator An iterator giving the ids of the adjacents.
+	 */
+	template <typename Graph, typename IdIterator>
+	class AdjacentIterator {
+	public:
+		/*! \brief The category of the iterator.
+		 */
+		using iterator_category = std::forward_iterator_tag;
+
+		/*! \brief The type of the adjacents.
+		 */
+		using value_type        = NodeRef<Graph>;
+
+		/*! \brief The type of the distance between two iterators.
+		 */
+		using difference_type   = std::ptrdiff_t;
+
+		/*! \brief The type returned by operator->().
+		 */
+		using pointer           = NodeRef<Graph> const*;
+
+		/*! \brief The type returned by operator*().
+		 */
+		using reference         = NodeRef<Graph>;
+
+		/*! \brief Create an iterator which does not reference any graph.
+		 */
+		AdjacentIterator() = default;
+
+		/*! \brief Create an iterator on the adjacents given by an iterator on ids.
+		 *
+		 * \param graph The graph of the adjacents.
+		 * \param current The id of the first adjacent.
+		 * \param last One past the id of the last adjacent.
+		 * \param skipRemovedIds Whether the ids which are not used by a node of the graph must be
+		 *                       skipped.
+		 */
+		AdjacentIterator(Graph const& graph,
+		                 IdIterator current,
+		                 IdIterator last,
+		                 bool skipRemovedIds)
+		      : graph(&graph)
+		      , current(current)
+		      , last(last)
+		      , skipRemovedIds(skipRemovedIds) {
+			skipRemoved();
+		}
+
+		/*! \brief Get the current adjacent.
+		 */
+		NodeRef<Graph> operator*() const {
+			return NodeRef<Graph>(*graph, *current);
+		}
+
+		/*! \brief Go to the next adjacent.
+		 */
+		AdjacentIterator& operator++() {
+			++current;
+			skipRemoved();
+			return *this;
+		}
+
+		/*! \brief Go to the next adjacent.
+		 */
+		AdjacentIterator operator++(int) {
+			AdjacentIterator result = *this;
+			++*this;
+			return result;
+		}
+
+		/*! \brief Check if two iterators are on the same adjacent.
+		 *
+		 * \param other The other iterator.
+		 */
+		bool operator==(AdjacentIterator const& other) const {
+			return current == other.current;
+		}
+
+		/*! \brief Check if two iterators are on different adjacents.
+		 *
+		 * \param other The other iterator.
+		 */
+		bool operator!=(AdjacentIterator const& other) const {
+			return !(*this == other);
+		}
+
+	protected:
+		/*! \brief Skip the ids which are not used by a node, if needed.
+		 */
+		void skipRemoved() {
+			if(skipRemovedIds) {
+				while(current != last && !graph->hasNodeId(*current)) {
+					++current;
+				}
+			}
+		}
+
+		/*! \brief The graph of the adjacents.
+		 */
+		Graph const* graph = nullptr;
+
+		/*! \brief The id of the current adjacent.
+		 */
+		IdIterator current{};
+
+		/*! \brief One past the id of the last adjacent.
+		 */
+		IdIterator last{};
+
+		/*! \brief Whether the ids which are not used by a node of the graph must be skipped.
+		 */
+		bool skipRemovedIds = false;
+	};
+
+	/*! \brief An iterator on the edges of a graph, grouped by start vertex.
+	 *
+	 * The edges are given as pairs of NodeRef, and follow the order of Graph::vertices() and
+	 * Graph::adjacents().
+	 */
+	template <typename Graph>
+	class EdgeIterator {
+		/*! \brief The iterator on the adjacents of a vertex.
+		 */
+		using Adjacent = typename Graph::AdjacentRange_t::iterator;
+
+	public:
+		/*! \brief The category of the iterator.
+		 */
+		using iterator_category = std::forward_iterator_tag;
+
+		/*! \brief The type of the edges, the start and the end of the edge.
+		 */
+		using value_type        = std::pair<NodeRef<Graph>, NodeRef<Graph>>;
+
+		/*! \brief The type of the distance between two iterators.
+		 */
+		using difference_type   = std::ptrdiff_t;
+
+		/*! \brief The type returned by operator->().
+		 */
+		using pointer           = value_type const*;
+
+		/*! \brief The type returned by operator*().
+		 */
+		using reference         = value_type;
+
+		/*! \brief Create an iterator which does not reference any graph.
+		 */
+		EdgeIterator() = default;
+
+		/*! \brief Create an iterator on the first edge starting from a vertex of a range.
+		 *
+		 * \param vertex The first vertex from which to look for an edge.
+		 * \param lastVertex One past the last vertex of the graph.
+		 */
+		EdgeIterator(VertexIterator<Graph> vertex, VertexIterator<Graph> lastVertex)
+		      : vertex(vertex)
+		      , lastVertex(lastVertex) {
+			if(vertex != lastVertex) {
+				loadAdjacents();
+				skipEmptyVertices();
+			}
+		}
+
+		/*! \brief Get the current edge.
+		 */
+		value_type operator*() const {
+			return value_type(*vertex, *adjacent);
+		}
+
+		/*! \brief Go to the next edge.
+		 */
+		EdgeIterator& operator++() {
+			++adjacent;
+			skipEmptyVertices();
+			return *this;
+		}
+
+		/*! \brief Go to the next edge.
+		 */
+		EdgeIterator operator++(int) {
+			EdgeIterator result = *this;
+			++*this;
+			return result;
+		}
+
+		/*! \brief Check if two iterators are on the same edge.
+		 *
+		 * \param other The other iterator.
+		 */
+		bool operator==(EdgeIterator const& other) const {
+			return vertex == other.vertex && (vertex == lastVertex || adjacent == other.adjacent);
+		}
+
+		/*! \brief Check if two iterators are on different edges.
+		 *
+		 * \param other The other iterator.
+		 */
+		bool operator!=(EdgeIterator const& other) const {
+			return !(*this == other);
+		}
+
+	protected:
+		/*! \brief Start iterating on the adjacents of the current vertex.
+		 */
+		void loadAdjacents() {
+			NodeRef<Graph> begin = *vertex;
+			auto adjacents       = begin.getGraph().adjacents(begin.getId());
+			adjacent             = adjacents.begin();
+			lastAdjacent         = adjacents.end();
+		}
+
+		/*! \brief Go to the next vertex with an adjacent left, if the current one has none.
+		 */
+		void skipEmptyVertices() {
+			while(adjacent == lastAdjacent) {
+				if(++vertex == lastVertex) {
+					return;
+				}
+				loadAdjacents();
+			}
+		}
+
+		/*! \brief The start of the current edge.
+		 */
+		VertexIterator<Graph> vertex;
+
+		/*! \brief One past the last vertex of the graph.
+		 */
+		VertexIterator<Graph> lastVertex;
+
+		/*! \brief The end of the current edge.
+		 */
+		Adjacent adjacent;
+
+		/*! \brief One past the last adjacent of the current vertex.
+		 */
+		Adjacent lastAdjacent;
+	};
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include <cstddef>
+
+namespace graph {
+
+	/*! \brief A lightweight handle on a node of a graph.
+	 *
+	 * A NodeRef only stores a pointer to its graph and the id of the node, so it can be copied
+	 * and compared for the price of two words. Everything else (name, property, adjacents) is
+	 * looked up in the graph when asked for. It can be converted to the ConstNode type of the
+	 * graph when the full node is needed.
+	 *
+	 * Like an iterator, a NodeRef is invalidated when the id of its node changes, and using it
+	 * after the destruction of the graph will result in a dandling pointer.
+	 */
+	template <typename Graph>
+	class NodeRef {
+	public:
+		/*! \brief Create a handle which does not reference any node.
+		 */
+		NodeRef() = default;
+
+		/*! \brief Create a handle on a node.
+		 *
+		 * \param graph The graph of the node.
+		 * \param id The id of the node.
+		 */
+		NodeRef(Graph const& graph, size_t id)
+		      : graph(&graph)
+		      , id(id) {}
+
+		/*! \brief Get the id of the node.
+		 */
+		size_t getId() const {
+			return id;
+		}
+
+		/*! \brief Get the graph of the node.
+		 */
+		Graph const& getGraph() const {
+			return *graph;
+		}
+
+		/*! \brief Get the name of the node.
+		 */
+		std::string getName() const {
+			return std::string(graph->getName(id));
+		}
+
+		/*! \brief Get the property of the node.
+		 */
+		decltype(auto) getProperty() const {
+			return graph->getNodeProperty(id);
+		}
+
+		/*! \brief Return true if two handles reference the same node of the same graph.
+		 *
+		 * \param other The other handle.
+		 */
+		bool operator==(NodeRef const& other) const {
+			return id == other.id && graph == other.graph;
+		}
+
+		/*! \brief Return true if two handles reference different nodes.
+		 *
+		 * \param other The other handle.
+		 */
+		bool operator!=(NodeRef const& other) const {
+			return !(*this == other);
+		}
+
+		/*! \brief Compare two handles of the same graph by the id of their nodes.
+		 *
+		 * \param other The other handle.
+		 */
+		bool operator<(NodeRef const& other) const {
+			return id < other.id;
+		}
+
+	protected:
+		/*! \brief The graph of the node.
+		 */
+		Graph const* graph = nullptr;
+
+		/*! \brief The id of the node.
+		 */
+		size_t id = 0;
+	};
+}
+
+namespace std {
+
+	/*! \brief Hash a NodeRef by the id of its node.
+	 */
+	template <typename Graph>
+	struct hash<graph::NodeRef<Graph>> {
+		/*! \brief Hash a NodeRef.
+		 *
+		 * \param node The handle to hash.
+		 */
+		size_t operator()(graph::NodeRef<Graph> const& node) const {
+			return std::hash<size_t>()(node.getId());
+		}
+	};
+}
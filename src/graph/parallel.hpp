@@ -0,0 +1,99 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <cstddef>
+
+namespace graph {
+
+	/*! \brief Get the number of threads to use for a requested number of threads.
+	 *
+	 * \param threads The requested number of threads, or 0 to use one thread per hardware
+	 *                thread.
+	 */
+	inline size_t threadsCount(size_t threads) {
+		if(threads == 0) {
+			threads = std::thread::hardware_concurrency();
+		}
+		return std::max<size_t>(threads, 1);
+	}
+
+	/*! \brief Call a function on consecutive blocks of a range of indices, from several
+	 *         threads.
+	 *
+	 * The blocks are handed out one at a time to the first thread which asks for one, so that
+	 * threads which get cheap blocks take more of them. With a single thread, everything runs
+	 * on the calling thread. The function returns when every block has been processed.
+	 *
+	 * \param first The first index.
+	 * \param last One past the last index.
+	 * \param threads The number of threads, see threadsCount().
+	 * \param blockSize The number of indices of a block.
+	 * \param f The function to call, of type void(size_t blockFirst, size_t blockLast, size_t
+	 *          thread), where thread is the number of the calling thread, lower than the
+	 *          number of threads.
+	 */
+	template <typename F>
+	void parallelFor(size_t first, size_t last, size_t threads, size_t blockSize, F&& f) {
+		threads = threadsCount(threads);
+		if(threads == 1 || last - first <= blockSize) {
+			if(first < last) {
+				f(first, last, size_t(0));
+			}
+			return;
+		}
+
+		std::atomic<size_t> nextBlock(first);
+		auto work = [&nextBlock, &f, last, blockSize](size_t thread) {
+			while(true) {
+				size_t blockFirst = nextBlock.fetch_add(blockSize, std::memory_order_relaxed);
+				if(blockFirst >= last) {
+					return;
+				}
+				f(blockFirst, std::min(blockFirst + blockSize, last), thread);
+			}
+		};
+
+		std::vector<std::thread> workers;
+		workers.reserve(threads - 1);
+		for(size_t thread = 1; thread < threads; ++thread) {
+			workers.emplace_back(work, thread);
+		}
+		work(0);
+		for(auto& worker : workers) {
+			worker.join();
+		}
+	}
+
+	/*! \brief Split a range of indices into consecutive parts of about the same cost.
+	 *
+	 * \param first The first index.
+	 * \param last One past the last index.
+	 * \param parts The number of parts, at least 1.
+	 * \param cost A function giving the cost of an index, of type size_t(size_t).
+	 * \return The bounds of the parts: part `i` goes from `bounds[i]` to `bounds[i + 1]`.
+	 *         Some parts may be empty.
+	 */
+	template <typename Cost>
+	std::vector<size_t> balancedBounds(size_t first, size_t last, size_t parts, Cost&& cost) {
+		size_t total = 0;
+		for(size_t index = first; index < last; ++index) {
+			total += cost(index);
+		}
+
+		std::vector<size_t> bounds{first};
+		size_t accumulated = 0;
+		for(size_t index = first; index < last && bounds.size() < parts; ++index) {
+			accumulated += cost(index);
+			// The part ends once it has its share of the total cost.
+			if(accumulated * parts >= total * bounds.size()) {
+				bounds.push_back(index + 1);
+			}
+		}
+		bounds.resize(parts + 1, last);
+		return bounds;
+	}
+}
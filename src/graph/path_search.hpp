@@ -0,0 +1,347 @@
+#pragma once
+
+#include "indexed_heap.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace graph {
+
+	/*! \brief A path found by a shortest path search.
+	 *
+	 * \tparam Distance The type of the length of the path.
+	 */
+	template <typename Distance>
+	struct ShortestPath {
+		/*! \brief The ids of the vertices of the path, from the start to the goal, or nothing
+		 *         if the goal cannot be reached.
+		 */
+		std::vector<size_t> ids;
+
+		/*! \brief The sum of the weights of the edges of the path.
+		 */
+		Distance length{};
+
+		/*! \brief Check if a path was found.
+		 */
+		bool found() const {
+			return !ids.empty();
+		}
+	};
+
+	/*! \brief Build the path to a vertex from the parent of each vertex.
+	 *
+	 * \param parents The previous vertex on the path to each vertex, the vertex itself for the
+	 *                start.
+	 * \param length The length of the path.
+	 * \param id The id of the end of the path, which must have a parent.
+	 */
+	template <typename Distance>
+	ShortestPath<Distance> followParents(std::vector<size_t> const& parents,
+	                                     Distance length,
+	                                     size_t id) {
+		ShortestPath<Distance> path;
+		path.length = length;
+		path.ids.push_back(id);
+		while(parents[id] != id) {
+			id = parents[id];
+			path.ids.push_back(id);
+		}
+		std::reverse(path.ids.begin(), path.ids.end());
+		return path;
+	}
+
+	/*! \brief The shortest paths from a source to every vertex of a graph, as given by dijkstra()
+	 *         and deltaStepping().
+	 *
+	 * \tparam Distance The type of the distances.
+	 */
+	template <typename Distance>
+	struct ShortestPathTree {
+		/*! \brief The parent of the vertices which are not reached.
+		 */
+		static constexpr size_t const npos = static_cast<size_t>(-1);
+
+		/*! \brief The distance of the vertices which are not reached.
+		 */
+		static constexpr Distance const unreached = std::numeric_limits<Distance>::max();
+
+		/*! \brief The distance from the source of each id, or unreached.
+		 */
+		std::vector<Distance> distances;
+
+		/*! \brief The previous vertex on the shortest path to each id, the source itself for the
+		 *         source, or npos.
+		 */
+		std::vector<size_t> parents;
+
+		/*! \brief Check if a vertex can be reached from the source.
+		 *
+		 * \param id The id of the vertex.
+		 */
+		bool isReached(size_t id) const {
+			return parents[id] != npos;
+		}
+
+		/*! \brief Get the shortest path from the source to a vertex.
+		 *
+		 * \param id The id of the vertex.
+		 * \return The path, or an empty path if the vertex is not reached.
+		 */
+		ShortestPath<Distance> pathTo(size_t id) const {
+			if(!isReached(id)) {
+				return ShortestPath<Distance>();
+			}
+			return followParents(parents, distances[id], id);
+		}
+	};
+
+	/*! \brief The state of a shortest path search, indexed by the ids of the vertices.
+	 *
+	 * It holds the distance from the start and the parent of each reached vertex, and the heap
+	 * of the vertices to explore. Keeping it between searches avoids allocating arrays as large
+	 * as the graph for each of them: reset() only clears the vertices reached by the previous
+	 * search.
+	 *
+	 * \tparam Distance The type of the distances.
+	 */
+	template <typename Distance>
+	class SearchScratch {
+	public:
+		/*! \brief The parent of the vertices which are not reached.
+		 */
+		static constexpr size_t const npos = static_cast<size_t>(-1);
+
+		/*! \brief The heap of the vertices to explore.
+		 */
+		using Heap_t = IndexedHeap<Distance>;
+
+		/*! \brief Forget the previous search and make room for the ids of a graph.
+		 *
+		 * \param idBound One past the greatest id of the graph.
+		 */
+		void reset(size_t idBound) {
+			for(size_t id : reached) {
+				parents[id] = npos;
+			}
+			reached.clear();
+
+			if(idBound > parents.size()) {
+				parents.resize(idBound, npos);
+				distances.resize(idBound);
+			}
+			heap.reset(parents.size());
+		}
+
+		/*! \brief Check if a vertex was reached by the search.
+		 *
+		 * \param id The id of the vertex.
+		 */
+		bool isReached(size_t id) const {
+			return parents[id] != npos;
+		}
+
+		/*! \brief Get the distance of a reached vertex from the start.
+		 *
+		 * \param id The id of the vertex.
+		 */
+		Distance const& getDistance(size_t id) const {
+			return distances[id];
+		}
+
+		/*! \brief Get the previous vertex on the path to a reached vertex, the vertex itself for
+		 *         the start.
+		 *
+		 * \param id The id of the vertex.
+		 */
+		size_t getParent(size_t id) const {
+			return parents[id];
+		}
+
+		/*! \brief Set the distance and the parent of a vertex.
+		 *
+		 * \param id The id of the vertex.
+		 * \param distance The distance from the start.
+		 * \param parent The previous vertex on the path, the vertex itself for the start.
+		 */
+		void reach(size_t id, Distance distance, size_t parent) {
+			if(parents[id] == npos) {
+				reached.push_back(id);
+			}
+			distances[id] = distance;
+			parents[id]   = parent;
+		}
+
+		/*! \brief Get the heap of the vertices to explore.
+		 */
+		Heap_t& getHeap() {
+			return heap;
+		}
+
+		/*! \brief Get the path from the start to a vertex, following the parents.
+		 *
+		 * \param id The id of the vertex.
+		 * \return The path, or an empty path if the vertex is not reached.
+		 */
+		ShortestPath<Distance> pathTo(size_t id) const {
+			if(!isReached(id)) {
+				return ShortestPath<Distance>();
+			}
+			return followParents(parents, distances[id], id);
+		}
+
+	protected:
+		/*! \brief The distance of each vertex from the start, meaningful for the reached ones.
+		 */
+		std::vector<Distance> distances;
+
+		/*! \brief The parent of each vertex, or npos.
+		 */
+		std::vector<size_t> parents;
+
+		/*! \brief The ids of the reached vertices.
+		 */
+		std::vector<size_t> reached;
+
+		/*! \brief The heap of the vertices to explore.
+		 */
+		Heap_t heap;
+	};
+
+	/*! \brief Join the paths found by a search from the start and a search from the goal.
+	 *
+	 * \param forward The scratch space of the search from the start.
+	 * \param backward The scratch space of the search from the goal, where the parent of a
+	 *                 vertex is the next vertex on the path to the goal.
+	 * \param meetingId The id of a vertex reached by both searches.
+	 * \param length The length of the path through this vertex.
+	 * \return The path from the start to the goal.
+	 */
+	template <typename Distance>
+	ShortestPath<Distance> joinPaths(SearchScratch<Distance> const& forward,
+	                                 SearchScratch<Distance> const& backward,
+	                                 size_t meetingId,
+	                                 Distance length) {
+		ShortestPath<Distance> path = forward.pathTo(meetingId);
+		path.length                 = length;
+		for(size_t id = meetingId; backward.getParent(id) != id;) {
+			id = backward.getParent(id);
+			path.ids.push_back(id);
+		}
+		return path;
+	}
+
+	/*! \brief The shortest paths between every pair of vertices of a graph, as given by
+	 *         floydWarshall().
+	 *
+	 * The distances and the next hops are stored in two square matrices, row by row. The rows
+	 * are padded to a multiple of blockSize and aligned on 32 bytes, so that the matrices can
+	 * be processed in square tiles with SIMD instructions.
+	 *
+	 * \tparam Distance The type of the distances.
+	 */
+	template <typename Distance>
+	struct AllPairsShortestPaths {
+		/*! \brief The side of the tiles of the matrices.
+		 */
+		static constexpr size_t const blockSize = 64;
+
+		/*! \brief The next hop of the pairs of vertices which are not connected.
+		 */
+		static constexpr std::uint32_t const npos = static_cast<std::uint32_t>(-1);
+
+		/*! \brief The distance of the pairs of vertices which are not connected. It is half
+		 *         the greatest distance so that adding two of them does not overflow.
+		 */
+		static constexpr Distance const unreached = std::numeric_limits<Distance>::max() / 2;
+
+		/*! \brief Create the matrices where no pair of ids is connected, not even an id with
+		 *         itself: the ids of the vertices of the graph are set with reachItself().
+		 *
+		 * \param idBound One past the greatest id of the graph.
+		 */
+		explicit AllPairsShortestPaths(size_t idBound = 0)
+		      : idBound(idBound)
+		      , stride((idBound + blockSize - 1) / blockSize * blockSize)
+		      , distances(stride * stride, unreached)
+		      , nextHops(stride * stride, npos) {}
+
+		/*! \brief Set the path from a vertex to itself, of length 0.
+		 *
+		 * \param id The id of the vertex.
+		 */
+		void reachItself(size_t id) {
+			distances[id * stride + id] = Distance();
+			nextHops[id * stride + id]  = static_cast<std::uint32_t>(id);
+		}
+
+		/*! \brief Check if there is a path between two vertices.
+		 *
+		 * \param beginId The id of the start of the path.
+		 * \param endId The id of the end of the path.
+		 */
+		bool isReached(size_t beginId, size_t endId) const {
+			return nextHops[beginId * stride + endId] != npos;
+		}
+
+		/*! \brief Get the length of a shortest path between two vertices, or unreached.
+		 *
+		 * \param beginId The id of the start of the path.
+		 * \param endId The id of the end of the path.
+		 */
+		Distance getDistance(size_t beginId, size_t endId) const {
+			return distances[beginId * stride + endId];
+		}
+
+		/*! \brief Get the vertex following the start on a shortest path between two vertices,
+		 *         the end itself if they are the same, or npos.
+		 *
+		 * \param beginId The id of the start of the path.
+		 * \param endId The id of the end of the path.
+		 */
+		size_t getNextHop(size_t beginId, size_t endId) const {
+			return nextHops[beginId * stride + endId];
+		}
+
+		/*! \brief Get a shortest path between two vertices, following the next hops.
+		 *
+		 * \param beginId The id of the start of the path.
+		 * \param endId The id of the end of the path.
+		 * \return The path, or an empty path if there is no path.
+		 */
+		ShortestPath<Distance> pathBetween(size_t beginId, size_t endId) const {
+			ShortestPath<Distance> path;
+			if(!isReached(beginId, endId)) {
+				return path;
+			}
+			path.length = getDistance(beginId, endId);
+			path.ids.push_back(beginId);
+			for(size_t id = beginId; id != endId;) {
+				id = getNextHop(id, endId);
+				path.ids.push_back(id);
+			}
+			return path;
+		}
+
+		/*! \brief One past the greatest id of the graph.
+		 */
+		size_t idBound;
+
+		/*! \brief The number of elements of a row of the matrices, padding included.
+		 */
+		size_t stride;
+
+		/*! \brief The distance between each pair of ids, at `beginId * stride + endId`.
+		 */
+		std::vector<Distance, AlignedAllocator<Distance, 32>> distances;
+
+		/*! \brief The next hop between each pair of ids, at `beginId * stride + endId`.
+		 */
+		std::vector<std::uint32_t, AlignedAllocator<std::uint32_t, 32>> nextHops;
+	};
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace graph {
+
+	/*! \brief The edges ending at each vertex of a graph, for the algorithms which follow the
+	 *         edges backward.
+	 *
+	 * When the reverse index of the graph is enabled, see Graph::setReverseIndex(), the graph
+	 * is read directly. Otherwise the start of each edge is gathered in compressed sparse rows,
+	 * grouped by the end of the edge, with the property of the edge only when it is asked for:
+	 * the graph itself, its names and its node properties are not copied.
+	 *
+	 * The functions have the same signatures as the ones of the graph, so that the index can
+	 * be used in place of a graph with its reverse index.
+	 *
+	 * \tparam Graph The type of the graph.
+	 */
+	template <typename Graph>
+	class PredecessorIndex {
+	public:
+		/*! \brief A reference to a vertex of the graph.
+		 */
+		using NodeRef_t = typename Graph::NodeRef_t;
+
+		/*! \brief The property of the edges of the graph.
+		 */
+		using EdgeProperty_t = std::decay_t<decltype(
+		        std::declval<Graph const&>().getEdgeProperty(size_t(), size_t()))>;
+
+		/*! \brief Index the edges of a graph.
+		 *
+		 * \warning The index is invalidated when the graph is modified.
+		 *
+		 * \param g The graph.
+		 * \param withProperties Whether the properties of the edges are needed, by
+		 *                       eachPredecessorEdges().
+		 */
+		explicit PredecessorIndex(Graph const& g, bool withProperties = false) : g(g) {
+			if(g.hasReverseIndex()) {
+				return;
+			}
+
+			size_t idBound = g.getIdBound();
+			offsets.assign(idBound + 1, 0);
+			g.eachVertices([this, &g](NodeRef_t begin) {
+				g.eachAdjacents(begin, [this](NodeRef_t end) { ++offsets[end.getId() + 1]; });
+			});
+			for(size_t id = 0; id < idBound; ++id) {
+				offsets[id + 1] += offsets[id];
+			}
+
+			// The edges are taken with their properties so that parallel edges keep their own.
+			starts.resize(offsets[idBound]);
+			if(withProperties) {
+				properties.resize(offsets[idBound]);
+			}
+			std::vector<size_t> cursors(offsets.begin(), offsets.end() - 1);
+			g.eachVertices([this, &g, &cursors, withProperties](NodeRef_t begin) {
+				std::uint32_t beginId = static_cast<std::uint32_t>(begin.getId());
+				g.eachAdjacentEdges(begin, [&](NodeRef_t end, EdgeProperty_t const& property) {
+					size_t position  = cursors[end.getId()]++;
+					starts[position] = beginId;
+					if(withProperties) {
+						properties[position] = property;
+					}
+				});
+			});
+		}
+
+		/*! \brief Call a given function for each vertex which is the start of an edge to the
+		 *         given vertex.
+		 *
+		 * \param vertex The vertex at the end of the edges.
+		 * \param functor The function to call, of type void(NodeRef_t).
+		 */
+		template <typename Functor>
+		void eachPredecessors(NodeRef_t vertex, Functor&& functor) const {
+			if(g.hasReverseIndex()) {
+				g.eachPredecessors(vertex, std::forward<Functor>(functor));
+				return;
+			}
+
+			size_t id = vertex.getId();
+			for(size_t position = offsets[id]; position < offsets[id + 1]; ++position) {
+				functor(NodeRef_t(g, starts[position]));
+			}
+		}
+
+		/*! \brief Call a given function for each edge ending at the given vertex, with the start
+		 *         of the edge and its property.
+		 *
+		 * Without the reverse index of the graph, the index must have been built with the
+		 * properties of the edges.
+		 *
+		 * \param vertex The vertex at the end of the edges.
+		 * \param functor The function to call, of type void(NodeRef_t, EdgeProperty const&).
+		 */
+		template <typename Functor>
+		void eachPredecessorEdges(NodeRef_t vertex, Functor&& functor) const {
+			if(g.hasReverseIndex()) {
+				g.eachPredecessorEdges(vertex, std::forward<Functor>(functor));
+				return;
+			}
+
+			size_t id = vertex.getId();
+			for(size_t position = offsets[id]; position < offsets[id + 1]; ++position) {
+				functor(NodeRef_t(g, starts[position]), properties[position]);
+			}
+		}
+
+	protected:
+		/*! \brief The indexed graph.
+		 */
+		Graph const& g;
+
+		/*! \brief The position of the first edge to each id in starts, and the number of edges,
+		 *         when the graph has no reverse index.
+		 */
+		std::vector<size_t> offsets;
+
+		/*! \brief The start of each edge, grouped by end.
+		 */
+		std::vector<std::uint32_t> starts;
+
+		/*! \brief The property of each edge of starts, when asked for.
+		 */
+		std::vector<EdgeProperty_t> properties;
+	};
+}
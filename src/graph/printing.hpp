@@ -14,9 +14,9 @@ namespace graph {
 	 */
 	template <template <class, class> class Graph, typename NodeProperty>
 	std::ostream& operator<<(std::ostream& os, Graph<NodeProperty, NoProperty> const& graph) {
-		using ConstNode = typename Graph<NodeProperty, NoProperty>::ConstNode_t;
+		using NodeRef = typename Graph<NodeProperty, NoProperty>::NodeRef_t;
 
-		graph.eachEdges([&os](ConstNode start, ConstNode end) {
+		graph.eachEdges([&os](NodeRef start, NodeRef end) {
 			os << std::quoted(start.getName()) << " -> " << std::quoted(end.getName()) << std::endl;
 		});
 
@@ -30,11 +30,12 @@ namespace graph {
 	 */
 	template <template <class, class> class Graph, typename NodeProperty>
 	std::ostream& operator<<(std::ostream& os, Graph<NodeProperty, WeightedProperty> const& graph) {
-		using ConstNode = typename Graph<NodeProperty, NoProperty>::ConstNode_t;
+		using NodeRef = typename Graph<NodeProperty, WeightedProperty>::NodeRef_t;
 
-		graph.eachEdges([&os, &graph](ConstNode start, ConstNode end) {
+		graph.eachEdges([&os, &graph](NodeRef start, NodeRef end) {
 			os << std::quoted(start.getName()) << " -> " << std::quoted(end.getName())
-			   << " [label=\"" << graph.getEdgeProperty(start, end).weight << "\"]" << std::endl;
+			   << " [label=\"" << graph.getEdgeProperty(start.getId(), end.getId()).weight
+			   << "\"]" << std::endl;
 		});
 
 		return os;
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+namespace graph {
+
+	/*! \brief A monotone min-heap of values with an unsigned integer key each.
+	 *
+	 * The keys pushed must never be lower than the last key popped, which is always the case
+	 * in the Dijkstra algorithm. The values are stored in buckets, by the position of the
+	 * highest bit in which their key differs from the last key popped, so that each value is
+	 * moved at most once per bit of the keys: pushing is done in constant time and popping in
+	 * an amortized time logarithmic in the range of the keys, with no comparison between
+	 * values.
+	 *
+	 * There is no decrease-key: a value whose key decreases is pushed again, and the stale
+	 * copy must be skipped when popped.
+	 *
+	 * \tparam Key The type of the keys, an unsigned integer.
+	 * \tparam Value The type of the values.
+	 */
+	template <typename Key, typename Value>
+	class RadixHeap {
+		static_assert(std::is_unsigned<Key>::value && sizeof(Key) <= sizeof(unsigned long long),
+		              "The keys must be unsigned integers");
+
+	public:
+		/*! \brief Create an empty heap.
+		 */
+		RadixHeap()
+		      : buckets(keyBits + 1) {}
+
+		/*! \brief Get the number of values in the heap.
+		 */
+		size_t size() const {
+			return count;
+		}
+
+		/*! \brief Check if the heap has no values.
+		 */
+		bool empty() const {
+			return count == 0;
+		}
+
+		/*! \brief Remove every value and allow any key to be pushed again.
+		 */
+		void clear() {
+			for(auto& bucket : buckets) {
+				bucket.clear();
+			}
+			count   = 0;
+			lastKey = 0;
+		}
+
+		/*! \brief Add a value to the heap.
+		 *
+		 * \param key The key of the value, which must not be lower than the last key popped.
+		 * \param value The value.
+		 */
+		void push(Key key, Value value) {
+			buckets[bucketOf(key)].emplace_back(key, std::move(value));
+			++count;
+		}
+
+		/*! \brief Remove a value with the lowest key.
+		 *
+		 * \return The key and the value removed.
+		 */
+		std::pair<Key, Value> pop() {
+			if(buckets[0].empty()) {
+				size_t first = 1;
+				while(buckets[first].empty()) {
+					++first;
+				}
+
+				// The lowest key of the first bucket becomes the last key, and each value of
+				// the bucket goes to a lower bucket.
+				auto& bucket = buckets[first];
+				lastKey      = bucket.front().first;
+				for(auto const& entry : bucket) {
+					if(entry.first < lastKey) {
+						lastKey = entry.first;
+					}
+				}
+				for(auto& entry : bucket) {
+					buckets[bucketOf(entry.first)].push_back(std::move(entry));
+				}
+				bucket.clear();
+			}
+
+			std::pair<Key, Value> result = std::move(buckets[0].back());
+			buckets[0].pop_back();
+			--count;
+			return result;
+		}
+
+	protected:
+		/*! \brief The number of bits of the keys.
+		 */
+		static constexpr size_t const keyBits = std::numeric_limits<Key>::digits;
+
+		/*! \brief Get the bucket of a key: 0 if it is the last key popped, or one plus the
+		 *         position of the highest bit in which it differs from it.
+		 *
+		 * \param key The key.
+		 */
+		size_t bucketOf(Key key) const {
+			auto difference = static_cast<unsigned long long>(key ^ lastKey);
+			if(difference == 0) {
+				return 0;
+			}
+			return static_cast<size_t>(std::numeric_limits<unsigned long long>::digits -
+			                           __builtin_clzll(difference));
+		}
+
+		/*! \brief The values, by bucket.
+		 */
+		std::vector<std::vector<std::pair<Key, Value>>> buckets;
+
+		/*! \brief The number of values in the heap.
+		 */
+		size_t count = 0;
+
+		/*! \brief The last key popped.
+		 */
+		Key lastKey = 0;
+	};
+}
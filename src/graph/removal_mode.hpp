@@ -0,0 +1,21 @@
+#pragma once
+
+namespace graph {
+
+	/*! \brief How a graph removes its nodes.
+	 */
+	enum class RemovalMode {
+		/*! \brief The ids of the nodes after the removed one are decremented right away.
+		 *
+		 * The ids stay dense, but every removal takes a time linear in the size of the graph.
+		 */
+		Renumber,
+
+		/*! \brief The id of the removed node is left unused, and reused by a later node.
+		 *
+		 * The ids of the other nodes do not change until the graph is compacted, which makes the
+		 * removal of many nodes much faster.
+		 */
+		Tombstone
+	};
+}
@@ -0,0 +1,414 @@
+#pragma once
+
+#include <algorithm>
+#include <new>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace graph {
+
+	/*! \brief A non-owning view on a contiguous array of constant elements.
+	 *
+	 * Like an iterator, the view is invalidated when the viewed array is modified.
+	 */
+	template <typename T>
+	class ArrayView {
+	public:
+		/*! \brief The type of the elements.
+		 */
+		using value_type     = T;
+
+		/*! \brief The iterator type of the view.
+		 */
+		using const_iterator = T const*;
+
+		/*! \brief Create an empty view.
+		 */
+		ArrayView() = default;
+
+		/*! \brief Create a view on a range of elements.
+		 *
+		 * \param first The first element.
+		 * \param last One past the last element.
+		 */
+		ArrayView(T const* first, T const* last)
+		      : first(first)
+		      , last(last) {}
+
+		/*! \brief Get the first element of the view.
+		 */
+		const_iterator begin() const {
+			return first;
+		}
+
+		/*! \brief Get one past the last element of the view.
+		 */
+		const_iterator end() const {
+			return last;
+		}
+
+		/*! \brief Get the number of elements.
+		 */
+		size_t size() const {
+			return static_cast<size_t>(last - first);
+		}
+
+		/*! \brief Check if the view has no elements.
+		 */
+		bool empty() const {
+			return first == last;
+		}
+
+		/*! \brief Get the first element.
+		 */
+		T const& front() const {
+			return *first;
+		}
+
+		/*! \brief Get the last element.
+		 */
+		T const& back() const {
+			return *(last - 1);
+		}
+
+		/*! \brief Get the element at a given position.
+		 *
+		 * \param position The position of the element.
+		 */
+		T const& operator[](size_t position) const {
+			return first[position];
+		}
+
+		/*! \brief Check if two views have the same elements, in the same order.
+		 *
+		 * \param other The other view.
+		 */
+		bool operator==(ArrayView const& other) const {
+			return std::equal(first, last, other.first, other.last);
+		}
+
+		/*! \brief Check if two views differ.
+		 *
+		 * \param other The other view.
+		 */
+		bool operator!=(ArrayView const& other) const {
+			return !(*this == other);
+		}
+
+	protected:
+		/*! \brief The first element.
+		 */
+		T const* first = nullptr;
+
+		/*! \brief One past the last element.
+		 */
+		T const* last = nullptr;
+	};
+
+	/*! \brief A contiguous array storing its first elements inline.
+	 *
+	 * Up to `InlineCapacity` elements are stored inside the object itself, so that small arrays
+	 * do not need any heap allocation. Past that, the elements are moved to the heap and the
+	 * capacity grows geometrically.
+	 *
+	 * Only trivially copyable types are supported, so that elements can be moved with a plain
+	 * copy.
+	 */
+	template <typename T, size_t InlineCapacity>
+	class SmallVector {
+		static_assert(std::is_trivially_copyable<T>::value,
+		              "The elements of a SmallVector must be trivially copyable");
+		static_assert(InlineCapacity > 0, "The inline capacity must not be zero");
+
+	public:
+		/*! \brief The type of the elements.
+		 */
+		using value_type     = T;
+
+		/*! \brief The iterator type.
+		 */
+		using iterator       = T*;
+
+		/*! \brief The constant iterator type.
+		 */
+		using const_iterator = T const*;
+
+		/*! \brief Create an empty array.
+		 */
+		SmallVector() = default;
+
+		/*! \brief Copy an array.
+		 *
+		 * \param other The array to copy.
+		 */
+		SmallVector(SmallVector const& other) {
+			reserve(other.size());
+			std::copy(other.begin(), other.end(), elements);
+			count = other.count;
+		}
+
+		/*! \brief Move an array, leaving the other one empty.
+		 *
+		 * \param other The array to move.
+		 */
+		SmallVector(SmallVector&& other) noexcept {
+			steal(other);
+		}
+
+		/*! \brief Copy an array.
+		 *
+		 * \param other The array to copy.
+		 */
+		SmallVector& operator=(SmallVector const& other) {
+			if(this != &other) {
+				clear();
+				reserve(other.size());
+				std::copy(other.begin(), other.end(), elements);
+				count = other.count;
+			}
+			return *this;
+		}
+
+		/*! \brief Move an array, leaving the other one empty.
+		 *
+		 * \param other The array to move.
+		 */
+		SmallVector& operator=(SmallVector&& other) noexcept {
+			if(this != &other) {
+				release();
+				steal(other);
+			}
+			return *this;
+		}
+
+		~SmallVector() {
+			release();
+		}
+
+		/*! \brief Get the number of elements.
+		 */
+		size_t size() const {
+			return count;
+		}
+
+		/*! \brief Get the number of elements which can be stored without reallocating.
+		 */
+		size_t capacity() const {
+			return storageCapacity;
+		}
+
+		/*! \brief Check if the array has no elements.
+		 */
+		bool empty() const {
+			return count == 0;
+		}
+
+		/*! \brief Check if the elements are stored inside the object.
+		 */
+		bool isInline() const {
+			return elements == inlineElements;
+		}
+
+		/*! \brief Get the first element.
+		 */
+		iterator begin() {
+			return elements;
+		}
+
+		/*! \brief Get the first element.
+		 */
+		const_iterator begin() const {
+			return elements;
+		}
+
+		/*! \brief Get one past the last element.
+		 */
+		iterator end() {
+			return elements + count;
+		}
+
+		/*! \brief Get one past the last element.
+		 */
+		const_iterator end() const {
+			return elements + count;
+		}
+
+		/*! \brief Get the first element.
+		 */
+		T& front() {
+			return elements[0];
+		}
+
+		/*! \brief Get the first element.
+		 */
+		T const& front() const {
+			return elements[0];
+		}
+
+		/*! \brief Get the last element.
+		 */
+		T& back() {
+			return elements[count - 1];
+		}
+
+		/*! \brief Get the last element.
+		 */
+		T const& back() const {
+			return elements[count - 1];
+		}
+
+		/*! \brief Get the element at a given position.
+		 *
+		 * \param position The position of the element.
+		 */
+		T& operator[](size_t position) {
+			return elements[position];
+		}
+
+		/*! \brief Get the element at a given position.
+		 *
+		 * \param position The position of the element.
+		 */
+		T const& operator[](size_t position) const {
+			return elements[position];
+		}
+
+		/*! \brief Get a view on the elements.
+		 */
+		ArrayView<T> view() const {
+			return ArrayView<T>(begin(), end());
+		}
+
+		/*! \brief Add an element at the end of the array.
+		 *
+		 * \param value The element to add.
+		 */
+		void push_back(T value) {
+			if(count == storageCapacity) {
+				reallocate(2 * storageCapacity);
+			}
+			elements[count++] = value;
+		}
+
+		/*! \brief Remove the last element.
+		 */
+		void pop_back() {
+			--count;
+		}
+
+		/*! \brief Remove an element, keeping the order of the following ones.
+		 *
+		 * \param position The element to remove.
+		 * \return The element following the removed one.
+		 */
+		iterator erase(const_iterator position) {
+			iterator result = begin() + (position - begin());
+			std::copy(result + 1, end(), result);
+			--count;
+			return result;
+		}
+
+		/*! \brief Remove an element in constant time, by replacing it with the last element.
+		 *
+		 * \param position The position of the element to remove.
+		 */
+		void swapAndPop(size_t position) {
+			elements[position] = elements[count - 1];
+			--count;
+		}
+
+		/*! \brief Remove every elements, keeping the capacity.
+		 */
+		void clear() {
+			count = 0;
+		}
+
+		/*! \brief Make sure that a given number of elements can be stored without reallocating.
+		 *
+		 * \param newCapacity The number of elements.
+		 */
+		void reserve(size_t newCapacity) {
+			if(newCapacity > storageCapacity) {
+				reallocate(newCapacity);
+			}
+		}
+
+		/*! \brief Check if two arrays have the same elements, in the same order.
+		 *
+		 * \param other The other array.
+		 */
+		bool operator==(SmallVector const& other) const {
+			return std::equal(begin(), end(), other.begin(), other.end());
+		}
+
+		/*! \brief Check if two arrays differ.
+		 *
+		 * \param other The other array.
+		 */
+		bool operator!=(SmallVector const& other) const {
+			return !(*this == other);
+		}
+
+	protected:
+		/*! \brief Move the elements to a new heap buffer.
+		 *
+		 * \param newCapacity The capacity of the new buffer.
+		 */
+		void reallocate(size_t newCapacity) {
+			T* newElements = static_cast<T*>(::operator new(newCapacity * sizeof(T)));
+			std::copy(begin(), end(), newElements);
+			release();
+			elements        = newElements;
+			storageCapacity = static_cast<std::uint32_t>(newCapacity);
+		}
+
+		/*! \brief Free the heap buffer, if any, and go back to the inline storage.
+		 *
+		 * The number of elements is left unchanged.
+		 */
+		void release() {
+			if(!isInline()) {
+				::operator delete(elements);
+				elements        = inlineElements;
+				storageCapacity = InlineCapacity;
+			}
+		}
+
+		/*! \brief Take the elements of another array, leaving it empty.
+		 *
+		 * The current array must not own a heap buffer.
+		 *
+		 * \param other The other array.
+		 */
+		void steal(SmallVector& other) {
+			if(other.isInline()) {
+				std::copy(other.begin(), other.end(), inlineElements);
+			} else {
+				elements              = other.elements;
+				storageCapacity       = other.storageCapacity;
+				other.elements        = other.inlineElements;
+				other.storageCapacity = InlineCapacity;
+			}
+			count       = other.count;
+			other.count = 0;
+		}
+
+		/*! \brief The elements, either inlineElements or a heap buffer.
+		 */
+		T* elements = inlineElements;
+
+		/*! \brief The number of elements.
+		 */
+		std::uint32_t count = 0;
+
+		/*! \brief The number of elements which can be stored in the current buffer.
+		 */
+		std::uint32_t storageCapacity = InlineCapacity;
+
+		/*! \brief The inline storage.
+		 */
+		T inlineElements[InlineCapacity];
+	};
+}
@@ -0,0 +1,72 @@
+#include "union_find.hpp"
+
+#include <utility>
+
+namespace graph {
+
+	// Every operation is done on the parents only, and the parent of an element can only
+	// decrease, so relaxed atomics are enough to keep the forest acyclic. Threads which need
+	// the final state synchronize by joining.
+
+	ConcurrentUnionFind::ConcurrentUnionFind(size_t size)
+	      : parents(size) {
+		for(size_t i = 0; i < size; ++i) {
+			parents[i].store(static_cast<std::uint32_t>(i), std::memory_order_relaxed);
+		}
+	}
+
+	size_t ConcurrentUnionFind::size() const {
+		return parents.size();
+	}
+
+	std::uint32_t ConcurrentUnionFind::find(std::uint32_t element) {
+		while(true) {
+			std::uint32_t parent = parents[element].load(std::memory_order_relaxed);
+			if(parent == element) {
+				return element;
+			}
+
+			std::uint32_t grandParent = parents[parent].load(std::memory_order_relaxed);
+			if(grandParent != parent) {
+				// Losing the race only means that another thread shortened the path first.
+				parents[element].compare_exchange_weak(
+				        parent, grandParent, std::memory_order_relaxed);
+			}
+			element = grandParent;
+		}
+	}
+
+	bool ConcurrentUnionFind::unite(std::uint32_t a, std::uint32_t b) {
+		while(true) {
+			a = find(a);
+			b = find(b);
+			if(a == b) {
+				return false;
+			}
+			if(a < b) {
+				std::swap(a, b);
+			}
+
+			// a can have been linked by another thread since it was found, in which case the
+			// roots are looked for again.
+			std::uint32_t expected = a;
+			if(parents[a].compare_exchange_strong(expected, b, std::memory_order_relaxed)) {
+				return true;
+			}
+		}
+	}
+
+	bool ConcurrentUnionFind::sameSet(std::uint32_t a, std::uint32_t b) {
+		while(true) {
+			a = find(a);
+			b = find(b);
+			if(a == b) {
+				return true;
+			}
+			// a is still a root, so the sets were really different at this point.
+			if(parents[a].load(std::memory_order_relaxed) == a) {
+				return false;
+			}
+		}
+	}
+}
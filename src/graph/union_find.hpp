@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace graph {
+
+	/*! \brief A disjoint-set forest which can be used by several threads at the same time.
+	 *
+	 * The parent of each element is stored in an atomic word, and the sets are merged with a
+	 * compare-and-swap on the root of one of them, so no lock is ever taken. A root is always
+	 * linked to a root with a lower index, so the root of a set is its lowest element, and the
+	 * paths are shortened by path halving while looking for it.
+	 *
+	 * Only find() and unite() can be called concurrently.
+	 */
+	class ConcurrentUnionFind {
+	public:
+		/*! \brief Create a forest where each element is alone in its set.
+		 *
+		 * \param size The number of elements.
+		 */
+		explicit ConcurrentUnionFind(size_t size = 0);
+
+		/*! \brief Get the number of elements.
+		 */
+		size_t size() const;
+
+		/*! \brief Get the root of the set of an element, which is its lowest element.
+		 *
+		 * \param element The element to look for.
+		 */
+		std::uint32_t find(std::uint32_t element);
+
+		/*! \brief Merge the sets of two elements.
+		 *
+		 * \param a The first element.
+		 * \param b The second element.
+		 * \return true if the elements were in different sets.
+		 */
+		bool unite(std::uint32_t a, std::uint32_t b);
+
+		/*! \brief Check if two elements are in the same set.
+		 *
+		 * \param a The first element.
+		 * \param b The second element.
+		 */
+		bool sameSet(std::uint32_t a, std::uint32_t b);
+
+	protected:
+		/*! \brief The parent of each element, the element itself for the roots.
+		 */
+		std::vector<std::atomic<std::uint32_t>> parents;
+	};
+}
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <new>
 #include <type_traits>
 
+#include <cstddef>
+#include <cstdint>
+
 template <template<typename> class Trait, typename Head, typename... Tail>
 struct check_all
   : std::integral_constant<bool, Trait<Head>::value && check_all<Trait, Tail...>::value> {};
@@ -11,3 +15,69 @@ struct check_all<Trait, Head> : std::integral_constant<bool, Trait<Head>::value>
 
 template<template<typename> class Trait, typename... Args>
 constexpr bool const check_all_v = check_all<Trait, Args...>::value;
+
+/*! \brief An allocator returning memory aligned on a given boundary.
+ *
+ * Used for buffers processed with SIMD instructions, which are faster (or only work) on aligned
+ * memory.
+ */
+template <typename T, std::size_t Alignment>
+struct AlignedAllocator {
+	static_assert((Alignment & (Alignment - 1)) == 0, "The alignment must be a power of two");
+
+	/*! \brief The type of the allocated objects.
+	 */
+	using value_type = T;
+
+	/*! \brief The same allocator for another type.
+	 */
+	template <typename U>
+	struct rebind {
+		/*! \brief The rebound allocator.
+		 */
+		using other = AlignedAllocator<U, Alignment>;
+	};
+
+	AlignedAllocator() = default;
+
+	/*! \brief Construct an allocator from an allocator of another type.
+	 */
+	template <typename U>
+	AlignedAllocator(AlignedAllocator<U, Alignment> const&) {}
+
+	/*! \brief Allocate an aligned array of `count` objects.
+	 *
+	 * The address returned by operator new is stored just before the aligned block.
+	 *
+	 * \param count The number of objects to allocate.
+	 */
+	T* allocate(std::size_t count) {
+		void* raw = ::operator new(count * sizeof(T) + Alignment + sizeof(void*));
+		auto address = reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*);
+		address      = (address + Alignment - 1) & ~static_cast<std::uintptr_t>(Alignment - 1);
+		reinterpret_cast<void**>(address)[-1] = raw;
+		return reinterpret_cast<T*>(address);
+	}
+
+	/*! \brief Deallocate an array allocated by this allocator.
+	 *
+	 * \param pointer The aligned array.
+	 */
+	void deallocate(T* pointer, std::size_t) {
+		::operator delete(reinterpret_cast<void**>(pointer)[-1]);
+	}
+
+	/*! \brief Every aligned allocators are equal.
+	 */
+	template <typename U>
+	bool operator==(AlignedAllocator<U, Alignment> const&) const {
+		return true;
+	}
+
+	/*! \brief Every aligned allocators are equal.
+	 */
+	template <typename U>
+	bool operator!=(AlignedAllocator<U, Alignment> const&) const {
+		return false;
+	}
+};
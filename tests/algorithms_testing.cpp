@@ -1,6 +1,17 @@
 #include "graph.hpp"
 #include "algorithms.hpp"
 #include "printing.hpp"
+#include "random_graphs.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
 
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_ALTERNATIVE_INIT_API
@@ -49,6 +60,97 @@ BOOST_AUTO_TEST_CASE(algorithms_strongly_connected_component) {
 	BOOST_CHECK(graph::stronglyConnectedComponent(myGraph, myGraph["5"]) == expectedForOthers);
 }
 
+BOOST_AUTO_TEST_CASE(algorithms_strongly_connected_component_reverse_index) {
+	using Graph = matrix::Graph<NoProperty, NoProperty>;
+	using ConstNode = Graph::ConstNode_t;
+
+	Graph myGraph{{"0", "1"}, {"1", "2"}, {"2", "0"}, {"2", "3"}, {"3", "4"}, {"4", "3"}};
+	myGraph.setReverseIndex(true);
+
+	std::set<ConstNode> expectedFor0{myGraph["0"], myGraph["1"], myGraph["2"]},
+	        expectedFor3{myGraph["3"], myGraph["4"]};
+
+	BOOST_CHECK(graph::stronglyConnectedComponent(myGraph, myGraph["0"]) == expectedFor0);
+	BOOST_CHECK(graph::stronglyConnectedComponent(myGraph, myGraph["4"]) == expectedFor3);
+	BOOST_CHECK(graph::connectedComponent(myGraph, myGraph["4"]).size() == 5);
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_strongly_connected_components) {
+	using Graph = list::Graph<NoProperty, NoProperty>;
+
+	const Graph myGraph{{"0", "1"},
+	                    {"0", "5"},
+	                    {"1", "2"},
+	                    {"2", "5"},
+	                    {"3", "1"},
+	                    {"3", "2"},
+	                    {"4", "2"},
+	                    {"5", "1"},
+	                    {"5", "3"},
+	                    {"5", "4"},
+	                    {"6", "6"},
+	                    {"6", "0"}};
+
+	std::vector<std::uint32_t> components = graph::stronglyConnectedComponents(myGraph);
+	auto component = [&components, &myGraph](std::string const& name) {
+		return components[myGraph.getId(name)];
+	};
+
+	for(std::string name : {"2", "3", "4", "5"}) {
+		BOOST_CHECK_EQUAL(component(name), component("1"));
+	}
+	BOOST_CHECK_NE(component("0"), component("1"));
+	BOOST_CHECK_NE(component("0"), component("6"));
+
+	// The components are numbered in reverse topological order.
+	BOOST_CHECK_LT(component("1"), component("0"));
+	BOOST_CHECK_LT(component("0"), component("6"));
+
+	auto dag = graph::condensation<Graph>(myGraph, components);
+	BOOST_CHECK_EQUAL(dag.getVerticesCount(), 3);
+	BOOST_CHECK_EQUAL(dag.getEdgesCount(), 2);
+	BOOST_CHECK(dag.hasEdge(dag[std::to_string(component("6"))],
+	                        dag[std::to_string(component("0"))]));
+	BOOST_CHECK(dag.hasEdge(dag[std::to_string(component("0"))],
+	                        dag[std::to_string(component("1"))]));
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_strongly_connected_components_deep_graph) {
+	using Graph = csr::Graph<NoProperty, NoProperty>;
+
+	// A single cycle through every node, deep enough to overflow a recursive implementation.
+	size_t const nodesCount = 200000;
+	list::Graph<NoProperty, NoProperty> cycle;
+	for(size_t i = 0; i < nodesCount; ++i) {
+		cycle.addEdges({std::to_string(i), std::to_string((i + 1) % nodesCount)});
+	}
+	cycle.addEdges({"0", "tail"});
+
+	Graph myGraph(cycle);
+	std::vector<std::uint32_t> components = graph::stronglyConnectedComponents(myGraph);
+
+	BOOST_CHECK_EQUAL(components.size(), nodesCount + 1);
+	BOOST_CHECK(std::all_of(components.begin(), components.end() - 1, [&components](auto c) {
+		return c == components.front();
+	}));
+	BOOST_CHECK_NE(components.back(), components.front());
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_strongly_connected_components_tombstones) {
+	using Graph = matrix::Graph<NoProperty, NoProperty>;
+
+	Graph myGraph{{"0", "1"}, {"1", "0"}, {"1", "2"}, {"2", "3"}, {"3", "2"}};
+	myGraph.setRemovalMode(RemovalMode::Tombstone);
+	myGraph.removeNode(myGraph["1"]);
+
+	std::vector<std::uint32_t> components = graph::stronglyConnectedComponents(myGraph);
+
+	BOOST_CHECK_EQUAL(components.size(), 4);
+	BOOST_CHECK_EQUAL(components[1], graph::noComponent);
+	BOOST_CHECK_EQUAL(components[myGraph.getId("2")], components[myGraph.getId("3")]);
+	BOOST_CHECK_NE(components[myGraph.getId("0")], components[myGraph.getId("2")]);
+}
+
 BOOST_AUTO_TEST_CASE(algorithms_connected_component) {
 	using Graph = list::Graph<NoProperty, NoProperty>;
 	using ConstNode = Graph::ConstNode_t;
@@ -69,6 +171,71 @@ BOOST_AUTO_TEST_CASE(algorithms_connected_component) {
 	BOOST_CHECK(graph::connectedComponent(myGraph, myGraph["7"]) == expectedFor7);
 }
 
+BOOST_AUTO_TEST_CASE(algorithms_connected_components) {
+	using Graph = list::Graph<NoProperty, NoProperty>;
+
+	const Graph myGraph{
+		    {"0", "1"}, {"2", "1"}, {"2", "0"}, {"3", "4"}, {"4", "3"}, {"6", "5"}, {"7", "7"}};
+
+	for(size_t threads : {1, 4}) {
+		std::vector<std::uint32_t> components = graph::connectedComponents(myGraph, threads);
+
+		BOOST_CHECK_EQUAL(components.size(), 8);
+		for(auto vertex : myGraph.vertices()) {
+			for(auto const& other : graph::connectedComponent(myGraph, vertex)) {
+				BOOST_CHECK_EQUAL(components[vertex.getId()], components[other.getId()]);
+			}
+		}
+		BOOST_CHECK_NE(components[myGraph.getId("0")], components[myGraph.getId("3")]);
+		BOOST_CHECK_NE(components[myGraph.getId("5")], components[myGraph.getId("7")]);
+
+		// The components are numbered by their lowest id.
+		BOOST_CHECK_EQUAL(components[myGraph.getId("0")], 0);
+		BOOST_CHECK_EQUAL(components[myGraph.getId("7")], 3);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_connected_components_threads) {
+	using Graph = csr::Graph<NoProperty, NoProperty>;
+
+	// Long chains which cross the blocks of ids given to the threads, in both directions.
+	size_t const nodesCount = 50000, chainsCount = 7;
+	list::Graph<NoProperty, NoProperty> chains;
+	for(size_t i = 0; i < nodesCount; ++i) {
+		chains.addNode(std::to_string(i));
+	}
+	for(size_t i = chainsCount; i < nodesCount; ++i) {
+		size_t previous = i % 2 == 0 ? i - chainsCount : i;
+		size_t next     = i % 2 == 0 ? i : i - chainsCount;
+		chains.addEdges({std::to_string(previous), std::to_string(next)});
+	}
+
+	Graph myGraph(chains);
+	std::vector<std::uint32_t> expected = graph::connectedComponents(myGraph, 1);
+	std::vector<std::uint32_t> components = graph::connectedComponents(myGraph, 4);
+
+	BOOST_CHECK(components == expected);
+	for(size_t i = 0; i < nodesCount; ++i) {
+		BOOST_REQUIRE_EQUAL(components[i], i % chainsCount);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_connected_components_tombstones) {
+	using Graph = list::Graph<NoProperty, NoProperty>;
+
+	Graph myGraph{{"0", "1"}, {"1", "2"}, {"3", "2"}, {"4", "4"}};
+	myGraph.setRemovalMode(RemovalMode::Tombstone);
+	myGraph.removeNode(myGraph["1"]);
+
+	std::vector<std::uint32_t> components = graph::connectedComponents(myGraph, 2);
+
+	BOOST_CHECK_EQUAL(components.size(), 5);
+	BOOST_CHECK_EQUAL(components[1], graph::noComponent);
+	BOOST_CHECK_EQUAL(components[myGraph.getId("2")], components[myGraph.getId("3")]);
+	BOOST_CHECK_NE(components[myGraph.getId("0")], components[myGraph.getId("2")]);
+	BOOST_CHECK_NE(components[myGraph.getId("4")], components[myGraph.getId("2")]);
+}
+
 BOOST_AUTO_TEST_CASE(algorithms_minimum_spanning_tree) {
 	using Graph = list::Graph<NoProperty, WeightedProperty>;
 
@@ -106,3 +273,881 @@ BOOST_AUTO_TEST_CASE(algorithms_minimum_spanning_tree) {
 
 	Graph result = graph::minimumSpanningTree(myUndirectedGraph, myUndirectedGraph["0"]);
 }
+
+BOOST_AUTO_TEST_CASE(algorithms_minimum_spanning_tree_equal_weights) {
+	using Graph = list::Graph<NoProperty, WeightedProperty>;
+
+	// Every edge has the same weight, so a comparison on the weights only would keep a single
+	// candidate edge and give a partial tree.
+	Graph myGraph = graph::undirected(Graph{{"0", "1", {1}},
+	                                        {"0", "2", {1}},
+	                                        {"1", "3", {1}},
+	                                        {"2", "3", {1}},
+	                                        {"3", "4", {1}},
+	                                        {"5", "6", {1}}});
+
+	std::vector<std::pair<size_t, size_t>> treeEdges =
+	        graph::minimumSpanningTreeEdges(myGraph, myGraph.getId("0"));
+	BOOST_CHECK_EQUAL(treeEdges.size(), 4);
+
+	Graph mst = graph::minimumSpanningTree(myGraph, myGraph["0"]);
+	size_t edgesCount = 0;
+	mst.eachEdges([&edgesCount](Graph::NodeRef_t, Graph::NodeRef_t) { ++edgesCount; });
+
+	BOOST_CHECK_EQUAL(mst.getIdBound(), 5);
+	BOOST_CHECK_EQUAL(edgesCount, 8);
+	BOOST_CHECK(!mst.hasNode("5"));
+	BOOST_CHECK_EQUAL(graph::connectedComponent(mst, mst["0"]).size(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_minimum_spanning_tree_edges) {
+	using Graph = csr::Graph<NoProperty, WeightedProperty>;
+
+	Graph myGraph(graph::undirected(list::Graph<NoProperty, WeightedProperty>{
+	        {"0", "1", {4}}, {"0", "2", {1}}, {"2", "1", {2}}, {"1", "3", {5}}, {"2", "3", {8}}}));
+
+	std::vector<std::pair<size_t, size_t>> treeEdges =
+	        graph::minimumSpanningTreeEdges(myGraph, myGraph.getId("0"));
+
+	int totalWeight = 0;
+	for(auto [beginId, endId] : treeEdges) {
+		totalWeight += myGraph.getEdgeProperty(beginId, endId).weight;
+	}
+	BOOST_CHECK_EQUAL(treeEdges.size(), 3);
+	BOOST_CHECK_EQUAL(totalWeight, 8);
+	BOOST_CHECK(treeEdges.front() == std::make_pair(myGraph.getId("0"), myGraph.getId("2")));
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_minimum_spanning_tree_parallel_edges) {
+	using Graph = list::Graph<NoProperty, WeightedProperty>;
+
+	// The tree takes the lightest of the parallel edges, with its own weight.
+	Graph myGraph = graph::undirected(Graph{{"a", "b", {10}}, {"a", "b", {1}}, {"b", "c", {3}}});
+
+	std::vector<int> weights;
+	graph::eachMinimumSpanningTreeEdges(
+	        myGraph, myGraph.getId("a"),
+	        [&weights](size_t, size_t, WeightedProperty const& p) { weights.push_back(p.weight); });
+	BOOST_CHECK(weights == (std::vector<int>{1, 3}));
+
+	Graph mst = graph::minimumSpanningTree(myGraph, myGraph["a"]);
+	BOOST_CHECK_EQUAL(mst.getEdgeProperty(mst["a"], mst["b"]).weight, 1);
+	BOOST_CHECK_EQUAL(mst.getEdgeProperty(mst["b"], mst["a"]).weight, 1);
+	BOOST_CHECK_EQUAL(mst.getEdgeProperty(mst["c"], mst["b"]).weight, 3);
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_minimum_spanning_forest) {
+	using Graph = list::Graph<NoProperty, WeightedProperty>;
+
+	// Two components with the same edges as in algorithms_minimum_spanning_tree, and an
+	// isolated vertex.
+	Graph myGraph = graph::undirected(Graph{{"0", "1", {9}},
+	                                        {"0", "2", {75}},
+	                                        {"1", "2", {95}},
+	                                        {"1", "3", {19}},
+	                                        {"1", "4", {42}},
+	                                        {"2", "3", {51}},
+	                                        {"3", "4", {31}},
+	                                        {"5", "6", {2}},
+	                                        {"6", "7", {2}},
+	                                        {"7", "5", {2}},
+	                                        {"8", "8", {1}}});
+
+	for(size_t threads : {1, 4}) {
+		auto forest = graph::minimumSpanningForest(myGraph, threads);
+
+		BOOST_CHECK_EQUAL(forest.edges.size(), 6);
+		BOOST_CHECK_EQUAL(forest.totalWeight, 9 + 19 + 51 + 31 + 2 + 2);
+
+		std::vector<std::uint32_t> components = graph::connectedComponents(myGraph, 1);
+		for(auto [beginId, endId] : forest.edges) {
+			BOOST_CHECK(myGraph.hasEdge(myGraph.getNode(beginId), myGraph.getNode(endId)));
+			BOOST_CHECK_EQUAL(components[beginId], components[endId]);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_minimum_spanning_forest_threads) {
+	using Graph = csr::Graph<NoProperty, WeightedProperty>;
+
+	// Many edges with equal weights, so that the order of the merges matters.
+	size_t const nodesCount = 20000;
+	list::Graph<NoProperty, WeightedProperty> network;
+	for(size_t i = 0; i < nodesCount; ++i) {
+		for(size_t step : {1, 17, 257}) {
+			size_t j = (i * step + 3) % nodesCount;
+			if(i != j && (i + j) % 11 != 0) {
+				int weight = static_cast<int>((i ^ j) % 4);
+				network.addEdges({{std::to_string(i), std::to_string(j), {weight}},
+				                  {std::to_string(j), std::to_string(i), {weight}}});
+			}
+		}
+	}
+
+	Graph myGraph(network);
+	auto expected = graph::minimumSpanningForest(myGraph, 1);
+	auto forest   = graph::minimumSpanningForest(myGraph, 4);
+
+	std::vector<std::uint32_t> components = graph::connectedComponents(myGraph, 1);
+	size_t componentsCount = *std::max_element(components.begin(), components.end()) + 1;
+
+	BOOST_CHECK_EQUAL(expected.edges.size(), nodesCount - componentsCount);
+	BOOST_CHECK_EQUAL(forest.edges.size(), expected.edges.size());
+	BOOST_CHECK_EQUAL(forest.totalWeight, expected.totalWeight);
+
+	// The tree of the first vertex must be as light as the one given by the Prim algorithm.
+	int treeWeight = 0;
+	for(auto [beginId, endId] : graph::minimumSpanningTreeEdges(myGraph, 0)) {
+		treeWeight += myGraph.getEdgeProperty(beginId, endId).weight;
+	}
+	int forestWeight = 0;
+	for(auto [beginId, endId] : forest.edges) {
+		if(components[beginId] == components[0]) {
+			forestWeight += myGraph.getEdgeProperty(beginId, endId).weight;
+		}
+	}
+	BOOST_CHECK_EQUAL(forestWeight, treeWeight);
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_astar) {
+	using Graph = list::AstarGraph<void>;
+
+	Graph myGraph{{"a", "b", {1}},
+	              {"b", "c", {1}},
+	              {"c", "goal", {1}},
+	              {"a", "d", {1}},
+	              {"d", "goal", {5}},
+	              {"goal", "e", {1}}};
+	myGraph.addNode("alone");
+
+	auto noHeuristic = [](Graph::NodeRef_t) { return 0; };
+
+	ShortestPath<int> path =
+	        graph::astar(myGraph, myGraph.getId("a"), myGraph.getId("goal"), noHeuristic);
+	BOOST_CHECK(path.found());
+	BOOST_CHECK_EQUAL(path.length, 3);
+	BOOST_CHECK(path.ids == (std::vector<size_t>{myGraph.getId("a"),
+	                                             myGraph.getId("b"),
+	                                             myGraph.getId("c"),
+	                                             myGraph.getId("goal")}));
+
+	// A heuristic which is a lower bound but is not consistent still gives a shortest path.
+	auto uneven = [&myGraph](Graph::NodeRef_t vertex) {
+		return vertex.getId() == myGraph.getId("b") ? 2 : 0;
+	};
+	BOOST_CHECK_EQUAL(
+	        graph::astar(myGraph, myGraph.getId("a"), myGraph.getId("goal"), uneven).length, 3);
+
+	BOOST_CHECK(!graph::astar(myGraph, myGraph.getId("a"), myGraph.getId("alone"), noHeuristic)
+	                     .found());
+
+	ShortestPath<int> same =
+	        graph::astar(myGraph, myGraph.getId("e"), myGraph.getId("e"), noHeuristic);
+	BOOST_CHECK(same.ids == std::vector<size_t>{myGraph.getId("e")});
+	BOOST_CHECK_EQUAL(same.length, 0);
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_astar_grid) {
+	using Graph = csr::AstarGraph<void>;
+
+	// A grid where each row is expensive to cross, except on its last column.
+	size_t const width = 20, height = 15;
+	list::AstarGraph<void> grid;
+	for(size_t i = 0; i < width * height; ++i) {
+		grid.addNode(std::to_string(i));
+	}
+	auto link = [&grid](size_t a, size_t b, int weight) {
+		grid.addEdges({{std::to_string(a), std::to_string(b), {weight}},
+		               {std::to_string(b), std::to_string(a), {weight}}});
+	};
+	for(size_t y = 0; y < height; ++y) {
+		for(size_t x = 0; x < width; ++x) {
+			if(x + 1 < width) {
+				link(y * width + x, y * width + x + 1, 1);
+			}
+			if(y + 1 < height) {
+				link(y * width + x, (y + 1) * width + x, x + 1 == width ? 1 : 10);
+			}
+		}
+	}
+
+	Graph myGraph(grid);
+	auto manhattan = [width](size_t goalId) {
+		return [width, goalId](Graph::NodeRef_t vertex) {
+			size_t x = vertex.getId() % width, y = vertex.getId() / width;
+			size_t goalX = goalId % width, goalY = goalId / width;
+			return static_cast<int>((x > goalX ? x - goalX : goalX - x) +
+			                        (y > goalY ? y - goalY : goalY - y));
+		};
+	};
+
+	// The same scratch space is used for every search.
+	SearchScratch<int> scratch;
+	for(size_t startId : {size_t(0), width * height - 1, width * 7 + 3}) {
+		for(size_t goalId : {width - 1, width * (height - 1), width * 4 + 12}) {
+			ShortestPath<int> path =
+			        graph::astar(myGraph, startId, goalId, manhattan(goalId), scratch);
+			ShortestPath<int> reference = graph::astar(
+			        myGraph, startId, goalId, [](Graph::NodeRef_t) { return 0; });
+
+			BOOST_CHECK_EQUAL(path.length, reference.length);
+			BOOST_CHECK_EQUAL(path.ids.front(), startId);
+			BOOST_CHECK_EQUAL(path.ids.back(), goalId);
+
+			int length = 0;
+			for(size_t i = 0; i + 1 < path.ids.size(); ++i) {
+				length += myGraph.getEdgeProperty(path.ids[i], path.ids[i + 1]).weight;
+			}
+			BOOST_CHECK_EQUAL(length, path.length);
+		}
+	}
+
+	BOOST_CHECK_EQUAL(graph::astar(myGraph, 0, width * height - 1, manhattan(width * height - 1))
+	                          .length,
+	                  static_cast<int>(width - 1 + height - 1));
+}
+
+namespace {
+	// An edge property with a floating point weight.
+	struct RealWeight {
+		double weight;
+
+		bool operator==(RealWeight const& other) const {
+			return weight == other.weight;
+		}
+	};
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_dijkstra) {
+	using Graph = list::Graph<NoProperty, WeightedProperty>;
+
+	Graph myGraph{{"0", "1", {4}}, {"0", "2", {1}}, {"2", "1", {2}}, {"1", "3", {1}}};
+	myGraph.addNode("4");
+
+	auto tree = graph::dijkstra(myGraph, myGraph.getId("0"));
+	BOOST_CHECK_EQUAL(tree.distances[myGraph.getId("1")], 3);
+	BOOST_CHECK_EQUAL(tree.distances[myGraph.getId("3")], 4);
+	BOOST_CHECK_EQUAL(tree.parents[myGraph.getId("1")], myGraph.getId("2"));
+	BOOST_CHECK(!tree.isReached(myGraph.getId("4")));
+	BOOST_CHECK_EQUAL(tree.distances[myGraph.getId("4")], ShortestPathTree<int>::unreached);
+
+	ShortestPath<int> path = tree.pathTo(myGraph.getId("3"));
+	BOOST_CHECK_EQUAL(path.length, 4);
+	BOOST_CHECK_EQUAL(path.ids.size(), 4);
+
+	// Real weights use the indexed heap.
+	list::Graph<NoProperty, RealWeight> realGraph{
+	        {"0", "1", {0.5}}, {"0", "2", {0.25}}, {"2", "1", {0.125}}};
+	auto realTree = graph::dijkstra(realGraph, realGraph.getId("0"));
+	BOOST_CHECK_EQUAL(realTree.distances[realGraph.getId("1")], 0.375);
+	BOOST_CHECK_EQUAL(realTree.parents[realGraph.getId("1")], realGraph.getId("2"));
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_dijkstra_random_graph) {
+	using Graph = csr::Graph<NoProperty, WeightedProperty>;
+
+	Graph myGraph(randomWeightedGraph(3000));
+	auto tree = graph::dijkstra(myGraph, 0);
+
+	size_t reachedCount = 0;
+	for(size_t id = 0; id < myGraph.getIdBound(); id += 37) {
+		ShortestPath<int> path = graph::astar(myGraph, 0, id, [](Graph::NodeRef_t) { return 0; });
+		BOOST_REQUIRE_EQUAL(path.found(), tree.isReached(id));
+		if(path.found()) {
+			BOOST_REQUIRE_EQUAL(path.length, tree.distances[id]);
+			++reachedCount;
+		}
+	}
+	BOOST_CHECK_GT(reachedCount, 0);
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_delta_stepping) {
+	using Graph = csr::Graph<NoProperty, WeightedProperty>;
+
+	Graph myGraph(randomWeightedGraph(5000));
+	auto expected = graph::dijkstra(myGraph, 0);
+
+	for(int delta : {1, 4, 1000}) {
+		for(size_t threads : {1, 4}) {
+			auto tree = graph::deltaStepping(myGraph, 0, delta, threads);
+
+			BOOST_CHECK(tree.distances == expected.distances);
+			for(size_t id = 1; id < myGraph.getIdBound(); ++id) {
+				if(tree.isReached(id)) {
+					size_t parent = tree.parents[id];
+					BOOST_REQUIRE_EQUAL(
+					        tree.distances[parent] + myGraph.getEdgeProperty(parent, id).weight,
+					        tree.distances[id]);
+				}
+			}
+		}
+	}
+
+	BOOST_CHECK_EQUAL(graph::deltaStepping(myGraph, 0, 3, 2).parents[0], 0);
+	BOOST_CHECK_THROW(graph::deltaStepping(myGraph, 0, 0, 2), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_bfs) {
+	using Graph = list::Graph<NoProperty, NoProperty>;
+
+	Graph myGraph{{"0", "1"}, {"0", "2"}, {"2", "3"}, {"1", "3"}, {"3", "4"}, {"5", "0"}};
+	myGraph.addNode("6");
+
+	for(bool reverseIndexed : {false, true}) {
+		myGraph.setReverseIndex(reverseIndexed);
+		auto tree = graph::bfs(myGraph, myGraph.getId("0"));
+
+		BOOST_CHECK_EQUAL(tree.distances[myGraph.getId("0")], 0);
+		BOOST_CHECK_EQUAL(tree.distances[myGraph.getId("3")], 2);
+		BOOST_CHECK_EQUAL(tree.distances[myGraph.getId("4")], 3);
+		BOOST_CHECK(!tree.isReached(myGraph.getId("5")));
+		BOOST_CHECK(!tree.isReached(myGraph.getId("6")));
+		BOOST_CHECK_EQUAL(tree.pathTo(myGraph.getId("4")).ids.size(), 4);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_bfs_bottom_up) {
+	using Graph = csr::Graph<NoProperty, WeightedProperty>;
+
+	// A hub linked to many nodes makes the frontier large enough for bottom-up steps.
+	auto withHub = randomWeightedGraph(3000);
+	for(size_t i = 0; i < 3000; i += 3) {
+		withHub.addEdges({"hub", std::to_string(i), {1}});
+	}
+
+	for(auto const& myList : {randomWeightedGraph(3000), withHub}) {
+		Graph myGraph(myList);
+		for(size_t sourceId : {size_t(0), myGraph.getIdBound() - 1}) {
+			auto expected = graph::bfs(myGraph, sourceId);
+			myGraph.setReverseIndex(true);
+			auto tree = graph::bfs(myGraph, sourceId);
+			myGraph.setReverseIndex(false);
+
+			BOOST_CHECK(tree.distances == expected.distances);
+			for(size_t id = 0; id < myGraph.getIdBound(); ++id) {
+				if(tree.isReached(id) && id != sourceId) {
+					size_t parent = tree.parents[id];
+					BOOST_REQUIRE_EQUAL(tree.distances[parent] + 1, tree.distances[id]);
+					BOOST_REQUIRE(myGraph.hasEdge(myGraph.getNode(parent), myGraph.getNode(id)));
+				}
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_multi_source_bfs) {
+	auto myList = randomWeightedGraph(1000);
+	matrix::Graph<NoProperty, WeightedProperty> myMatrix;
+	for(auto vertex : myList.vertices()) {
+		myMatrix.addNode(vertex.getName());
+	}
+	myList.eachEdges([&myList, &myMatrix](auto begin, auto end) {
+		myMatrix.addEdges({begin.getName(), end.getName(), myList.getEdgeProperty(begin, end)});
+	});
+
+	// More sources than bits in a word, with a source given twice.
+	std::vector<size_t> sourceIds;
+	for(size_t id = 0; id < 1000; id += 13) {
+		sourceIds.push_back(id);
+	}
+	sourceIds.push_back(0);
+
+	using Levels = std::vector<std::vector<std::uint32_t>>;
+	std::uint32_t const unreached = ShortestPathTree<std::uint32_t>::unreached;
+
+	Levels levels;
+	auto recordLevels = [&levels, &sourceIds, unreached](size_t id, std::uint32_t level,
+	                                                     bits::Word const* sources) {
+		for(size_t i = 0; i < sourceIds.size(); ++i) {
+			if((sources[i / bits::wordBits] >> (i % bits::wordBits)) & 1) {
+				BOOST_REQUIRE_EQUAL(levels[i][id], unreached);
+				levels[i][id] = level;
+			}
+		}
+	};
+
+	levels.assign(sourceIds.size(), std::vector<std::uint32_t>(1000, unreached));
+	BitMatrix listReached = graph::multiSourceBfs(myList, sourceIds, recordLevels);
+	Levels listLevels     = levels;
+
+	levels.assign(sourceIds.size(), std::vector<std::uint32_t>(1000, unreached));
+	BitMatrix matrixReached = graph::multiSourceBfs(myMatrix, sourceIds, recordLevels);
+
+	BOOST_CHECK(listReached == matrixReached);
+	BOOST_CHECK(listLevels == levels);
+	for(size_t i = 0; i < sourceIds.size(); ++i) {
+		auto tree = graph::bfs(myList, sourceIds[i]);
+		BOOST_REQUIRE(tree.distances == levels[i]);
+		for(size_t id = 0; id < 1000; ++id) {
+			BOOST_REQUIRE_EQUAL(listReached.test(id, i), tree.isReached(id));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_bidirectional_bfs) {
+	using Graph = csr::Graph<NoProperty, WeightedProperty>;
+
+	Graph myGraph(randomWeightedGraph(2000));
+	SearchScratch<std::uint32_t> forward, backward;
+	for(bool reverseIndexed : {false, true}) {
+		myGraph.setReverseIndex(reverseIndexed);
+		for(size_t startId : {size_t(0), size_t(1234)}) {
+			auto tree = graph::bfs(myGraph, startId);
+			for(size_t goalId = 0; goalId < myGraph.getIdBound(); goalId += 41) {
+				auto path = graph::bidirectionalBfs(myGraph, startId, goalId, forward, backward);
+				BOOST_REQUIRE_EQUAL(path.found(), tree.isReached(goalId));
+				if(!path.found()) {
+					continue;
+				}
+				BOOST_REQUIRE_EQUAL(path.length, tree.distances[goalId]);
+				BOOST_REQUIRE_EQUAL(path.ids.size(), path.length + 1);
+				BOOST_REQUIRE_EQUAL(path.ids.front(), startId);
+				BOOST_REQUIRE_EQUAL(path.ids.back(), goalId);
+				for(size_t i = 0; i + 1 < path.ids.size(); ++i) {
+					BOOST_REQUIRE(myGraph.hasEdge(myGraph.getNode(path.ids[i]),
+					                              myGraph.getNode(path.ids[i + 1])));
+				}
+			}
+		}
+	}
+
+	BOOST_CHECK(graph::bidirectionalBfs(myGraph, 3, 3).ids == std::vector<size_t>{3});
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_bidirectional_dijkstra) {
+	using Graph = list::Graph<NoProperty, WeightedProperty>;
+
+	Graph myGraph{{"0", "1", {4}}, {"0", "2", {1}}, {"2", "1", {2}}, {"1", "3", {1}}};
+	myGraph.addNode("4");
+
+	auto path = graph::bidirectionalDijkstra(myGraph, myGraph.getId("0"), myGraph.getId("3"));
+	BOOST_CHECK_EQUAL(path.length, 4);
+	BOOST_CHECK(path.ids == (std::vector<size_t>{myGraph.getId("0"), myGraph.getId("2"),
+	                                             myGraph.getId("1"), myGraph.getId("3")}));
+	BOOST_CHECK(!graph::bidirectionalDijkstra(myGraph, myGraph.getId("3"), myGraph.getId("0"))
+	                     .found());
+	BOOST_CHECK(!graph::bidirectionalDijkstra(myGraph, myGraph.getId("0"), myGraph.getId("4"))
+	                     .found());
+
+	// The backward search takes each parallel edge with its own weight.
+	Graph parallel{{"a", "x", {1}}, {"x", "b", {10}}, {"x", "b", {1}}};
+	size_t startId = parallel.getId("a"), goalId = parallel.getId("b");
+	for(bool reverseIndexed : {false, true}) {
+		parallel.setReverseIndex(reverseIndexed);
+		csr::Graph<NoProperty, WeightedProperty> parallelCsr(parallel);
+		parallelCsr.setReverseIndex(reverseIndexed);
+		BOOST_CHECK_EQUAL(graph::bidirectionalDijkstra(parallel, startId, goalId).length, 2);
+		BOOST_CHECK_EQUAL(graph::bidirectionalDijkstra(parallelCsr, startId, goalId).length, 2);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_predecessor_index) {
+	using Graph   = list::Graph<NoProperty, WeightedProperty>;
+	using NodeRef = Graph::NodeRef_t;
+	using Edges   = std::multiset<std::pair<size_t, int>>;
+
+	// The index built from the adjacents gives the same edges as the reverse index.
+	Graph myGraph = randomWeightedGraph(300);
+	PredecessorIndex<Graph> built(myGraph, true);
+	Graph indexed = myGraph;
+	indexed.setReverseIndex(true);
+	PredecessorIndex<Graph> read(indexed);
+	for(auto vertex : myGraph.vertices()) {
+		Edges builtEdges, readEdges;
+		size_t builtCount = 0;
+		built.eachPredecessorEdges(vertex, [&builtEdges](NodeRef begin, auto const& p) {
+			builtEdges.emplace(begin.getId(), p.weight);
+		});
+		built.eachPredecessors(vertex, [&builtCount](NodeRef) { ++builtCount; });
+		read.eachPredecessorEdges(NodeRef(indexed, vertex.getId()),
+		                          [&readEdges](NodeRef begin, auto const& p) {
+			                          readEdges.emplace(begin.getId(), p.weight);
+		                          });
+		BOOST_REQUIRE(builtEdges == readEdges);
+		BOOST_REQUIRE_EQUAL(builtCount, builtEdges.size());
+	}
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_bidirectional_dijkstra_random_graph) {
+	using Graph = csr::Graph<NoProperty, WeightedProperty>;
+
+	Graph myGraph(randomWeightedGraph(2000));
+	myGraph.setReverseIndex(true);
+	SearchScratch<int> forward, backward;
+	for(size_t startId : {size_t(0), size_t(777)}) {
+		auto tree = graph::dijkstra(myGraph, startId);
+		for(size_t goalId = 0; goalId < myGraph.getIdBound(); goalId += 29) {
+			auto path = graph::bidirectionalDijkstra(myGraph, startId, goalId, forward, backward);
+			BOOST_REQUIRE_EQUAL(path.found(), tree.isReached(goalId));
+			if(!path.found()) {
+				continue;
+			}
+			BOOST_REQUIRE_EQUAL(path.length, tree.distances[goalId]);
+
+			// The path goes through the lightest of the parallel edges.
+			int length = 0;
+			for(size_t i = 0; i + 1 < path.ids.size(); ++i) {
+				int weight = std::numeric_limits<int>::max();
+				myGraph.eachAdjacentEdges(myGraph.getNode(path.ids[i]),
+				                          [&](auto end, WeightedProperty const& p) {
+					                          if(end.getId() == path.ids[i + 1]) {
+						                          weight = std::min(weight, p.weight);
+					                          }
+				                          });
+				length += weight;
+			}
+			BOOST_REQUIRE_EQUAL(length, path.length);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_floyd_warshall) {
+	using Graph = matrix::Graph<NoProperty, WeightedProperty>;
+
+	// Enough vertices for several tiles, the last one being partly filled.
+	auto myList = randomWeightedGraph(150);
+	Graph myGraph;
+	for(auto vertex : myList.vertices()) {
+		myGraph.addNode(vertex.getName());
+	}
+	myList.eachEdges([&myList, &myGraph](auto begin, auto end) {
+		myGraph.addEdges({begin.getName(), end.getName(), myList.getEdgeProperty(begin, end)});
+	});
+
+	for(size_t threads : {1, 3}) {
+		auto paths = graph::floydWarshall(myGraph, threads);
+		for(size_t beginId = 0; beginId < myGraph.getIdBound(); ++beginId) {
+			auto tree = graph::dijkstra(myGraph, beginId);
+			for(size_t endId = 0; endId < myGraph.getIdBound(); ++endId) {
+				BOOST_REQUIRE_EQUAL(paths.isReached(beginId, endId), tree.isReached(endId));
+				if(!tree.isReached(endId)) {
+					continue;
+				}
+				BOOST_REQUIRE_EQUAL(paths.getDistance(beginId, endId), tree.distances[endId]);
+
+				auto path  = paths.pathBetween(beginId, endId);
+				int length = 0;
+				for(size_t i = 0; i + 1 < path.ids.size(); ++i) {
+					length += myGraph.getEdgeProperty(path.ids[i], path.ids[i + 1]).weight;
+				}
+				BOOST_REQUIRE_EQUAL(length, path.length);
+			}
+		}
+	}
+
+	matrix::Graph<NoProperty, RealWeight> realGraph{
+	        {"0", "1", {0.5}}, {"0", "2", {0.25}}, {"2", "1", {0.125}}};
+	auto realPaths = graph::floydWarshall(realGraph);
+	BOOST_CHECK_EQUAL(realPaths.getDistance(realGraph.getId("0"), realGraph.getId("1")), 0.375);
+	BOOST_CHECK(realPaths.pathBetween(realGraph.getId("0"), realGraph.getId("1")).ids ==
+	            (std::vector<size_t>{realGraph.getId("0"), realGraph.getId("2"),
+	                                 realGraph.getId("1")}));
+	BOOST_CHECK(!realPaths.pathBetween(realGraph.getId("1"), realGraph.getId("0")).found());
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_floyd_warshall_removed_nodes) {
+	using Graph = matrix::Graph<NoProperty, WeightedProperty>;
+
+	// The id of a removed node is not reached, even from itself.
+	Graph myGraph{{"0", "1", {2}}, {"1", "2", {3}}, {"2", "0", {4}}, {"3", "3", {1}}};
+	myGraph.setRemovalMode(RemovalMode::Tombstone);
+	size_t removedId = myGraph.getId("1");
+	myGraph.removeNode(myGraph["1"]);
+
+	auto paths = graph::floydWarshall(myGraph);
+	BOOST_REQUIRE_EQUAL(paths.idBound, 4);
+	BOOST_CHECK(!paths.isReached(removedId, removedId));
+	BOOST_CHECK_EQUAL(paths.getDistance(removedId, removedId), decltype(paths)::unreached);
+	BOOST_CHECK(!paths.pathBetween(removedId, removedId).found());
+	for(std::string name : {"0", "2", "3"}) {
+		size_t id = myGraph.getId(name);
+		BOOST_CHECK(paths.isReached(id, id));
+		BOOST_CHECK_EQUAL(paths.getDistance(id, id), 0);
+		BOOST_CHECK(!paths.isReached(id, removedId));
+		BOOST_CHECK(!paths.isReached(removedId, id));
+	}
+	BOOST_CHECK_EQUAL(paths.getDistance(myGraph.getId("2"), myGraph.getId("0")), 4);
+	BOOST_CHECK(!paths.isReached(myGraph.getId("0"), myGraph.getId("2")));
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_transitive_closure) {
+	using Graph = matrix::Graph<NoProperty, NoProperty>;
+
+	Graph myGraph{{"0", "1"}, {"1", "2"}, {"2", "1"}, {"2", "3"}, {"4", "3"}, {"5", "5"}};
+	auto closure = graph::transitiveClosure(myGraph);
+
+	auto reachable = [&myGraph, &closure](std::string const& begin, std::string const& end) {
+		return closure.reachable(myGraph.getId(begin), myGraph.getId(end));
+	};
+	BOOST_CHECK(reachable("0", "3"));
+	BOOST_CHECK(reachable("2", "1"));
+	BOOST_CHECK(reachable("4", "4"));
+	BOOST_CHECK(reachable("5", "5"));
+	BOOST_CHECK(!reachable("1", "0"));
+	BOOST_CHECK(!reachable("4", "2"));
+	BOOST_CHECK(!reachable("3", "5"));
+
+	// The same reachability as a search from each vertex.
+	auto myList = randomWeightedGraph(500);
+	myList.setRemovalMode(RemovalMode::Tombstone);
+	myList.removeNode(myList["42"]);
+	auto randomClosure = graph::transitiveClosure(myList);
+	for(auto vertex : myList.vertices()) {
+		auto eachNext = [&myList](auto current, auto&& f) { myList.eachAdjacents(current, f); };
+		auto reached  = graph::reachableIds(myList, vertex.getId(), eachNext);
+		for(size_t id = 0; id < myList.getIdBound(); ++id) {
+			BOOST_REQUIRE_EQUAL(randomClosure.reachable(vertex.getId(), id), reached[id]);
+		}
+	}
+	BOOST_CHECK_EQUAL(randomClosure.reachability.count(42), 0);
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_page_rank) {
+	using Graph = list::Graph<NoProperty, NoProperty>;
+
+	// "3" has no outgoing edge, its rank is spread over every vertex.
+	Graph myGraph{{"0", "1"}, {"0", "2"}, {"1", "2"}, {"2", "0"}, {"2", "3"}};
+	auto ranks = graph::pageRank(myGraph, 0.85, 1e-12);
+
+	// The same ranks with a plain power iteration.
+	std::vector<double> expected(4, 0.25);
+	for(int iteration = 0; iteration < 1000; ++iteration) {
+		double base = (0.15 + 0.85 * expected[myGraph.getId("3")]) / 4.;
+		std::vector<double> next(4, base);
+		for(auto [begin, end] : myGraph.edges()) {
+			auto adjacents = myGraph.adjacents(begin.getId());
+			double degree  = static_cast<double>(std::distance(adjacents.begin(), adjacents.end()));
+			next[end.getId()] += 0.85 * expected[begin.getId()] / degree;
+		}
+		expected = next;
+	}
+
+	double sum = 0.;
+	for(size_t id = 0; id < 4; ++id) {
+		BOOST_CHECK_CLOSE(ranks[id], expected[id], 1e-6);
+		sum += ranks[id];
+	}
+	BOOST_CHECK_CLOSE(sum, 1., 1e-9);
+	BOOST_CHECK_GT(ranks[myGraph.getId("2")], ranks[myGraph.getId("1")]);
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_page_rank_threads) {
+	auto myList = randomWeightedGraph(3000);
+	myList.setRemovalMode(RemovalMode::Tombstone);
+	myList.removeNode(myList["17"]);
+	csr::Graph<NoProperty, WeightedProperty> myCsr(randomWeightedGraph(3000));
+
+	auto expected = graph::pageRank(myList);
+	BOOST_CHECK_EQUAL(expected[17], 0.);
+	for(size_t threads : {2, 4, 7}) {
+		auto ranks = graph::pageRank(myList, 0.85, 1e-9, 100, threads);
+		for(size_t id = 0; id < ranks.size(); ++id) {
+			BOOST_REQUIRE_SMALL(ranks[id] - expected[id], 1e-12);
+		}
+	}
+
+	auto csrRanks = graph::pageRank(myCsr, 0.85, 1e-9, 100, 4);
+	double sum    = 0.;
+	for(double rank : csrRanks) {
+		sum += rank;
+	}
+	BOOST_CHECK_CLOSE(sum, 1., 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_triangles) {
+	std::initializer_list<Edge<NoProperty>> edges{
+	        {"0", "1"}, {"1", "2"}, {"2", "0"}, {"2", "3"}, {"3", "2"}, {"1", "3"}, {"3", "3"}};
+	list::Graph<NoProperty, NoProperty> myList(edges);
+	myList.addNode("4");
+	csr::Graph<NoProperty, NoProperty> myCsr(myList);
+	matrix::Graph<NoProperty, NoProperty> myMatrix(edges);
+	myMatrix.addNode("4");
+
+	// The triangles are {0, 1, 2} and {1, 2, 3}, the two edges between 2 and 3 count once.
+	std::vector<double> expected{1., 2. / 3., 2. / 3., 1., 0.};
+	auto checkCoefficients = [&expected](std::vector<double> const& coefficients) {
+		BOOST_REQUIRE_EQUAL(coefficients.size(), expected.size());
+		for(size_t id = 0; id < expected.size(); ++id) {
+			BOOST_CHECK_CLOSE(coefficients[id], expected[id], 1e-9);
+		}
+	};
+
+	BOOST_CHECK_EQUAL(graph::countTriangles(myList), 2);
+	BOOST_CHECK_EQUAL(graph::countTriangles(myCsr), 2);
+	BOOST_CHECK_EQUAL(graph::countTriangles(myMatrix), 2);
+	checkCoefficients(graph::clusteringCoefficients(myList));
+	checkCoefficients(graph::clusteringCoefficients(myCsr));
+	checkCoefficients(graph::clusteringCoefficients(myMatrix));
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_triangles_random) {
+	size_t const nodesCount = 400;
+	list::Graph<NoProperty, NoProperty> myList;
+	matrix::Graph<NoProperty, NoProperty> myMatrix;
+	for(size_t i = 0; i < nodesCount; ++i) {
+		myList.addNode(std::to_string(i));
+		myMatrix.addNode(std::to_string(i));
+	}
+
+	// Close neighbours give many triangles, and node 0 is a hub linked to one node in three.
+	std::vector<std::vector<bool>> connected(nodesCount, std::vector<bool>(nodesCount, false));
+	auto connect = [&](size_t begin, size_t end) {
+		myList.addEdges({std::to_string(begin), std::to_string(end)});
+		myMatrix.addEdges({std::to_string(begin), std::to_string(end)});
+		connected[begin][end] = connected[end][begin] = begin != end;
+	};
+	for(size_t i = 0; i < nodesCount; ++i) {
+		for(size_t step : {1, 2, 5}) {
+			connect(i, (i * 7 + step) % nodesCount);
+		}
+		if(i % 3 == 0) {
+			connect(i, 0);
+		}
+	}
+	csr::Graph<NoProperty, NoProperty> myCsr(myList);
+
+	size_t expectedCount = 0;
+	std::vector<double> expected(nodesCount, 0.);
+	for(size_t id = 0; id < nodesCount; ++id) {
+		std::vector<size_t> neighbours;
+		for(size_t other = 0; other < nodesCount; ++other) {
+			if(connected[id][other]) {
+				neighbours.push_back(other);
+			}
+		}
+		size_t triangles = 0;
+		for(size_t i = 0; i < neighbours.size(); ++i) {
+			for(size_t j = i + 1; j < neighbours.size(); ++j) {
+				triangles += connected[neighbours[i]][neighbours[j]] ? 1 : 0;
+			}
+		}
+		expectedCount += triangles;
+		if(neighbours.size() >= 2) {
+			expected[id] = 2. * static_cast<double>(triangles) /
+			               static_cast<double>(neighbours.size() * (neighbours.size() - 1));
+		}
+	}
+	expectedCount /= 3;
+	BOOST_REQUIRE_GT(expectedCount, 100);
+
+	BOOST_CHECK_EQUAL(graph::countTriangles(myList), expectedCount);
+	BOOST_CHECK_EQUAL(graph::countTriangles(myList, 4), expectedCount);
+	BOOST_CHECK_EQUAL(graph::countTriangles(myCsr, 3), expectedCount);
+	BOOST_CHECK_EQUAL(graph::countTriangles(myMatrix, 2), expectedCount);
+	for(auto const& coefficients : {graph::clusteringCoefficients(myList),
+	                                graph::clusteringCoefficients(myCsr, 4),
+	                                graph::clusteringCoefficients(myMatrix, 3)}) {
+		for(size_t id = 0; id < nodesCount; ++id) {
+			BOOST_REQUIRE_SMALL(coefficients[id] - expected[id], 1e-12);
+		}
+	}
+
+	// A removed node leaves its triangles and its coefficient.
+	myList.setRemovalMode(RemovalMode::Tombstone);
+	myList.removeNode(myList["0"]);
+	auto coefficients = graph::clusteringCoefficients(myList);
+	BOOST_CHECK_EQUAL(coefficients[0], 0.);
+	BOOST_CHECK_LT(graph::countTriangles(myList), expectedCount);
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_each_common_ids) {
+	std::vector<std::uint32_t> small{3, 40, 41, 500, 999}, large;
+	for(std::uint32_t id = 0; id < 1000; id += 3) {
+		large.push_back(id);
+	}
+
+	// The large array is more than 16 times larger, so it is searched with galloping steps.
+	for(auto [first, second] : {std::make_pair(&small, &large), std::make_pair(&large, &small)}) {
+		std::vector<std::uint32_t> common;
+		graph::eachCommonIds(first->data(),
+		                     first->data() + first->size(),
+		                     second->data(),
+		                     second->data() + second->size(),
+		                     [&common](std::uint32_t id) { common.push_back(id); });
+		BOOST_CHECK(common == std::vector<std::uint32_t>({3, 999}));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_topological_order) {
+	using Graph = list::Graph<NoProperty, WeightedProperty>;
+
+	Graph myGraph{
+	        {"a", "b", {1}}, {"a", "c", {1}}, {"c", "b", {1}}, {"b", "d", {1}}, {"e", "d", {1}}};
+	myGraph.addNode("f");
+	auto order = graph::topologicalOrder(myGraph);
+
+	BOOST_REQUIRE_EQUAL(order.size(), 6);
+	std::vector<size_t> positions(myGraph.getIdBound());
+	for(size_t i = 0; i < order.size(); ++i) {
+		positions[order[i]] = i;
+	}
+	for(auto [begin, end] : myGraph.edges()) {
+		BOOST_CHECK_LT(positions[begin.getId()], positions[end.getId()]);
+	}
+	// The vertices without predecessors come first, in order of ids.
+	BOOST_CHECK_EQUAL(myGraph.getName(order[0]), "a");
+	BOOST_CHECK_EQUAL(myGraph.getName(order[1]), "e");
+	BOOST_CHECK_EQUAL(myGraph.getName(order[2]), "f");
+
+	// The cycle is c -> b -> g -> c, which d and h are reached from.
+	myGraph.addEdges({{"b", "g", {1}}, {"g", "c", {1}}, {"g", "h", {1}}});
+	auto isCycleError = [](std::invalid_argument const& error) {
+		std::string message = error.what();
+		return message.find("through c,") != std::string::npos ||
+		       message.find("through b,") != std::string::npos ||
+		       message.find("through g,") != std::string::npos;
+	};
+	BOOST_CHECK_EXCEPTION(graph::topologicalOrder(myGraph), std::invalid_argument, isCycleError);
+	BOOST_CHECK_THROW(graph::criticalPath(myGraph), std::invalid_argument);
+
+	Graph loop{{"a", "a", {1}}};
+	BOOST_CHECK_THROW(graph::topologicalOrder(loop), std::invalid_argument);
+	BOOST_CHECK(graph::topologicalOrder(Graph()).empty());
+}
+
+BOOST_AUTO_TEST_CASE(algorithms_dag_paths) {
+	using Graph = list::Graph<NoProperty, WeightedProperty>;
+
+	// The weight of an edge is the duration of the job at its beginning.
+	Graph jobs{{"fetch", "configure", {2}},
+	           {"configure", "compile", {1}},
+	           {"configure", "docs", {1}},
+	           {"compile", "link", {7}},
+	           {"docs", "package", {3}},
+	           {"link", "package", {2}},
+	           {"assets", "package", {4}},
+	           {"fetch", "test", {2}},
+	           {"link", "test", {2}}};
+
+	auto tree = graph::dagLongestPaths(jobs);
+	BOOST_CHECK_EQUAL(tree.distances[jobs.getId("fetch")], 0);
+	BOOST_CHECK_EQUAL(tree.distances[jobs.getId("assets")], 0);
+	BOOST_CHECK_EQUAL(tree.distances[jobs.getId("docs")], 3);
+	BOOST_CHECK_EQUAL(tree.distances[jobs.getId("link")], 10);
+	BOOST_CHECK_EQUAL(tree.distances[jobs.getId("package")], 12);
+	BOOST_CHECK_EQUAL(tree.parents[jobs.getId("assets")], jobs.getId("assets"));
+
+	ShortestPath<int> critical = graph::criticalPath(jobs);
+	BOOST_CHECK_EQUAL(critical.length, 12);
+	std::vector<std::string> names;
+	for(size_t id : critical.ids) {
+		names.emplace_back(jobs.getName(id));
+	}
+	BOOST_CHECK(names ==
+	            std::vector<std::string>({"fetch", "configure", "compile", "link", "package"}));
+
+	// A negative weight shortens the paths through link.
+	jobs.setEdgeProperty(jobs["compile"], jobs["link"], {-7});
+	csr::Graph<NoProperty, WeightedProperty> myCsr(jobs);
+	for(auto const& shortest : {graph::dagShortestPaths(jobs, jobs.getId("configure")),
+	                            graph::dagShortestPaths(myCsr, myCsr.getId("configure"))}) {
+		BOOST_CHECK_EQUAL(shortest.distances[jobs.getId("package")], -4);
+		BOOST_CHECK_EQUAL(shortest.distances[jobs.getId("test")], -4);
+		BOOST_CHECK_EQUAL(shortest.parents[jobs.getId("package")], jobs.getId("link"));
+		BOOST_CHECK(!shortest.isReached(jobs.getId("fetch")));
+		BOOST_CHECK(!shortest.isReached(jobs.getId("assets")));
+		BOOST_CHECK_EQUAL(shortest.pathTo(jobs.getId("test")).ids.size(), 4);
+	}
+
+	BOOST_CHECK(!graph::criticalPath(Graph()).found());
+}
@@ -0,0 +1,146 @@
+#include "bit_matrix.hpp"
+
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+using namespace graph;
+
+BOOST_AUTO_TEST_CASE(bit_matrix_creation) {
+	BitMatrix matrix(3, 130);
+
+	BOOST_CHECK_EQUAL(matrix.getRowsCount(), 3);
+	BOOST_CHECK_EQUAL(matrix.getColumnsCount(), 130);
+	BOOST_CHECK_EQUAL(matrix.getWordsPerRow() % 4, 0);
+	BOOST_CHECK_EQUAL(matrix.count(), 0);
+	BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(matrix.row(0)) % 32, 0);
+}
+
+BOOST_AUTO_TEST_CASE(bit_matrix_set_and_count) {
+	BitMatrix matrix(2, 200);
+
+	matrix.set(0, 0);
+	matrix.set(0, 63);
+	matrix.set(0, 64);
+	matrix.set(1, 199);
+
+	BOOST_CHECK(matrix.test(0, 63));
+	BOOST_CHECK(!matrix.test(0, 62));
+	BOOST_CHECK_EQUAL(matrix.count(), 4);
+	BOOST_CHECK_EQUAL(matrix.count(0), 3);
+
+	matrix.reset(0, 63);
+	BOOST_CHECK(!matrix.test(0, 63));
+	BOOST_CHECK_EQUAL(matrix.count(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(bit_matrix_each_set_bits) {
+	BitMatrix matrix(1, 300);
+	std::vector<size_t> expected{3, 64, 127, 128, 299}, result;
+
+	for(size_t column : expected) {
+		matrix.set(0, column);
+	}
+	matrix.eachSetBits(0, [&result](size_t column) { result.push_back(column); });
+
+	BOOST_CHECK(result == expected);
+}
+
+BOOST_AUTO_TEST_CASE(bit_matrix_set_bit_iterator) {
+	BitMatrix matrix(2, 300);
+	std::vector<size_t> expected{0, 63, 64, 200, 299};
+
+	for(size_t column : expected) {
+		matrix.set(1, column);
+	}
+
+	std::vector<size_t> result(matrix.beginSetBits(1), matrix.endSetBits(1));
+	BOOST_CHECK(result == expected);
+	BOOST_CHECK(matrix.beginSetBits(0) == matrix.endSetBits(0));
+}
+
+BOOST_AUTO_TEST_CASE(bit_matrix_resize_keeps_bits) {
+	BitMatrix matrix;
+
+	for(size_t i = 0; i < 100; ++i) {
+		matrix.resize(i + 1, i + 1);
+		matrix.set(i, i);
+		matrix.set(0, i);
+	}
+
+	BOOST_CHECK_EQUAL(matrix.count(), 199);
+	for(size_t i = 0; i < 100; ++i) {
+		BOOST_CHECK(matrix.test(i, i));
+		BOOST_CHECK(matrix.test(0, i));
+	}
+
+	matrix.resize(50, 50);
+	BOOST_CHECK_EQUAL(matrix.count(), 99);
+	matrix.resize(100, 100);
+	BOOST_CHECK_EQUAL(matrix.count(), 99);
+}
+
+BOOST_AUTO_TEST_CASE(bit_matrix_erase_row_and_column) {
+	BitMatrix matrix(130, 130);
+	for(size_t i = 0; i < 130; ++i) {
+		matrix.set(i, (i + 1) % 130);
+	}
+
+	matrix.eraseRowAndColumn(5);
+
+	BOOST_CHECK_EQUAL(matrix.getRowsCount(), 129);
+	BOOST_CHECK_EQUAL(matrix.getColumnsCount(), 129);
+	BOOST_CHECK_EQUAL(matrix.count(), 128);
+	BOOST_CHECK(matrix.test(5, 6));
+	BOOST_CHECK(matrix.test(62, 63));
+	BOOST_CHECK(matrix.test(63, 64));
+	BOOST_CHECK(matrix.test(64, 65));
+	BOOST_CHECK(matrix.test(128, 0));
+	BOOST_CHECK(!matrix.test(4, 4));
+	BOOST_CHECK(!matrix.test(4, 5));
+}
+
+BOOST_AUTO_TEST_CASE(bit_matrix_row_operations) {
+	BitMatrix matrix(3, 300);
+	for(size_t column = 0; column < 300; column += 2) {
+		matrix.set(0, column);
+	}
+	for(size_t column = 0; column < 300; column += 3) {
+		matrix.set(1, column);
+	}
+
+	BOOST_CHECK_EQUAL(bits::andPopcount(matrix.row(0), matrix.row(1), matrix.getWordsPerRow()), 50);
+	matrix.orRow(2, 0);
+	matrix.andRow(2, 1);
+	BOOST_CHECK_EQUAL(matrix.count(2), 50);
+
+	matrix.orRow(0, 1);
+	BOOST_CHECK_EQUAL(matrix.count(0), 200);
+
+	bits::andNotWords(matrix.row(0), matrix.row(1), matrix.getWordsPerRow());
+	BOOST_CHECK_EQUAL(matrix.count(0), 100);
+}
+
+BOOST_AUTO_TEST_CASE(bit_matrix_word_operations) {
+	// Every count of words, so that the SIMD kernels leave every possible tail.
+	for(size_t count = 0; count < 11; ++count) {
+		std::vector<bits::Word> first(count), second(count);
+		for(size_t i = 0; i < count; ++i) {
+			first[i]  = bits::Word(0x9e3779b97f4a7c15) * (i + 1);
+			second[i] = bits::Word(0xc2b2ae3d27d4eb4f) * (i + 3);
+		}
+
+		std::vector<bits::Word> orResult = first, andResult = first, andNotResult = first;
+		bits::orWords(orResult.data(), second.data(), count);
+		bits::andWords(andResult.data(), second.data(), count);
+		bits::andNotWords(andNotResult.data(), second.data(), count);
+		for(size_t i = 0; i < count; ++i) {
+			BOOST_REQUIRE_EQUAL(orResult[i], first[i] | second[i]);
+			BOOST_REQUIRE_EQUAL(andResult[i], first[i] & second[i]);
+			BOOST_REQUIRE_EQUAL(andNotResult[i], first[i] & ~second[i]);
+		}
+	}
+}
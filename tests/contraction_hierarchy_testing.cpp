@@ -0,0 +1,112 @@
+#include "graph.hpp"
+#include "algorithms.hpp"
+#include "contraction_hierarchy.hpp"
+#include "random_graphs.hpp"
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+using namespace graph;
+
+namespace {
+	// Check that the hierarchy finds the same distances as the Dijkstra algorithm, with paths
+	// made of edges of the graph.
+	template <typename Graph>
+	void checkQueries(Graph const& g, ContractionHierarchy<int> const& hierarchy) {
+		SearchScratch<int> forward, backward;
+		for(auto start : g.vertices()) {
+			if(start.getId() % 17 != 0) {
+				continue;
+			}
+			auto tree = dijkstra(g, start.getId());
+			for(auto goal : g.vertices()) {
+				auto path = hierarchy.shortestPath(start.getId(), goal.getId(), forward, backward);
+				BOOST_REQUIRE_EQUAL(path.found(), tree.isReached(goal.getId()));
+				if(!path.found()) {
+					continue;
+				}
+				BOOST_REQUIRE_EQUAL(path.length, tree.distances[goal.getId()]);
+				BOOST_REQUIRE_EQUAL(path.ids.front(), start.getId());
+				BOOST_REQUIRE_EQUAL(path.ids.back(), goal.getId());
+
+				int length = 0;
+				for(size_t i = 0; i + 1 < path.ids.size(); ++i) {
+					BOOST_REQUIRE(g.hasEdge(g.getNode(path.ids[i]), g.getNode(path.ids[i + 1])));
+					length += g.getEdgeProperty(path.ids[i], path.ids[i + 1]).weight;
+				}
+				BOOST_REQUIRE_LE(path.length, length);
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(contraction_hierarchy_small) {
+	list::WeightedGraph myGraph{
+	        {"0", "1", {4}}, {"0", "2", {1}}, {"2", "1", {2}}, {"1", "3", {1}}, {"3", "0", {2}}};
+	myGraph.addNode("4");
+
+	ContractionHierarchy<int> hierarchy(myGraph);
+	BOOST_CHECK_EQUAL(hierarchy.getIdBound(), 5);
+
+	auto path = hierarchy.shortestPath(myGraph.getId("0"), myGraph.getId("3"));
+	BOOST_CHECK_EQUAL(path.length, 4);
+	BOOST_CHECK(path.ids == (std::vector<size_t>{myGraph.getId("0"), myGraph.getId("2"),
+	                                             myGraph.getId("1"), myGraph.getId("3")}));
+	BOOST_CHECK_EQUAL(hierarchy.shortestPath(myGraph.getId("3"), myGraph.getId("1")).length, 5);
+	BOOST_CHECK(!hierarchy.shortestPath(myGraph.getId("0"), myGraph.getId("4")).found());
+	BOOST_CHECK(hierarchy.shortestPath(myGraph.getId("4"), myGraph.getId("4")).found());
+}
+
+BOOST_AUTO_TEST_CASE(contraction_hierarchy_random_graph) {
+	csr::WeightedGraph myGraph(randomWeightedGraph(300, {1, 3, 7, 61}));
+
+	ContractionHierarchy<int> hierarchy(myGraph);
+	checkQueries(myGraph, hierarchy);
+
+	// Giving up the witness searches early adds more shortcuts but keeps the paths.
+	ContractionHierarchy<int> hasty(myGraph, 4);
+	BOOST_CHECK_GE(hasty.getShortcutsCount(), hierarchy.getShortcutsCount());
+	checkQueries(myGraph, hasty);
+}
+
+BOOST_AUTO_TEST_CASE(contraction_hierarchy_tombstones) {
+	list::WeightedGraph myGraph = randomWeightedGraph(200, {1, 3, 7, 61});
+	myGraph.setRemovalMode(RemovalMode::Tombstone);
+	myGraph.removeNode(myGraph["3"]);
+	myGraph.removeNode(myGraph["150"]);
+
+	ContractionHierarchy<int> hierarchy(myGraph);
+	BOOST_CHECK_EQUAL(hierarchy.getRank(3), ContractionHierarchy<int>::noRank);
+	BOOST_CHECK_NE(hierarchy.getRank(4), ContractionHierarchy<int>::noRank);
+	checkQueries(myGraph, hierarchy);
+}
+
+BOOST_AUTO_TEST_CASE(contraction_hierarchy_save_load) {
+	csr::WeightedGraph myGraph(randomWeightedGraph(300, {1, 3, 7, 61}));
+	ContractionHierarchy<int> hierarchy(myGraph);
+
+	std::stringstream stream;
+	hierarchy.save(stream);
+	ContractionHierarchy<int> loaded = ContractionHierarchy<int>::load(stream);
+
+	BOOST_CHECK_EQUAL(loaded.getIdBound(), hierarchy.getIdBound());
+	BOOST_CHECK_EQUAL(loaded.getShortcutsCount(), hierarchy.getShortcutsCount());
+	for(size_t id = 0; id < hierarchy.getIdBound(); ++id) {
+		BOOST_REQUIRE_EQUAL(loaded.getRank(id), hierarchy.getRank(id));
+	}
+	checkQueries(myGraph, loaded);
+
+	std::stringstream truncated(stream.str().substr(0, stream.str().size() / 2));
+	BOOST_CHECK_THROW(ContractionHierarchy<int>::load(truncated), std::invalid_argument);
+	std::stringstream garbage("not a hierarchy");
+	BOOST_CHECK_THROW(ContractionHierarchy<int>::load(garbage), std::invalid_argument);
+	std::stringstream otherWeights(stream.str());
+	BOOST_CHECK_THROW(ContractionHierarchy<double>::load(otherWeights), std::invalid_argument);
+}
@@ -0,0 +1,265 @@
+#include "graph.hpp"
+#include "algorithms.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <set>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+using namespace graph;
+
+BOOST_AUTO_TEST_CASE(empty_csr_graph_creation) {
+	using Graph = csr::Graph<NoProperty, NoProperty>;
+
+	Graph myGraph;
+	BOOST_CHECK_EQUAL(myGraph.getVerticesCount(), 0);
+	BOOST_CHECK_EQUAL(myGraph.getEdgesCount(), 0);
+	BOOST_CHECK_EQUAL(myGraph.getOffsets().size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(csr_graph_from_list_graph) {
+	using Graph = csr::Graph<NoProperty, NoProperty>;
+
+	list::Graph<NoProperty, NoProperty> source{{"1", "3"}, {"1", "4"}, {"2", "7"}, {"8", "3"}};
+	const Graph myGraph(source);
+
+	BOOST_CHECK_EQUAL(myGraph.getVerticesCount(), 6);
+	BOOST_CHECK_EQUAL(myGraph.getEdgesCount(), 4);
+
+	std::vector<size_t> expectedOffsets{0, 2, 2, 2, 3, 3, 4},
+	        expectedTargets{1, 2, 4, 1};
+	BOOST_CHECK(myGraph.getOffsets() == expectedOffsets);
+	BOOST_CHECK(myGraph.getTargets() == expectedTargets);
+
+	for(auto const name : {"1", "2", "3", "4", "7", "8"}) {
+		BOOST_CHECK(myGraph.hasNode(name));
+		BOOST_CHECK_EQUAL(myGraph.getId(name), source.getId(name));
+	}
+	BOOST_CHECK(!myGraph.hasNode("5"));
+	BOOST_CHECK_THROW(myGraph.getId("5"), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(csr_graph_from_matrix_graph) {
+	using Graph = csr::Graph<NoProperty, WeightedProperty>;
+
+	matrix::Graph<NoProperty, WeightedProperty> source{{"6", "5", WeightedProperty{1}},
+	                                                   {"4", "3", WeightedProperty{2}},
+	                                                   {"2", "1", WeightedProperty{3}},
+	                                                   {"4", "2", WeightedProperty{4}}};
+	const Graph myGraph(source);
+
+	BOOST_CHECK_EQUAL(myGraph.getVerticesCount(), 6);
+	BOOST_CHECK_EQUAL(myGraph.getEdgesCount(), 4);
+
+	BOOST_CHECK(myGraph.hasEdge(myGraph["4"], myGraph["2"]));
+	BOOST_CHECK(!myGraph.hasEdge(myGraph["2"], myGraph["4"]));
+
+	BOOST_CHECK_EQUAL(myGraph.getEdgeProperty(myGraph["6"], myGraph["5"]).weight, 1);
+	BOOST_CHECK_EQUAL(myGraph.getEdgeProperty(myGraph["4"], myGraph["3"]).weight, 2);
+	BOOST_CHECK_EQUAL(myGraph.getEdgeProperty(myGraph["2"], myGraph["1"]).weight, 3);
+	BOOST_CHECK_EQUAL(myGraph.getEdgeProperty(myGraph["4"], myGraph["2"]).weight, 4);
+	BOOST_CHECK_THROW(myGraph.getEdgeProperty(myGraph["5"], myGraph["6"]), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(csr_graph_node_properties) {
+	using Graph = csr::Graph<AstarNodeProperty<void>, WeightedProperty>;
+
+	list::Graph<AstarNodeProperty<void>, WeightedProperty> source{{"1", "2"}};
+	source["2"].setProperty({4, 2});
+	const Graph myGraph(source);
+
+	BOOST_CHECK_EQUAL(myGraph["1"].getProperty().gScore, 0);
+	BOOST_CHECK_EQUAL(myGraph["2"].getProperty().gScore, 4);
+	BOOST_CHECK_EQUAL(myGraph["2"].getProperty().hScore, 2);
+}
+
+BOOST_AUTO_TEST_CASE(csr_graph_equal_to_operator) {
+	using Graph = csr::Graph<NoProperty, NoProperty>;
+	using Source = list::Graph<NoProperty, NoProperty>;
+
+	Graph myGraph(Source{{"6", "5"}, {"4", "3"}, {"2", "1"}}),
+	        sameGraph(Source{{"4", "3"}, {"6", "5"}, {"2", "1"}}),
+	        differentEdges(Source{{"4", "3"}, {"6", "1"}, {"2", "5"}}),
+	        differentNodeNames(Source{{"a", "b"}, {"c", "d"}, {"e", "f"}});
+
+	BOOST_CHECK(myGraph == sameGraph);
+	BOOST_CHECK(myGraph != differentEdges);
+	BOOST_CHECK(myGraph != differentNodeNames);
+}
+
+BOOST_AUTO_TEST_CASE(csr_graph_each_edges) {
+	using Graph     = csr::Graph<NoProperty, WeightedProperty>;
+	using ConstNode = Graph::ConstNode_t;
+
+	const Graph myGraph(list::Graph<NoProperty, WeightedProperty>{
+	        {"6", "5"}, {"4", "3"}, {"2", "1"}, {"6", "2"}});
+
+	std::string expected = "6->5, 6->2, 4->3, 2->1, ";
+	std::ostringstream result;
+
+	myGraph.eachEdges([&result](ConstNode begin, ConstNode end) {
+		result << begin.getName() << "->" << end.getName() << ", ";
+	});
+
+	BOOST_CHECK_EQUAL(result.str(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(csr_graph_each_adjacents) {
+	using Graph     = csr::Graph<NoProperty, WeightedProperty>;
+	using ConstNode = Graph::ConstNode_t;
+
+	const Graph myGraph(list::Graph<NoProperty, WeightedProperty>{
+	        {"6", "5"}, {"4", "3"}, {"2", "1"}, {"4", "2"}});
+
+	std::string expected = "4->3, 4->2, ";
+	std::ostringstream result;
+
+	myGraph.eachAdjacents(myGraph["4"],
+	                      [&result](ConstNode end) {
+		                      result << "4->" << end.getName() << ", ";
+		                  });
+
+	BOOST_CHECK_EQUAL(result.str(), expected);
+	BOOST_CHECK(myGraph["4"].isConnectedTo(myGraph["2"]));
+	BOOST_CHECK(!myGraph["2"].isConnectedTo(myGraph["4"]));
+}
+
+BOOST_AUTO_TEST_CASE(csr_graph_ranges) {
+	using Graph = csr::Graph<NoProperty, WeightedProperty>;
+
+	const Graph myGraph(list::Graph<NoProperty, WeightedProperty>{
+	        {"6", "5"}, {"4", "3"}, {"2", "1"}, {"6", "2"}});
+
+	std::ostringstream vertices;
+	for(auto node : myGraph.vertices()) {
+		vertices << node.getName();
+	}
+	BOOST_CHECK_EQUAL(vertices.str(), "654321");
+
+	std::ostringstream edges;
+	for(auto [begin, end] : myGraph.edges()) {
+		edges << begin.getName() << "->" << end.getName() << ", ";
+	}
+	BOOST_CHECK_EQUAL(edges.str(), "6->5, 6->2, 4->3, 2->1, ");
+
+	auto adjacents = myGraph.adjacents(myGraph.getId("6"));
+	auto found     = std::find_if(adjacents.begin(), adjacents.end(), [](auto node) {
+		return node.getName() == "2";
+	});
+	BOOST_CHECK(found != adjacents.end());
+	BOOST_CHECK_EQUAL((*found).getId(), myGraph.getId("2"));
+	BOOST_CHECK(myGraph.adjacents(myGraph.getId("5")).empty());
+}
+
+BOOST_AUTO_TEST_CASE(csr_graph_reverse_index) {
+	using Graph   = csr::Graph<NoProperty, NoProperty>;
+	using NodeRef = Graph::NodeRef_t;
+
+	Graph myGraph(list::Graph<NoProperty, NoProperty>{
+	        {"0", "1"}, {"2", "1"}, {"1", "1"}, {"3", "0"}, {"2", "3"}});
+
+	auto predecessorsOf = [&myGraph](std::string const& name) {
+		std::set<std::string> result;
+		myGraph.eachPredecessors(myGraph[name], [&result](NodeRef begin) {
+			result.insert(begin.getName());
+		});
+		return result;
+	};
+
+	BOOST_CHECK(predecessorsOf("1") == (std::set<std::string>{"0", "1", "2"}));
+	BOOST_CHECK_THROW(myGraph.predecessors(myGraph.getId("1")), std::logic_error);
+
+	myGraph.setReverseIndex(true);
+	BOOST_CHECK(myGraph.hasReverseIndex());
+	BOOST_CHECK(predecessorsOf("1") == (std::set<std::string>{"0", "1", "2"}));
+	BOOST_CHECK(predecessorsOf("0") == (std::set<std::string>{"3"}));
+	BOOST_CHECK(predecessorsOf("2").empty());
+
+	std::set<std::string> names;
+	for(auto predecessor : myGraph.predecessors(myGraph.getId("1"))) {
+		names.insert(predecessor.getName());
+	}
+	BOOST_CHECK(names == (std::set<std::string>{"0", "1", "2"}));
+}
+
+BOOST_AUTO_TEST_CASE(csr_graph_each_adjacent_edges) {
+	using Graph   = csr::Graph<NoProperty, WeightedProperty>;
+	using NodeRef = Graph::NodeRef_t;
+
+	Graph myGraph(list::Graph<NoProperty, WeightedProperty>{
+	        {"0", "1", {3}}, {"0", "2", {5}}, {"2", "0", {1}}, {"0", "0", {7}}});
+
+	std::map<std::string, int> weights;
+	myGraph.eachAdjacentEdges(myGraph["0"], [&weights](NodeRef end, WeightedProperty const& p) {
+		weights[end.getName()] = p.weight;
+	});
+
+	BOOST_CHECK(weights == (std::map<std::string, int>{{"1", 3}, {"2", 5}, {"0", 7}}));
+}
+
+BOOST_AUTO_TEST_CASE(csr_graph_parallel_edges) {
+	using Graph   = csr::Graph<NoProperty, WeightedProperty>;
+	using NodeRef = Graph::NodeRef_t;
+
+	// Each parallel edge keeps its own property.
+	Graph myGraph(list::Graph<NoProperty, WeightedProperty>{
+	        {"a", "b", {10}}, {"a", "c", {4}}, {"a", "b", {1}}, {"c", "b", {2}}});
+
+	std::vector<int> weights;
+	myGraph.eachAdjacentEdges(myGraph["a"], [&weights](NodeRef, WeightedProperty const& p) {
+		weights.push_back(p.weight);
+	});
+	BOOST_CHECK(weights == (std::vector<int>{10, 4, 1}));
+	BOOST_CHECK_EQUAL(myGraph.getEdgeProperty(myGraph["c"], myGraph["b"]).weight, 2);
+
+	for(bool reverseIndexed : {false, true}) {
+		myGraph.setReverseIndex(reverseIndexed);
+		std::multiset<std::pair<std::string, int>> edges;
+		myGraph.eachPredecessorEdges(myGraph["b"], [&edges](NodeRef begin,
+		                                                    WeightedProperty const& p) {
+			edges.emplace(begin.getName(), p.weight);
+		});
+		BOOST_CHECK(edges == (std::multiset<std::pair<std::string, int>>{
+		                             {"a", 10}, {"a", 1}, {"c", 2}}));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(csr_graph_symmetric) {
+	using Graph = csr::Graph<NoProperty, WeightedProperty>;
+	using Source = list::Graph<NoProperty, WeightedProperty>;
+
+	const Graph myGraph(Source{{"1", "2", {3}}, {"3", "4", {5}}, {"1", "4", {7}}}),
+	        expected(Source{{"2", "1", {3}}, {"4", "3", {5}}, {"4", "1", {7}}});
+
+	BOOST_CHECK(graph::symmetric(myGraph) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(csr_graph_strongly_connected_component) {
+	using Graph     = csr::Graph<NoProperty, NoProperty>;
+	using ConstNode = Graph::ConstNode_t;
+
+	const Graph myGraph(list::Graph<NoProperty, NoProperty>{{"0", "1"},
+	                                                        {"0", "5"},
+	                                                        {"1", "2"},
+	                                                        {"2", "5"},
+	                                                        {"3", "1"},
+	                                                        {"3", "2"},
+	                                                        {"4", "2"},
+	                                                        {"5", "1"},
+	                                                        {"5", "3"},
+	                                                        {"5", "4"}});
+	std::set<ConstNode> expectedFor0{myGraph["0"]},
+	        expectedForOthers{myGraph["1"], myGraph["2"], myGraph["3"], myGraph["4"], myGraph["5"]};
+
+	BOOST_CHECK(graph::stronglyConnectedComponent(myGraph, myGraph["0"]) == expectedFor0);
+	BOOST_CHECK(graph::stronglyConnectedComponent(myGraph, myGraph["1"]) == expectedForOthers);
+	BOOST_CHECK(graph::connectedComponent(myGraph, myGraph["3"]).size() == 6);
+}
@@ -0,0 +1,208 @@
+#include "graph.hpp"
+#include "flow_network.hpp"
+#include "random_graphs.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+using namespace graph;
+
+namespace {
+	// The value of a maximum flow found by the Edmonds-Karp algorithm on a matrix of
+	// capacities.
+	template <typename Graph>
+	int edmondsKarp(Graph const& g, size_t sourceId, size_t sinkId) {
+		size_t idBound = g.getIdBound();
+		std::vector<std::vector<int>> residuals(idBound, std::vector<int>(idBound, 0));
+		for(auto vertex : g.vertices()) {
+			g.eachAdjacentEdges(vertex, [&](auto end, auto const& property) {
+				residuals[vertex.getId()][end.getId()] += property.weight;
+			});
+		}
+
+		int value = 0;
+		while(true) {
+			std::vector<size_t> parents(idBound, idBound), queue{sourceId};
+			parents[sourceId] = sourceId;
+			for(size_t i = 0; i < queue.size() && parents[sinkId] == idBound; ++i) {
+				for(size_t id = 0; id < idBound; ++id) {
+					if(parents[id] == idBound && residuals[queue[i]][id] > 0) {
+						parents[id] = queue[i];
+						queue.push_back(id);
+					}
+				}
+			}
+			if(parents[sinkId] == idBound) {
+				return value;
+			}
+
+			int amount = residuals[parents[sinkId]][sinkId];
+			for(size_t id = sinkId; id != sourceId; id = parents[id]) {
+				amount = std::min(amount, residuals[parents[id]][id]);
+			}
+			for(size_t id = sinkId; id != sourceId; id = parents[id]) {
+				residuals[parents[id]][id] -= amount;
+				residuals[id][parents[id]] += amount;
+			}
+			value += amount;
+		}
+	}
+
+	// Check that the flows respect the capacities and are conserved, and that the edges from the
+	// source side of the cut to the other side are saturated and have the capacity of the flow.
+	template <typename Graph>
+	void checkFlow(Graph const& g,
+	               size_t sourceId,
+	               size_t sinkId,
+	               int value,
+	               std::vector<int> const& flows,
+	               std::vector<bool> const& sourceSide) {
+		BOOST_REQUIRE_EQUAL(flows.size(), g.getEdgesCount());
+		BOOST_REQUIRE(sourceSide[sourceId]);
+		BOOST_REQUIRE(!sourceSide[sinkId]);
+
+		// The edges are taken in the order of edges(), each one with its own capacity.
+		std::vector<int> balances(g.getIdBound(), 0);
+		int cutCapacity  = 0;
+		size_t edgeIndex = 0;
+		for(auto vertex : g.vertices()) {
+			size_t beginId = vertex.getId();
+			g.eachAdjacentEdges(vertex, [&](auto end, auto const& property) {
+				size_t endId = end.getId();
+				int flow     = flows[edgeIndex++];
+				int capacity = property.weight;
+				BOOST_REQUIRE_GE(flow, 0);
+				BOOST_REQUIRE_LE(flow, capacity);
+				if(beginId == endId) {
+					BOOST_REQUIRE_EQUAL(flow, 0);
+					return;
+				}
+				balances[beginId] -= flow;
+				balances[endId] += flow;
+
+				if(sourceSide[beginId] && !sourceSide[endId]) {
+					BOOST_REQUIRE_EQUAL(flow, capacity);
+					cutCapacity += capacity;
+				} else if(!sourceSide[beginId] && sourceSide[endId]) {
+					BOOST_REQUIRE_EQUAL(flow, 0);
+				}
+			});
+		}
+		BOOST_REQUIRE_EQUAL(edgeIndex, flows.size());
+
+		for(auto vertex : g.vertices()) {
+			size_t id = vertex.getId();
+			if(id == sourceId) {
+				BOOST_REQUIRE_EQUAL(balances[id], -value);
+			} else if(id == sinkId) {
+				BOOST_REQUIRE_EQUAL(balances[id], value);
+			} else {
+				BOOST_REQUIRE_EQUAL(balances[id], 0);
+			}
+		}
+		BOOST_REQUIRE_EQUAL(cutCapacity, value);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(flow_network_classic) {
+	list::WeightedGraph myGraph{{"s", "v1", {16}},
+	                            {"s", "v2", {13}},
+	                            {"v1", "v3", {12}},
+	                            {"v2", "v1", {4}},
+	                            {"v2", "v4", {14}},
+	                            {"v3", "v2", {9}},
+	                            {"v3", "t", {20}},
+	                            {"v4", "v3", {7}},
+	                            {"v4", "t", {4}}};
+	size_t sourceId = myGraph.getId("s"), sinkId = myGraph.getId("t");
+
+	auto flow = graph::maximumFlow(myGraph, sourceId, sinkId);
+	BOOST_CHECK_EQUAL(flow.value, 23);
+	checkFlow(myGraph, sourceId, sinkId, flow.value, flow.flows, flow.sourceSide);
+
+	// The cut is made of v1 -> v3, v4 -> v3 and v4 -> t.
+	for(std::string name : {"s", "v1", "v2", "v4"}) {
+		BOOST_CHECK(flow.sourceSide[myGraph.getId(name)]);
+	}
+	BOOST_CHECK(!flow.sourceSide[myGraph.getId("v3")]);
+	BOOST_CHECK(!flow.sourceSide[myGraph.getId("t")]);
+
+	// The flow goes back from the sink to the source the same way.
+	auto reversed = graph::maximumFlow(myGraph, sinkId, sourceId);
+	BOOST_CHECK_EQUAL(reversed.value, 0);
+	BOOST_CHECK(std::all_of(
+	        reversed.flows.begin(), reversed.flows.end(), [](int flow) { return flow == 0; }));
+	BOOST_CHECK(reversed.sourceSide[sinkId]);
+	BOOST_CHECK(!reversed.sourceSide[sourceId]);
+
+	BOOST_CHECK_THROW(graph::maximumFlow(myGraph, sourceId, sourceId), std::invalid_argument);
+
+	// Each parallel edge carries up to its own capacity.
+	list::WeightedGraph parallel{{"s", "a", {10}}, {"a", "t", {1}}, {"a", "t", {4}}};
+	auto parallelFlow = graph::maximumFlow(parallel, parallel.getId("s"), parallel.getId("t"));
+	BOOST_CHECK_EQUAL(parallelFlow.value, 5);
+	BOOST_CHECK(parallelFlow.flows == (std::vector<int>{5, 1, 4}));
+	checkFlow(parallel, parallel.getId("s"), parallel.getId("t"), parallelFlow.value,
+	          parallelFlow.flows, parallelFlow.sourceSide);
+}
+
+BOOST_AUTO_TEST_CASE(flow_network_random) {
+	// Parallel edges, self-loops, edges in both directions and edges without capacity.
+	list::WeightedGraph myList = randomWeightedGraph(120, {1, 3, 7, 7, 61}, true);
+	csr::WeightedGraph myCsr(myList);
+	FlowNetwork<int> listNetwork(myList), csrNetwork(myCsr);
+	BOOST_CHECK_EQUAL(listNetwork.getIdBound(), 120);
+	BOOST_CHECK_EQUAL(listNetwork.getEdgesCount(), myList.getEdgesCount());
+
+	// The same network is searched again for each pair.
+	size_t positiveFlows = 0;
+	for(size_t sourceId = 0; sourceId < 120; sourceId += 13) {
+		for(size_t sinkId = 5; sinkId < 120; sinkId += 29) {
+			if(sourceId == sinkId) {
+				continue;
+			}
+			int expected = edmondsKarp(myList, sourceId, sinkId);
+			positiveFlows += expected > 0 ? 1 : 0;
+
+			BOOST_REQUIRE_EQUAL(listNetwork.maximumFlow(sourceId, sinkId), expected);
+			BOOST_REQUIRE_EQUAL(listNetwork.getFlowValue(), expected);
+			checkFlow(myList, sourceId, sinkId, expected, listNetwork.getFlows(),
+			          listNetwork.getSourceSide());
+
+			BOOST_REQUIRE_EQUAL(csrNetwork.maximumFlow(sourceId, sinkId), expected);
+			checkFlow(myCsr, sourceId, sinkId, expected, csrNetwork.getFlows(),
+			          csrNetwork.getSourceSide());
+		}
+	}
+	BOOST_CHECK_GT(positiveFlows, 20);
+}
+
+BOOST_AUTO_TEST_CASE(flow_network_matrix) {
+	// Two paths of capacity 3 and 2, and a path of capacity 1 shared with the first one.
+	matrix::WeightedGraph myGraph{{"s", "a", {3}},
+	                              {"a", "t", {4}},
+	                              {"s", "b", {2}},
+	                              {"b", "t", {2}},
+	                              {"b", "a", {1}},
+	                              {"c", "t", {5}}};
+	size_t sourceId = myGraph.getId("s"), sinkId = myGraph.getId("t");
+
+	FlowNetwork<int> network(myGraph);
+	BOOST_CHECK_EQUAL(network.maximumFlow(sourceId, sinkId), 5);
+	checkFlow(myGraph, sourceId, sinkId, 5, network.getFlows(), network.getSourceSide());
+	BOOST_CHECK(network.isOnSourceSide(sourceId));
+	BOOST_CHECK(!network.isOnSourceSide(myGraph.getId("a")));
+	BOOST_CHECK(!network.isOnSourceSide(myGraph.getId("c")));
+
+	// c cannot be reached, so nothing goes through its edge.
+	BOOST_CHECK_EQUAL(network.maximumFlow(sourceId, myGraph.getId("c")), 0);
+	BOOST_CHECK_EQUAL(network.maximumFlow(myGraph.getId("c"), sinkId), 5);
+	BOOST_CHECK_EQUAL(network.maximumFlow(myGraph.getId("b"), sinkId), 3);
+}
@@ -0,0 +1,87 @@
+#include "indexed_heap.hpp"
+
+#include <functional>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+using namespace graph;
+
+BOOST_AUTO_TEST_CASE(indexed_heap_push_pop) {
+	IndexedHeap<int> heap(10);
+
+	BOOST_CHECK(heap.empty());
+	for(size_t id : {3, 7, 1, 9, 0, 4}) {
+		heap.push(id, static_cast<int>(id * 7 % 10));
+	}
+
+	BOOST_CHECK_EQUAL(heap.size(), 6);
+	BOOST_CHECK(heap.contains(9));
+	BOOST_CHECK(!heap.contains(2));
+	BOOST_CHECK_EQUAL(heap.getKey(9), 3);
+
+	std::vector<size_t> order;
+	while(!heap.empty()) {
+		order.push_back(heap.pop());
+	}
+	BOOST_CHECK(order == (std::vector<size_t>{0, 3, 9, 1, 4, 7}));
+	BOOST_CHECK(!heap.contains(0));
+}
+
+BOOST_AUTO_TEST_CASE(indexed_heap_decrease) {
+	IndexedHeap<int, 2> heap(6);
+	for(size_t id = 0; id < 6; ++id) {
+		heap.push(id, 10 + static_cast<int>(id));
+	}
+
+	heap.decrease(5, 1);
+	BOOST_CHECK_EQUAL(heap.top(), 5);
+	BOOST_CHECK_EQUAL(heap.topKey(), 1);
+
+	BOOST_CHECK(!heap.pushOrDecrease(4, 20));
+	BOOST_CHECK(heap.pushOrDecrease(4, 0));
+	BOOST_CHECK_EQUAL(heap.pop(), 4);
+	BOOST_CHECK_EQUAL(heap.pop(), 5);
+	BOOST_CHECK_EQUAL(heap.pop(), 0);
+
+	// Equal keys are all kept.
+	BOOST_CHECK(heap.pushOrDecrease(4, 11));
+	heap.decrease(3, 11);
+	BOOST_CHECK_EQUAL(heap.size(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(indexed_heap_update) {
+	IndexedHeap<int, 3> heap(8);
+	for(size_t id = 0; id < 8; ++id) {
+		heap.push(id, static_cast<int>(id));
+	}
+
+	heap.update(0, 100);
+	heap.update(6, -1);
+	heap.update(3, 3);
+	BOOST_CHECK_EQUAL(heap.getKey(0), 100);
+
+	std::vector<size_t> order;
+	while(!heap.empty()) {
+		order.push_back(heap.pop());
+	}
+	BOOST_CHECK(order == (std::vector<size_t>{6, 1, 2, 3, 4, 5, 7, 0}));
+}
+
+BOOST_AUTO_TEST_CASE(indexed_heap_reuse) {
+	IndexedHeap<int, 4, std::greater<int>> heap(4);
+	heap.push(1, 5);
+	heap.push(2, 8);
+
+	heap.reset(8);
+	BOOST_CHECK(heap.empty());
+	BOOST_CHECK(!heap.contains(1));
+
+	heap.push(7, 2);
+	heap.push(1, 3);
+	BOOST_CHECK_EQUAL(heap.pop(), 1);
+	BOOST_CHECK_EQUAL(heap.pop(), 7);
+}
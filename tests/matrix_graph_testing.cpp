@@ -1,9 +1,14 @@
 #include "graph.hpp"
 #include "algorithms.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <map>
 #include <set>
 #include <sstream>
 #include <tuple>
+#include <type_traits>
+#include <unordered_set>
 #include <vector>
 
 #define BOOST_TEST_DYN_LINK
@@ -231,7 +236,7 @@ BOOST_AUTO_TEST_CASE(matrix_graph_remove_node) {
 	BOOST_CHECK(!myGraph.hasNode("6"));
 
 	std::ostringstream result;
-	std::string expected = "2->1, 4->3, ";
+	std::string expected = "4->3, 2->1, ";
 	myGraph.eachEdges([&result](ConstNode begin, ConstNode end) {
 		result << begin.getName() << "->" << end.getName() << ", ";
 	});
@@ -239,6 +244,114 @@ BOOST_AUTO_TEST_CASE(matrix_graph_remove_node) {
 	BOOST_CHECK_EQUAL(result.str(), expected);
 }
 
+BOOST_AUTO_TEST_CASE(matrix_graph_remove_node_edge_properties) {
+	using Graph = matrix::Graph<NoProperty, WeightedProperty>;
+
+	Graph myGraph{{"1", "2", {1}}, {"2", "3", {2}}, {"3", "1", {3}}, {"3", "4", {4}}};
+
+	myGraph.removeNode(myGraph["2"]);
+	BOOST_CHECK_EQUAL(myGraph.getEdgesCount(), 2);
+
+	Graph expected{{"3", "1", {3}}, {"3", "4", {4}}};
+	BOOST_CHECK(myGraph == expected);
+}
+
+BOOST_AUTO_TEST_CASE(matrix_graph_many_nodes) {
+	using Graph = matrix::Graph<NoProperty, NoProperty>;
+
+	Graph myGraph;
+	for(size_t i = 0; i < 300; ++i) {
+		myGraph.addEdges({std::to_string(i), std::to_string((i * 7) % 300)});
+	}
+
+	BOOST_CHECK_EQUAL(myGraph.getVerticesCount(), 300);
+	BOOST_CHECK_EQUAL(myGraph.getEdgesCount(), 300);
+	BOOST_CHECK(myGraph.hasEdge(myGraph["150"], myGraph["150"]));
+	BOOST_CHECK(myGraph.hasEdge(myGraph["299"], myGraph["293"]));
+
+	myGraph.removeNode(myGraph["64"]);
+	BOOST_CHECK_EQUAL(myGraph.getVerticesCount(), 299);
+	BOOST_CHECK_EQUAL(myGraph.getEdgesCount(), 298);
+	BOOST_CHECK(myGraph.hasEdge(myGraph["299"], myGraph["293"]));
+	BOOST_CHECK(myGraph.hasEdge(myGraph["65"], myGraph["155"]));
+	BOOST_CHECK(!myGraph.hasEdge(myGraph["65"], myGraph["154"]));
+}
+
+BOOST_AUTO_TEST_CASE(matrix_graph_tombstone_removal) {
+	using Graph     = matrix::Graph<NoProperty, WeightedProperty>;
+	using ConstNode = Graph::ConstNode_t;
+
+	Graph myGraph{{"1", "2", {12}}, {"2", "3", {23}}, {"3", "1", {31}}, {"3", "4", {34}}};
+	myGraph.setRemovalMode(RemovalMode::Tombstone);
+
+	size_t thirdId = myGraph.getId("3"), fourthId = myGraph.getId("4");
+	myGraph.removeNode(myGraph["2"]);
+
+	BOOST_CHECK_EQUAL(myGraph.getVerticesCount(), 3);
+	BOOST_CHECK_EQUAL(myGraph.getIdBound(), 4);
+	BOOST_CHECK_EQUAL(myGraph.getEdgesCount(), 2);
+	BOOST_CHECK_EQUAL(myGraph.getId("3"), thirdId);
+	BOOST_CHECK_EQUAL(myGraph.getId("4"), fourthId);
+	BOOST_CHECK(!myGraph.hasNode("2"));
+	BOOST_CHECK_EQUAL(myGraph.getEdgeProperty(myGraph["3"], myGraph["4"]).weight, 34);
+
+	std::set<std::string> vertices;
+	myGraph.eachVertices([&vertices](ConstNode node) { vertices.insert(node.getName()); });
+	BOOST_CHECK((vertices == std::set<std::string>{"1", "3", "4"}));
+
+	size_t edgesCount = 0;
+	myGraph.eachEdges([&edgesCount](ConstNode begin, ConstNode end) {
+		BOOST_CHECK(begin.getName() != "2" && end.getName() != "2");
+		++edgesCount;
+	});
+	BOOST_CHECK_EQUAL(edgesCount, 2);
+
+	myGraph.compact();
+	BOOST_CHECK_EQUAL(myGraph.getIdBound(), 3);
+	BOOST_CHECK_EQUAL(myGraph.getEdgesCount(), 2);
+	BOOST_CHECK_EQUAL(myGraph.getEdgeProperty(myGraph["3"], myGraph["1"]).weight, 31);
+	BOOST_CHECK((myGraph == Graph{{"3", "1", {31}}, {"3", "4", {34}}}));
+}
+
+BOOST_AUTO_TEST_CASE(matrix_graph_tombstone_id_reuse) {
+	using Graph = matrix::Graph<NoProperty, WeightedProperty>;
+
+	Graph myGraph;
+	myGraph.setRemovalMode(RemovalMode::Tombstone);
+	for(size_t i = 0; i < 64; ++i) {
+		myGraph.addEdges({std::to_string(i), std::to_string((i + 1) % 64), {static_cast<int>(i)}});
+	}
+
+	for(size_t i = 0; i < 64; i += 2) {
+		myGraph.removeNode(myGraph[std::to_string(i)]);
+	}
+	BOOST_CHECK_EQUAL(myGraph.getVerticesCount(), 32);
+	BOOST_CHECK_EQUAL(myGraph.getEdgesCount(), 0);
+
+	// Removed ids are reused, and new nodes do not inherit the edges of the removed ones.
+	for(size_t i = 0; i < 32; ++i) {
+		myGraph.addNode("new" + std::to_string(i));
+	}
+	BOOST_CHECK_EQUAL(myGraph.getVerticesCount(), 64);
+	BOOST_CHECK_LE(myGraph.getIdBound(), 64 + 8);
+	BOOST_CHECK_EQUAL(myGraph.getEdgesCount(), 0);
+
+	myGraph.connect(myGraph["new0"], myGraph["1"], {42});
+	BOOST_CHECK_EQUAL(myGraph.getEdgesCount(), 1);
+	BOOST_CHECK_EQUAL(myGraph.getEdgeProperty(myGraph["new0"], myGraph["1"]).weight, 42);
+
+	// Renumbering removals still work after tombstones.
+	myGraph.setRemovalMode(RemovalMode::Renumber);
+	myGraph.removeNode(myGraph["new1"]);
+	BOOST_CHECK_EQUAL(myGraph.getVerticesCount(), 63);
+	BOOST_CHECK_EQUAL(myGraph.getIdBound(), 63);
+	BOOST_CHECK_EQUAL(myGraph.getEdgeProperty(myGraph["new0"], myGraph["1"]).weight, 42);
+
+	csr::Graph<NoProperty, WeightedProperty> csrGraph(myGraph);
+	BOOST_CHECK_EQUAL(csrGraph.getVerticesCount(), 63);
+	BOOST_CHECK_EQUAL(csrGraph.getEdgeProperty(csrGraph["new0"], csrGraph["1"]).weight, 42);
+}
+
 BOOST_AUTO_TEST_CASE(matrix_graph_has_edge) {
 	using Graph = matrix::Graph<NoProperty, WeightedProperty>;
 
@@ -319,13 +432,30 @@ BOOST_AUTO_TEST_CASE(matrix_graph_set_edge_property) {
 	BOOST_CHECK_EQUAL(myGraph.getEdgeProperty(myGraph["6"], myGraph["5"]).weight, 1337);
 }
 
+BOOST_AUTO_TEST_CASE(matrix_graph_get_edge_property_by_id) {
+	using Graph = matrix::Graph<NoProperty, WeightedProperty>;
+
+	Graph myGraph{{"6", "5", {1}}, {"4", "3", {2}}, {"2", "1", {3}}};
+
+	BOOST_CHECK_EQUAL(myGraph.getEdgeProperty(myGraph.getId("4"), myGraph.getId("3")).weight, 2);
+	BOOST_CHECK_THROW(myGraph.getEdgeProperty(myGraph.getId("3"), myGraph.getId("4")),
+	                  std::out_of_range);
+
+	myGraph.removeNode(myGraph["6"]);
+	BOOST_CHECK_EQUAL(myGraph.getEdgeProperty(myGraph.getId("2"), myGraph.getId("1")).weight, 3);
+	BOOST_CHECK_EQUAL(myGraph.getEdgeProperty(myGraph["4"], myGraph["3"]).weight, 2);
+
+	myGraph.connect(myGraph["6"], myGraph["5"]);
+	BOOST_CHECK_EQUAL(myGraph.getEdgeProperty(myGraph["6"], myGraph["5"]).weight, 0);
+}
+
 BOOST_AUTO_TEST_CASE(matrix_graph_each_vertices) {
 	using Graph     = matrix::Graph<NoProperty, WeightedProperty>;
 	using ConstNode = matrix::Graph<NoProperty, WeightedProperty>::ConstNode_t;
 
 	Graph myGraph{{"6", "5"}, {"4", "3"}, {"2", "1"}};
 
-	std::string expected = "123456";
+	std::string expected = "654321";
 	std::ostringstream result;
 
 	myGraph.eachVertices([&result](ConstNode node) { result << node.getName(); });
@@ -339,7 +469,7 @@ BOOST_AUTO_TEST_CASE(matrix_graph_each_edges) {
 
 	Graph myGraph{{"6", "5"}, {"4", "3"}, {"2", "1"}};
 
-	std::string expected = "2->1, 4->3, 6->5, ";
+	std::string expected = "6->5, 4->3, 2->1, ";
 	std::ostringstream result;
 
 	myGraph.eachEdges([&result](ConstNode begin, ConstNode end) {
@@ -355,7 +485,7 @@ BOOST_AUTO_TEST_CASE(matrix_graph_each_adjacents) {
 
 	Graph myGraph{{"6", "5"}, {"4", "3"}, {"2", "1"}, {"4", "2"}};
 
-	std::string expected = "4->2, 4->3, ";
+	std::string expected = "4->3, 4->2, ";
 	std::ostringstream result;
 
 	myGraph.eachAdjacents(myGraph["4"],
@@ -366,6 +496,149 @@ BOOST_AUTO_TEST_CASE(matrix_graph_each_adjacents) {
 	BOOST_CHECK_EQUAL(result.str(), expected);
 }
 
+BOOST_AUTO_TEST_CASE(matrix_graph_each_adjacents_node_ref) {
+	using Graph   = matrix::Graph<NoProperty, WeightedProperty>;
+	using NodeRef = Graph::NodeRef_t;
+
+	static_assert(std::is_trivially_copyable<NodeRef>::value,
+	              "A NodeRef must be trivially copyable");
+
+	Graph myGraph{{"6", "5"}, {"4", "3"}, {"2", "1"}, {"4", "2"}};
+
+	std::unordered_set<NodeRef> adjacents;
+	myGraph.eachAdjacents(myGraph["4"], [&adjacents](NodeRef end) { adjacents.insert(end); });
+
+	BOOST_CHECK_EQUAL(adjacents.size(), 2);
+	BOOST_CHECK(adjacents.count(NodeRef(myGraph, myGraph.getId("3"))));
+	BOOST_CHECK(adjacents.count(NodeRef(myGraph, myGraph.getId("2"))));
+	BOOST_CHECK(!adjacents.count(NodeRef(myGraph, myGraph.getId("5"))));
+
+	for(NodeRef node : adjacents) {
+		Graph::ConstNode_t constNode = node;
+		BOOST_CHECK_EQUAL(constNode.getId(), node.getId());
+		BOOST_CHECK_EQUAL(constNode.getName(), node.getName());
+	}
+}
+
+BOOST_AUTO_TEST_CASE(matrix_graph_ranges) {
+	using Graph = matrix::Graph<NoProperty, WeightedProperty>;
+
+	const Graph myGraph{{"6", "5"}, {"4", "3"}, {"2", "1"}, {"6", "2"}};
+
+	std::ostringstream vertices;
+	for(auto node : myGraph.vertices()) {
+		vertices << node.getName();
+	}
+	BOOST_CHECK_EQUAL(vertices.str(), "654321");
+
+	std::ostringstream edges;
+	for(auto [begin, end] : myGraph.edges()) {
+		edges << begin.getName() << "->" << end.getName() << ", ";
+	}
+	BOOST_CHECK_EQUAL(edges.str(), "6->5, 6->2, 4->3, 2->1, ");
+
+	auto adjacents = myGraph.adjacents(myGraph.getId("6"));
+	auto found     = std::find_if(adjacents.begin(), adjacents.end(), [](auto node) {
+		return node.getName() == "2";
+	});
+	BOOST_CHECK(found != adjacents.end());
+	BOOST_CHECK_EQUAL((*found).getId(), myGraph.getId("2"));
+	BOOST_CHECK(myGraph.adjacents(myGraph.getId("5")).empty());
+
+	Graph removed{{"6", "5"}, {"4", "3"}, {"2", "1"}, {"6", "2"}};
+	removed.setRemovalMode(RemovalMode::Tombstone);
+	removed.removeNode(removed["2"]);
+
+	BOOST_CHECK_EQUAL(std::distance(removed.vertices().begin(), removed.vertices().end()), 5);
+	BOOST_CHECK_EQUAL(std::distance(removed.edges().begin(), removed.edges().end()), 2);
+	BOOST_CHECK_EQUAL(std::distance(removed.adjacents(removed.getId("6")).begin(),
+	                                removed.adjacents(removed.getId("6")).end()),
+	                  1);
+}
+
+BOOST_AUTO_TEST_CASE(matrix_graph_reverse_index) {
+	using Graph   = matrix::Graph<NoProperty, NoProperty>;
+	using NodeRef = Graph::NodeRef_t;
+
+	Graph myGraph{{"0", "1"}, {"2", "1"}, {"1", "1"}, {"3", "0"}, {"2", "3"}};
+	myGraph.setReverseIndex(true);
+	BOOST_CHECK(myGraph.hasReverseIndex());
+
+	auto predecessorsOf = [&myGraph](std::string const& name) {
+		std::set<std::string> result;
+		myGraph.eachPredecessors(myGraph[name], [&result](NodeRef begin) {
+			result.insert(begin.getName());
+		});
+		return result;
+	};
+
+	BOOST_CHECK(predecessorsOf("1") == (std::set<std::string>{"0", "1", "2"}));
+	BOOST_CHECK(predecessorsOf("2").empty());
+
+	myGraph.addEdges({"4", "2"});
+	myGraph.connect(myGraph["1"], myGraph["2"]);
+	myGraph.removeEdge(myGraph["2"], myGraph["1"]);
+	BOOST_CHECK(predecessorsOf("1") == (std::set<std::string>{"0", "1"}));
+	BOOST_CHECK(predecessorsOf("2") == (std::set<std::string>{"1", "4"}));
+
+	myGraph.removeNode(myGraph["0"]);
+	BOOST_CHECK(predecessorsOf("1") == (std::set<std::string>{"1"}));
+	BOOST_CHECK(predecessorsOf("3") == (std::set<std::string>{"2"}));
+
+	myGraph.setRemovalMode(RemovalMode::Tombstone);
+	myGraph.removeNode(myGraph["3"]);
+	myGraph.addEdges({"5", "4"});
+	BOOST_CHECK(predecessorsOf("4") == (std::set<std::string>{"5"}));
+	BOOST_CHECK(predecessorsOf("2") == (std::set<std::string>{"1", "4"}));
+
+	myGraph.compact();
+	BOOST_CHECK(predecessorsOf("2") == (std::set<std::string>{"1", "4"}));
+
+	std::set<std::string> names;
+	for(auto predecessor : myGraph.predecessors(myGraph.getId("2"))) {
+		names.insert(predecessor.getName());
+	}
+	BOOST_CHECK(names == (std::set<std::string>{"1", "4"}));
+
+	// Without the index, the predecessors are found by scanning the graph.
+	myGraph.setReverseIndex(false);
+	BOOST_CHECK(!myGraph.hasReverseIndex());
+	BOOST_CHECK(predecessorsOf("2") == (std::set<std::string>{"1", "4"}));
+	BOOST_CHECK(predecessorsOf("1") == (std::set<std::string>{"1"}));
+	BOOST_CHECK_THROW(myGraph.predecessors(myGraph.getId("2")), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(matrix_graph_each_adjacent_edges) {
+	using Graph   = matrix::Graph<NoProperty, WeightedProperty>;
+	using NodeRef = Graph::NodeRef_t;
+
+	Graph myGraph{{"0", "1", {3}}, {"0", "2", {5}}, {"2", "0", {1}}, {"0", "0", {7}}};
+
+	std::map<std::string, int> weights;
+	myGraph.eachAdjacentEdges(myGraph["0"], [&weights](NodeRef end, WeightedProperty const& p) {
+		weights[end.getName()] = p.weight;
+	});
+
+	BOOST_CHECK(weights == (std::map<std::string, int>{{"1", 3}, {"2", 5}, {"0", 7}}));
+}
+
+BOOST_AUTO_TEST_CASE(matrix_graph_each_predecessor_edges) {
+	using Graph   = matrix::Graph<NoProperty, WeightedProperty>;
+	using NodeRef = Graph::NodeRef_t;
+
+	Graph myGraph{{"0", "1", {3}}, {"2", "1", {5}}, {"1", "1", {7}}, {"1", "2", {1}}};
+
+	for(bool reverseIndexed : {false, true}) {
+		myGraph.setReverseIndex(reverseIndexed);
+		std::map<std::string, int> weights;
+		myGraph.eachPredecessorEdges(myGraph["1"], [&weights](NodeRef begin,
+		                                                      WeightedProperty const& p) {
+			weights[begin.getName()] = p.weight;
+		});
+		BOOST_CHECK(weights == (std::map<std::string, int>{{"0", 3}, {"2", 5}, {"1", 7}}));
+	}
+}
+
 BOOST_AUTO_TEST_CASE(matrix_node_get_id) {
 	using Graph = matrix::Graph<NoProperty, NoProperty>;
 
@@ -0,0 +1,114 @@
+#include "name_interner.hpp"
+
+#include <string>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+using namespace graph;
+
+BOOST_AUTO_TEST_CASE(name_interner_insertion) {
+	NameInterner names;
+
+	BOOST_CHECK_EQUAL(names.size(), 0);
+	BOOST_CHECK_EQUAL(names.find("1"), NameInterner::npos);
+
+	BOOST_CHECK_EQUAL(names.insert("1"), 0);
+	BOOST_CHECK_EQUAL(names.insert("2"), 1);
+	BOOST_CHECK_EQUAL(names.insert("1"), 0);
+
+	BOOST_CHECK_EQUAL(names.size(), 2);
+	BOOST_CHECK(names.contains("2"));
+	BOOST_CHECK(!names.contains("3"));
+	BOOST_CHECK_EQUAL(names[1], "2");
+}
+
+BOOST_AUTO_TEST_CASE(name_interner_string_view_lookup) {
+	NameInterner names;
+	std::string text = "begin->end";
+
+	names.insert(std::string_view(text).substr(0, 5));
+
+	BOOST_CHECK_EQUAL(names.find("begin"), 0);
+	BOOST_CHECK_EQUAL(names.find(std::string_view(text).substr(7)), NameInterner::npos);
+}
+
+BOOST_AUTO_TEST_CASE(name_interner_many_names) {
+	NameInterner names;
+
+	for(size_t i = 0; i < 10000; ++i) {
+		BOOST_CHECK_EQUAL(names.insert(std::to_string(i)), i);
+	}
+	for(size_t i = 0; i < 10000; ++i) {
+		BOOST_CHECK_EQUAL(names.find(std::to_string(i)), i);
+		BOOST_CHECK_EQUAL(names[i], std::to_string(i));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(name_interner_erase) {
+	NameInterner names;
+	names.insert("a");
+	names.insert("bb");
+	names.insert("ccc");
+
+	names.erase(1);
+
+	BOOST_CHECK_EQUAL(names.size(), 2);
+	BOOST_CHECK(!names.contains("bb"));
+	BOOST_CHECK_EQUAL(names.find("a"), 0);
+	BOOST_CHECK_EQUAL(names.find("ccc"), 1);
+	BOOST_CHECK_EQUAL(names[1], "ccc");
+	BOOST_CHECK_EQUAL(names.insert("bb"), 2);
+}
+
+BOOST_AUTO_TEST_CASE(name_interner_sorted_ids) {
+	NameInterner names, other;
+	names.insert("b");
+	names.insert("c");
+	names.insert("a");
+	other.insert("c");
+	other.insert("a");
+	other.insert("b");
+
+	BOOST_CHECK((names.getSortedIds() == std::vector<size_t>{2, 0, 1}));
+	BOOST_CHECK(names.hasSameNames(other));
+
+	other.erase(0);
+	BOOST_CHECK(!names.hasSameNames(other));
+}
+
+BOOST_AUTO_TEST_CASE(name_interner_release_and_compact) {
+	NameInterner names;
+	for(size_t i = 0; i < 100; ++i) {
+		names.insert(std::to_string(i));
+	}
+
+	for(size_t i = 0; i < 100; i += 2) {
+		names.release(i);
+	}
+
+	BOOST_CHECK_EQUAL(names.size(), 50);
+	BOOST_CHECK_EQUAL(names.getIdBound(), 100);
+	BOOST_CHECK(!names.hasId(10));
+	BOOST_CHECK(!names.contains("10"));
+	BOOST_CHECK_EQUAL(names.find("11"), 11);
+
+	names.insertAt("foo", 10);
+	BOOST_CHECK_EQUAL(names.find("foo"), 10);
+	BOOST_CHECK_EQUAL(names[10], "foo");
+	BOOST_CHECK_EQUAL(names.size(), 51);
+
+	std::vector<size_t> newIds = names.compact();
+	BOOST_CHECK_EQUAL(names.getIdBound(), 51);
+	BOOST_CHECK_EQUAL(newIds[0], NameInterner::npos);
+	BOOST_CHECK_EQUAL(newIds[1], 0);
+	BOOST_CHECK_EQUAL(newIds[10], 5);
+	BOOST_CHECK_EQUAL(names.find("foo"), 5);
+	for(size_t i = 1; i < 100; i += 2) {
+		BOOST_CHECK_EQUAL(names.find(std::to_string(i)), newIds[i]);
+		BOOST_CHECK_EQUAL(names[newIds[i]], std::to_string(i));
+	}
+}
@@ -27,8 +27,8 @@ BOOST_AUTO_TEST_CASE(printing_stream_operator_matrix_graph) {
 
 	Graph myGraph{{"4", "5"}, {"6", "3"}, {"2", "4"}, {"5", "2"}, {"6", "4"}, {"3", "3"}};
 
-	std::string expected = "\"2\" -> \"4\"\n\"3\" -> \"3\"\n\"4\" -> \"5\"\n\"5\" -> \"2\"\n\"6\" "
-	                       "-> \"3\"\n\"6\" -> \"4\"\n";
+	std::string expected = "\"4\" -> \"5\"\n\"5\" -> \"2\"\n\"6\" -> \"4\"\n\"6\" -> \"3\"\n\"3\" "
+	                       "-> \"3\"\n\"2\" -> \"4\"\n";
 	std::ostringstream result;
 
 	result << myGraph;
@@ -51,8 +51,8 @@ BOOST_AUTO_TEST_CASE(printing_make_digraph_matrix_graph) {
 
 	Graph myGraph{{"4", "5"}, {"6", "3"}, {"2", "4"}, {"5", "2"}, {"6", "4"}, {"3", "3"}};
 
-	std::string expected = "digraph myGraph {\n\"2\" -> \"4\"\n\"3\" -> \"3\"\n\"4\" -> "
-	                       "\"5\"\n\"5\" -> \"2\"\n\"6\" -> \"3\"\n\"6\" -> \"4\"\n}\n";
+	std::string expected = "digraph myGraph {\n\"4\" -> \"5\"\n\"5\" -> \"2\"\n\"6\" -> "
+	                       "\"4\"\n\"6\" -> \"3\"\n\"3\" -> \"3\"\n\"2\" -> \"4\"\n}\n";
 
 	BOOST_CHECK_EQUAL(makeDigraph("myGraph", myGraph), expected);
 }
@@ -90,12 +90,12 @@ BOOST_AUTO_TEST_CASE(printing_weighted_edge_matrix_graph) {
 	              {"3", "3", WeightedProperty{6}}};
 
 	std::string expected = "digraph myGraph {\n"
-	                       "\"2\" -> \"4\" [label=\"3\"]\n"
-	                       "\"3\" -> \"3\" [label=\"6\"]\n"
 	                       "\"4\" -> \"5\" [label=\"1\"]\n"
 	                       "\"5\" -> \"2\" [label=\"4\"]\n"
-	                       "\"6\" -> \"3\" [label=\"2\"]\n"
 	                       "\"6\" -> \"4\" [label=\"5\"]\n"
+	                       "\"6\" -> \"3\" [label=\"2\"]\n"
+	                       "\"3\" -> \"3\" [label=\"6\"]\n"
+	                       "\"2\" -> \"4\" [label=\"3\"]\n"
 	                       "}\n";
 
 	BOOST_CHECK_EQUAL(makeDigraph("myGraph", myGraph), expected);
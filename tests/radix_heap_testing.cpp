@@ -0,0 +1,60 @@
+#include "radix_heap.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+using namespace graph;
+
+BOOST_AUTO_TEST_CASE(radix_heap_push_pop) {
+	RadixHeap<std::uint32_t, int> heap;
+
+	BOOST_CHECK(heap.empty());
+	heap.push(5, 50);
+	heap.push(1, 10);
+	heap.push(1000000, 7);
+	heap.push(3, 30);
+	BOOST_CHECK_EQUAL(heap.size(), 4);
+
+	auto [key, value] = heap.pop();
+	BOOST_CHECK_EQUAL(key, 1);
+	BOOST_CHECK_EQUAL(value, 10);
+
+	// Keys not lower than the last popped one can still be pushed.
+	heap.push(1, 11);
+	heap.push(4, 40);
+
+	std::vector<std::uint32_t> keys;
+	while(!heap.empty()) {
+		keys.push_back(heap.pop().first);
+	}
+	BOOST_CHECK(keys == (std::vector<std::uint32_t>{1, 3, 4, 5, 1000000}));
+}
+
+BOOST_AUTO_TEST_CASE(radix_heap_monotone_sequence) {
+	RadixHeap<std::uint64_t, std::uint64_t> heap;
+
+	// Every popped key pushes two greater keys, as a Dijkstra search would.
+	heap.push(0, 0);
+	std::uint64_t last = 0, popped = 0;
+	while(!heap.empty() && popped < 10000) {
+		auto [key, value] = heap.pop();
+		BOOST_REQUIRE_GE(key, last);
+		BOOST_REQUIRE_EQUAL(key, value);
+		last = key;
+		++popped;
+
+		heap.push(key + (key * 7919) % 13, key + (key * 7919) % 13);
+		heap.push(key + (key * 104729) % 1000003 + 1, key + (key * 104729) % 1000003 + 1);
+	}
+	BOOST_CHECK_EQUAL(popped, 10000);
+
+	heap.clear();
+	BOOST_CHECK(heap.empty());
+	heap.push(0, 1);
+	BOOST_CHECK_EQUAL(heap.pop().second, 1);
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "graph.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+#include <string>
+
+#include <cstddef>
+
+// A graph where each node i has an edge to the node (i * step + 11) % nodesCount for each step,
+// with a pseudo-random weight lower than 23. A repeated step gives a parallel edge with another
+// weight. Unless every node is to be reached, there is no edge to the nodes whose id is 5 modulo
+// 97, so that they cannot be reached from the others.
+inline graph::list::WeightedGraph randomWeightedGraph(
+        size_t nodesCount,
+        std::initializer_list<size_t> steps = {1, 7, 61},
+        bool everyNodeReached = false) {
+	graph::list::WeightedGraph result;
+	for(size_t i = 0; i < nodesCount; ++i) {
+		result.addNode(std::to_string(i));
+	}
+	for(size_t i = 0; i < nodesCount; ++i) {
+		for(auto step = steps.begin(); step != steps.end(); ++step) {
+			size_t end     = (i * *step + 11) % nodesCount;
+			size_t repeats = static_cast<size_t>(std::count(steps.begin(), step, *step));
+			int weight     = static_cast<int>((i * 31 + end * 17 + repeats * 13) % 23);
+			if(everyNodeReached || end % 97 != 5) {
+				result.addEdges({std::to_string(i), std::to_string(end), {weight}});
+			}
+		}
+	}
+	return result;
+}
@@ -0,0 +1,88 @@
+#include "small_vector.hpp"
+
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+using namespace graph;
+
+BOOST_AUTO_TEST_CASE(small_vector_inline_storage) {
+	SmallVector<size_t, 4> vector;
+
+	for(size_t i = 0; i < 4; ++i) {
+		vector.push_back(i);
+	}
+
+	BOOST_CHECK(vector.isInline());
+	BOOST_CHECK_EQUAL(vector.size(), 4);
+	BOOST_CHECK_EQUAL(vector.front(), 0);
+	BOOST_CHECK_EQUAL(vector.back(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(small_vector_heap_storage) {
+	SmallVector<size_t, 4> vector;
+	std::vector<size_t> expected;
+
+	for(size_t i = 0; i < 100; ++i) {
+		vector.push_back(i);
+		expected.push_back(i);
+	}
+
+	BOOST_CHECK(!vector.isInline());
+	BOOST_CHECK_GE(vector.capacity(), 100);
+	BOOST_CHECK_EQUAL_COLLECTIONS(vector.begin(), vector.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(small_vector_copy_and_move) {
+	SmallVector<size_t, 2> small, big;
+	small.push_back(1);
+	for(size_t i = 0; i < 10; ++i) {
+		big.push_back(i);
+	}
+
+	SmallVector<size_t, 2> smallCopy(small), bigCopy(big);
+	BOOST_CHECK(smallCopy == small);
+	BOOST_CHECK(bigCopy == big);
+
+	SmallVector<size_t, 2> smallMoved(std::move(smallCopy)), bigMoved(std::move(bigCopy));
+	BOOST_CHECK(smallMoved == small);
+	BOOST_CHECK(bigMoved == big);
+	BOOST_CHECK(smallCopy.empty());
+	BOOST_CHECK(bigCopy.empty());
+
+	smallMoved = big;
+	BOOST_CHECK(smallMoved == big);
+	bigMoved = std::move(small);
+	BOOST_CHECK_EQUAL(bigMoved.size(), 1);
+	BOOST_CHECK(bigMoved.isInline());
+}
+
+BOOST_AUTO_TEST_CASE(small_vector_removal) {
+	SmallVector<size_t, 4> vector;
+	for(size_t i = 0; i < 6; ++i) {
+		vector.push_back(i);
+	}
+
+	vector.swapAndPop(1);
+	std::vector<size_t> expected{0, 5, 2, 3, 4};
+	BOOST_CHECK_EQUAL_COLLECTIONS(vector.begin(), vector.end(), expected.begin(), expected.end());
+
+	vector.erase(vector.begin());
+	expected = {5, 2, 3, 4};
+	BOOST_CHECK_EQUAL_COLLECTIONS(vector.begin(), vector.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(array_view) {
+	SmallVector<size_t, 4> vector;
+	vector.push_back(3);
+	vector.push_back(7);
+
+	ArrayView<size_t> view = vector.view();
+	BOOST_CHECK_EQUAL(view.size(), 2);
+	BOOST_CHECK_EQUAL(view[1], 7);
+	BOOST_CHECK(view == vector.view());
+	BOOST_CHECK(view != ArrayView<size_t>());
+}
@@ -0,0 +1,85 @@
+#include "parallel.hpp"
+#include "union_find.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include <cstdint>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+using namespace graph;
+
+BOOST_AUTO_TEST_CASE(union_find_unite) {
+	ConcurrentUnionFind sets(6);
+
+	BOOST_CHECK_EQUAL(sets.size(), 6);
+	BOOST_CHECK_EQUAL(sets.find(4), 4);
+
+	BOOST_CHECK(sets.unite(4, 2));
+	BOOST_CHECK(sets.unite(5, 4));
+	BOOST_CHECK(!sets.unite(2, 5));
+	BOOST_CHECK(sets.unite(1, 0));
+
+	// The root of a set is its lowest element.
+	BOOST_CHECK_EQUAL(sets.find(5), 2);
+	BOOST_CHECK_EQUAL(sets.find(1), 0);
+	BOOST_CHECK(sets.sameSet(2, 5));
+	BOOST_CHECK(!sets.sameSet(0, 5));
+	BOOST_CHECK(!sets.sameSet(3, 0));
+}
+
+BOOST_AUTO_TEST_CASE(union_find_concurrent_unite) {
+	std::uint32_t const size = 100000;
+	ConcurrentUnionFind sets(size);
+
+	// Every thread links elements to their neighbours, which makes two sets: the even elements
+	// and the odd elements.
+	parallelFor(0, size - 2, 4, 64, [&sets](size_t first, size_t last, size_t) {
+		for(size_t i = first; i < last; ++i) {
+			sets.unite(static_cast<std::uint32_t>(i + 2), static_cast<std::uint32_t>(i));
+		}
+	});
+
+	size_t wrongRoots = 0;
+	for(std::uint32_t i = 0; i < size; ++i) {
+		wrongRoots += sets.find(i) != i % 2;
+	}
+	BOOST_CHECK_EQUAL(wrongRoots, 0);
+	BOOST_CHECK(!sets.sameSet(0, 1));
+}
+
+BOOST_AUTO_TEST_CASE(union_find_parallel_for) {
+	size_t const size = 10000;
+	std::vector<int> visits(size, 0);
+
+	parallelFor(0, size, 0, 100, [&visits](size_t first, size_t last, size_t) {
+		for(size_t i = first; i < last; ++i) {
+			++visits[i];
+		}
+	});
+
+	BOOST_CHECK(std::all_of(visits.begin(), visits.end(), [](int v) { return v == 1; }));
+	BOOST_CHECK_EQUAL(threadsCount(3), 3);
+	BOOST_CHECK_GE(threadsCount(0), 1);
+}
+
+BOOST_AUTO_TEST_CASE(union_find_balanced_bounds) {
+	// The cost of the first 10 indices is 10, the one of the 90 others 1.
+	auto cost   = [](size_t index) { return index < 10 ? size_t(10) : size_t(1); };
+	auto bounds = balancedBounds(0, 100, 4, cost);
+
+	BOOST_REQUIRE_EQUAL(bounds.size(), 5);
+	BOOST_CHECK_EQUAL(bounds.front(), 0);
+	BOOST_CHECK_EQUAL(bounds.back(), 100);
+	BOOST_CHECK(std::is_sorted(bounds.begin(), bounds.end()));
+	BOOST_CHECK_EQUAL(bounds[1], 5);
+	BOOST_CHECK_EQUAL(bounds[2], 10);
+
+	auto empty = balancedBounds(3, 3, 2, cost);
+	BOOST_CHECK_EQUAL(empty.size(), 3);
+	BOOST_CHECK(std::all_of(empty.begin(), empty.end(), [](size_t b) { return b == 3; }));
+}